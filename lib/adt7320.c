@@ -33,7 +33,9 @@
 
 /* ------------------------------------ Includes ------------------------------------ */
 
-#include "adt7320.h"  /**< Include the ADT7320 driver interface and hardware configuration */
+#include "adt7320.h"          /**< Include the ADT7320 driver interface and hardware configuration */
+#include "adt7320_metrics.h"  /**< Metric recording hooks (no-ops unless ADT7320_METRICS_ENABLE) */
+#include "adt7320_trace.h"    /**< Bus-traffic trace hook (no-op unless ADT7320_TRACE_ENABLE) */
 
 
 /* ------------------------------------ Functions ----------------------------------- */
@@ -53,16 +55,20 @@ ADT7320_StatusTypeDef ADT7320_Init(const ADT7320_ConfigTypeDef *pConfig)
 {
     ADT7320_StatusTypeDef status = ADT7320_OK;
     uint8_t data[4U] = {0xFFU, 0xFFU, 0xFFU, 0xFFU};
+    uint32_t start   = 0U;
     
-    if (pConfig == NULL)
+    if (ADT7320_IsValid(pConfig) == 0U)
     {
         status = ADT7320_ERROR;
     }
     else
     {       
-        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_RESET);
+        ADT7320_Select(pConfig);
+        ADT7320_TRACE_SPI(data, 4U);
+        start  = ADT7320_METRIC_NOW();
         status = (ADT7320_StatusTypeDef) HAL_SPI_Transmit(pConfig->SPIx, data, 4U, ADT7320_MAX_DELAY);
-        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_SET);
+        ADT7320_METRIC_SPI(status, start);
+        ADT7320_Deselect(pConfig);
     } 
     
     return status;
@@ -87,8 +93,9 @@ ADT7320_StatusTypeDef ADT7320_ReadRegister(const ADT7320_ConfigTypeDef *pConfig,
     ADT7320_StatusTypeDef status = ADT7320_OK;
     uint8_t txRxBuf[3U] = {0U};
     uint16_t rxData     = 0U;      
+    uint32_t start      = 0U;
        
-    if ( (pConfig == NULL) || (dataSize == 0U) )
+    if ( (ADT7320_IsValid(pConfig) == 0U) || (dataSize == 0U) )
     {
         status = ADT7320_ERROR;
     }
@@ -96,9 +103,12 @@ ADT7320_StatusTypeDef ADT7320_ReadRegister(const ADT7320_ConfigTypeDef *pConfig,
     {   
         txRxBuf[0U] = (ADT7320_READ | ((reg & 0x1FU) << 3U)); 
        
-        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_RESET);
+        ADT7320_Select(pConfig);
+        ADT7320_TRACE_SPI(txRxBuf, (dataSize + 1U));
+        start  = ADT7320_METRIC_NOW();
         status = (ADT7320_StatusTypeDef) HAL_SPI_TransmitReceive(pConfig->SPIx, txRxBuf, txRxBuf, (dataSize + 1U), ADT7320_MAX_DELAY);
-        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_SET);
+        ADT7320_METRIC_SPI(status, start);
+        ADT7320_Deselect(pConfig);
 
         for (uint8_t i = 1U; i <= dataSize; i++)
         {
@@ -128,8 +138,9 @@ ADT7320_StatusTypeDef ADT7320_WriteRegister(const ADT7320_ConfigTypeDef *pConfig
 {
     ADT7320_StatusTypeDef status = ADT7320_OK;
     uint8_t txBuf[3U] = {0U}; 
+    uint32_t start    = 0U;
     
-    if ( (pConfig == NULL) || (dataSize == 0U) )
+    if ( (ADT7320_IsValid(pConfig) == 0U) || (dataSize == 0U) )
     {
         status = ADT7320_ERROR;
     }
@@ -142,9 +153,12 @@ ADT7320_StatusTypeDef ADT7320_WriteRegister(const ADT7320_ConfigTypeDef *pConfig
             txBuf[i + 1U] = (uint8_t)(data >> (8U * (dataSize - i - 1U)));
         }
 
-        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_RESET);
+        ADT7320_Select(pConfig);
+        ADT7320_TRACE_SPI(txBuf, (dataSize + 1U));
+        start  = ADT7320_METRIC_NOW();
         status = (ADT7320_StatusTypeDef) HAL_SPI_Transmit(pConfig->SPIx, txBuf, (dataSize + 1U), ADT7320_MAX_DELAY);
-        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_SET);
+        ADT7320_METRIC_SPI(status, start);
+        ADT7320_Deselect(pConfig);
     }
     
     return status;
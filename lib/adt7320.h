@@ -132,6 +132,35 @@
 #define  ADT7320_THIGH   (0x06U)  ///< High temperature limit register
 #define  ADT7320_TLOW    (0x07U)  ///< Low temperature limit register
 
+/** @brief ADT7320_STATUS register flags */
+#define  ADT7320_STATUS_TLOW   (0x10U)  ///< Temperature below TLOW
+#define  ADT7320_STATUS_THIGH  (0x20U)  ///< Temperature above THIGH
+#define  ADT7320_STATUS_TCRIT  (0x40U)  ///< Temperature above TCRIT
+#define  ADT7320_STATUS_NRDY   (0x80U)  ///< Conversion result not ready (RDY is active low)
+
+/** @brief Typical conversion time of one temperature sample, in milliseconds */
+#define  ADT7320_CONVERSION_MS  (240U)
+
+/**
+ * @brief Hardware chip select (NSS) support.
+ *
+ * On these series the SPI drives NSS as a hardware output while the peripheral is
+ * enabled, and the driver releases it by disabling the peripheral after each
+ * transaction. Select it with csPort = NULL. The NSSP pulse option is not used
+ * because it requires CPHA = 0, while the ADT7320 runs in mode 3. Other series
+ * always use a GPIO chip select.
+ *
+ * NSS belongs to the peripheral, not to a device: it goes low whenever the SPI is
+ * enabled, for any transfer. The ADT7320 must therefore be the only device on an SPI
+ * used with hardware NSS; ADT7320_IsNssExclusive() checks a sensor set for this.
+ */
+#if defined (_STM32F3) || defined (_STM32F7) || defined (_STM32G4) || \
+    defined (_STM32H7) || defined (_STM32L4) || defined (_STM32U5)
+    #define  ADT7320_HW_NSS  (1U)
+#else
+    #define  ADT7320_HW_NSS  (0U)
+#endif
+
 
 /* -------------------------------------- Types -------------------------------------- */
 
@@ -144,7 +173,7 @@
 typedef struct
 {                
     SPI_HandleTypeDef *SPIx;  /**< Pointer to SPI handle used by STM32 HAL SPI driver */      
-    GPIO_TypeDef *csPort;     /**< GPIO port for chip select (CS) pin */    
+    GPIO_TypeDef *csPort;     /**< GPIO port for chip select (CS) pin, or NULL for hardware NSS (ADT7320_HW_NSS) */    
     uint16_t csPin;           /**< GPIO pin number for chip select (CS) */                         
 } ADT7320_ConfigTypeDef;
 
@@ -163,6 +192,85 @@ typedef enum
 } ADT7320_StatusTypeDef;
 
 
+/* -------------------------------- Inline Functions -------------------------------- */
+
+/**
+ * @brief  Asserts the chip select of a sensor.
+ *
+ * With hardware NSS, the SPI drives NSS low itself when the transfer enables it.
+ *
+ * @param[in] pConfig  Pointer to the ADT7320 configuration structure.
+ */
+static inline void ADT7320_Select(const ADT7320_ConfigTypeDef *pConfig)
+{
+    if (pConfig->csPort != NULL)
+    {
+        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_RESET);
+    }
+}
+
+/**
+ * @brief  Releases the chip select of a sensor.
+ *
+ * With hardware NSS, disabling the SPI releases NSS until the next transfer.
+ *
+ * @param[in] pConfig  Pointer to the ADT7320 configuration structure.
+ */
+static inline void ADT7320_Deselect(const ADT7320_ConfigTypeDef *pConfig)
+{
+    if (pConfig->csPort != NULL)
+    {
+        HAL_GPIO_WritePin(pConfig->csPort, pConfig->csPin, GPIO_PIN_SET);
+    }
+#if (ADT7320_HW_NSS == 1U)
+    else
+    {
+        __HAL_SPI_DISABLE(pConfig->SPIx);
+    }
+#endif
+}
+
+/**
+ * @brief  Checks that a configuration has a usable chip select.
+ *
+ * @param[in] pConfig  Pointer to the ADT7320 configuration structure.
+ *
+ * @return Non-zero if valid.
+ */
+static inline uint8_t ADT7320_IsValid(const ADT7320_ConfigTypeDef *pConfig)
+{
+    return (uint8_t)( (pConfig != NULL) && (pConfig->SPIx != NULL) &&
+                      ( (pConfig->csPort != NULL) || (ADT7320_HW_NSS == 1U) ) );
+}
+
+/**
+ * @brief  Checks that no sensor of a set shares an SPI with a hardware NSS sensor.
+ *
+ * @param[in] pSensors  Sensor configurations.
+ * @param[in] count     Number of sensors.
+ *
+ * @return Non-zero if every csPort = NULL sensor is alone on its SPI (always without
+ *         ADT7320_HW_NSS, where such a sensor fails ADT7320_IsValid() instead).
+ */
+static inline uint8_t ADT7320_IsNssExclusive(const ADT7320_ConfigTypeDef *pSensors, uint32_t count)
+{
+    uint8_t exclusive = 1U;
+
+    for (uint32_t a = 0U; (a < count) && (exclusive != 0U) && (ADT7320_HW_NSS == 1U); a++)
+    {
+        for (uint32_t b = a + 1U; (b < count) && (exclusive != 0U); b++)
+        {
+            if ( (pSensors[a].SPIx == pSensors[b].SPIx) && ( (pSensors[a].csPort == NULL) || (pSensors[b].csPort == NULL) ) )
+            {
+                exclusive = 0U;
+            }
+        }
+    }
+
+    return exclusive;
+}
+
+
 /* ------------------------------------ Prototype ------------------------------------ */
 
 /**
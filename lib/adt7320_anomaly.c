@@ -0,0 +1,242 @@
+/**
+ * @file    adt7320_anomaly.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Streaming EWMA mean/variance anomaly detector for ADT7320 samples.
+ *
+ * @details
+ * Incremental EWMA update with alpha = 2^-shift, for a sample x:
+ * - d    = x - mean
+ * - mean = mean + alpha * d
+ * - var  = (1 - alpha) * (var + alpha * d²)
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_anomaly.h"  /**< Anomaly detector interface */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Integer square root.
+ *
+ * @param[in] value  Radicand.
+ *
+ * @return floor(sqrt(value)).
+ */
+static uint32_t ADT7320_Anomaly_Sqrt(uint64_t value)
+{
+    uint64_t rem  = value;
+    uint64_t root = 0U;
+    uint64_t bit  = 1ULL << 62U;
+
+    while (bit > rem)
+    {
+        bit >>= 2U;
+    }
+
+    while (bit != 0U)
+    {
+        if (rem >= (root + bit))
+        {
+            rem  -= root + bit;
+            root  = (root >> 1U) + bit;
+        }
+        else
+        {
+            root >>= 1U;
+        }
+        bit >>= 2U;
+    }
+
+    return (uint32_t)root;
+}
+
+/**
+ * @brief  Computes the signed z-score of a deviation.
+ *
+ * @param[in] d    Deviation from the mean, raw code Q8.
+ * @param[in] var  Variance, raw code² Q16.
+ *
+ * @return z-score, Q8.
+ */
+static int32_t ADT7320_Anomaly_Z(int32_t d, uint64_t var)
+{
+    uint32_t sigma = ADT7320_Anomaly_Sqrt(var);  /* Q8 */
+
+    return (sigma == 0U) ? 0 : (int32_t)(((int64_t)d * 256) / (int64_t)sigma);
+}
+
+/**
+ * @brief  Scales the variance by a squared Q8 z-score, saturating on overflow.
+ *
+ * @param[in] var  Variance, raw code² Q16.
+ * @param[in] z2   Squared z-score, Q16.
+ *
+ * @return var * z2 / 2^16, in raw code² Q16.
+ */
+static uint64_t ADT7320_Anomaly_Limit(uint64_t var, uint64_t z2)
+{
+    return ( (z2 != 0U) && (var > (UINT64_MAX / z2)) ) ? UINT64_MAX : ((var * z2) >> 16U);
+}
+
+/**
+ * @brief  Reports an event through the callback.
+ *
+ * @param[in] pDet   Pointer to the detector state.
+ * @param[in] event  Event type.
+ * @param[in] raw    Raw code of the triggering sample.
+ * @param[in] d      Deviation of that sample, raw code Q8.
+ * @param[in] var    Variance used for the decision, raw code² Q16.
+ */
+static void ADT7320_Anomaly_Notify(const ADT7320_AnomalyTypeDef *pDet, ADT7320_AnomalyEventTypeDef event,
+                                   int16_t raw, int32_t d, uint64_t var)
+{
+    if (pDet->callback != NULL)
+    {
+        pDet->callback(pDet->sensor, event, raw, ADT7320_Anomaly_Z(d, var));
+    }
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes a detector.
+ *
+ * @param[out] pDet      Pointer to the detector state.
+ * @param[in]  sensor    Sensor index reported in events.
+ * @param[in]  pParam    Tuning parameters.
+ * @param[in]  callback  Event callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Detector ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Anomaly_Init(ADT7320_AnomalyTypeDef *pDet, uint8_t sensor, const ADT7320_AnomalyParamTypeDef *pParam,
+                                           ADT7320_AnomalyCallbackTypeDef callback)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pDet == NULL) || (pParam == NULL) || (pParam->shift == 0U) || (pParam->shift > 16U) ||
+         (pParam->zExit > pParam->zEnter) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pDet->param    = *pParam;
+        pDet->callback = callback;
+        pDet->sensor   = sensor;
+        pDet->active   = 0U;
+        pDet->count    = 0U;
+        pDet->events   = 0U;
+        pDet->mean     = 0;
+        pDet->var      = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Evaluates one sample against the current baseline, then updates the baseline.
+ *
+ * @param[in,out] pDet  Pointer to the detector state.
+ * @param[in]     raw   Raw ADT7320_TEMP code.
+ *
+ * @return Non-zero while an alarm is active.
+ */
+uint8_t ADT7320_Anomaly_Process(ADT7320_AnomalyTypeDef *pDet, int16_t raw)
+{
+    int32_t  d      = 0;
+    int32_t  incr   = 0;
+    uint64_t d2     = 0U;
+    uint64_t var    = 0U;
+    uint64_t floor2 = (uint64_t)pDet->param.minSigma * pDet->param.minSigma * 65536U;
+    uint64_t enter2 = (uint64_t)pDet->param.zEnter * pDet->param.zEnter;
+    uint64_t exit2  = (uint64_t)pDet->param.zExit * pDet->param.zExit;
+
+    if (pDet->count == 0U)
+    {
+        pDet->mean = (int32_t)raw * 256;
+    }
+
+    d    = ((int32_t)raw * 256) - pDet->mean;
+    d2   = (uint64_t)((int64_t)d * (int64_t)d);
+    var  = (pDet->var < floor2) ? floor2 : pDet->var;
+
+    /* |z| >= zEnter  <=>  d² >= zEnter² * var */
+    if ( (pDet->count >= pDet->param.warmup) && (var != 0U) )
+    {
+        if ( (pDet->active == 0U) && (d2 >= ADT7320_Anomaly_Limit(var, enter2)) )
+        {
+            pDet->active = 1U;
+            pDet->events++;
+            ADT7320_Anomaly_Notify(pDet, ADT7320_ANOMALY_START, raw, d, var);
+        }
+        else if ( (pDet->active != 0U) && (d2 < ADT7320_Anomaly_Limit(var, exit2)) )
+        {
+            pDet->active = 0U;
+            ADT7320_Anomaly_Notify(pDet, ADT7320_ANOMALY_END, raw, d, var);
+        }
+        else
+        {
+            /* No state change */
+        }
+    }
+
+    incr        = d / (int32_t)(1L << pDet->param.shift);
+    pDet->mean += incr;
+    pDet->var   = pDet->var + (uint64_t)((int64_t)d * (int64_t)incr);
+    pDet->var  -= pDet->var >> pDet->param.shift;
+    pDet->count++;
+
+    return pDet->active;
+}
+
+/**
+ * @brief  Reads a sensor and feeds the sample to its detector.
+ *
+ * @param[in,out] pDet     Pointer to the detector state.
+ * @param[in]     pConfig  Sensor to read.
+ * @param[out]    pRaw     Raw code read (may be NULL).
+ *
+ * @retval ADT7320_OK     Sample read and processed
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Anomaly_Read(ADT7320_AnomalyTypeDef *pDet, const ADT7320_ConfigTypeDef *pConfig, int16_t *pRaw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t data = 0U;
+
+    if ( (pDet == NULL) || (pConfig == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        status = ADT7320_ReadRegister(pConfig, ADT7320_TEMP, 2U, &data);
+
+        if (status == ADT7320_OK)
+        {
+            (void) ADT7320_Anomaly_Process(pDet, (int16_t)data);
+
+            if (pRaw != NULL)
+            {
+                *pRaw = (int16_t)data;
+            }
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_anomaly.c */
@@ -0,0 +1,135 @@
+/**
+ * @file    adt7320_anomaly.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Streaming EWMA mean/variance anomaly detector for ADT7320 samples.
+ *
+ * @details
+ * The ADT7320_THIGH / ADT7320_TLOW limits only catch absolute excursions. This detector
+ * tracks an exponentially weighted mean and variance of the raw temperature per sensor and
+ * flags samples whose z-score |x - mean| / sigma exceeds a threshold, catching sudden noise
+ * or steps early regardless of the absolute temperature.
+ *
+ * - O(1) per sample, integer only; the smoothing factor is 2^-shift.
+ * - The alarm condition is evaluated as d² > z² * var, so no square root is needed on
+ *   the normal path; the z-score is only computed when an event is reported.
+ * - An alarm starts when z >= zEnter and ends when z < zExit (hysteresis).
+ *
+ * Units: mean in raw code Q8, variance in raw code² Q16, z-scores in Q8 (256 = 1 sigma).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_ANOMALY_H
+#define ADT7320_ANOMALY_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Anomaly events reported through the callback.
+ */
+typedef enum
+{
+    ADT7320_ANOMALY_START = 0U,  /**< z-score rose above zEnter */
+    ADT7320_ANOMALY_END   = 1U   /**< z-score fell below zExit */
+} ADT7320_AnomalyEventTypeDef;
+
+/**
+ * @brief Event callback.
+ *
+ * @param sensor  Sensor index given to ADT7320_Anomaly_Init().
+ * @param event   Event type.
+ * @param raw     Raw code of the sample that triggered the event.
+ * @param z       Signed z-score of that sample, Q8.
+ */
+typedef void (*ADT7320_AnomalyCallbackTypeDef)(uint8_t sensor, ADT7320_AnomalyEventTypeDef event, int16_t raw, int32_t z);
+
+/**
+ * @brief Tuning parameters of the detector.
+ */
+typedef struct
+{
+    uint8_t  shift;     /**< Smoothing factor alpha = 2^-shift (1 .. 16) */
+    uint16_t zEnter;    /**< z-score that starts an alarm, Q8 (e.g. 1024 = 4 sigma) */
+    uint16_t zExit;     /**< z-score below which the alarm ends, Q8 (<= zEnter) */
+    uint16_t warmup;    /**< Samples ignored before alarms are evaluated */
+    uint16_t minSigma;  /**< Lower bound on sigma, in LSB, against zero-variance alarms */
+} ADT7320_AnomalyParamTypeDef;
+
+/**
+ * @brief Detector state of one sensor.
+ */
+typedef struct
+{
+    ADT7320_AnomalyParamTypeDef    param;     /**< Tuning parameters */
+    ADT7320_AnomalyCallbackTypeDef callback;  /**< Event callback (may be NULL) */
+    uint8_t  sensor;                          /**< Sensor index reported in events */
+    uint8_t  active;                          /**< Non-zero while an alarm is active */
+    uint32_t count;                           /**< Samples processed */
+    uint32_t events;                          /**< Alarms started */
+    int32_t  mean;                            /**< EWMA mean, raw code Q8 */
+    uint64_t var;                             /**< EWMA variance, raw code² Q16 */
+} ADT7320_AnomalyTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes a detector.
+ *
+ * @param[out] pDet      Pointer to the detector state.
+ * @param[in]  sensor    Sensor index reported in events.
+ * @param[in]  pParam    Tuning parameters.
+ * @param[in]  callback  Event callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Detector ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Anomaly_Init(ADT7320_AnomalyTypeDef *pDet, uint8_t sensor, const ADT7320_AnomalyParamTypeDef *pParam,
+                                           ADT7320_AnomalyCallbackTypeDef callback);
+
+/**
+ * @brief  Evaluates one sample against the current baseline, then updates the baseline.
+ *
+ * @param[in,out] pDet  Pointer to the detector state.
+ * @param[in]     raw   Raw ADT7320_TEMP code.
+ *
+ * @return Non-zero while an alarm is active.
+ */
+uint8_t ADT7320_Anomaly_Process(ADT7320_AnomalyTypeDef *pDet, int16_t raw);
+
+/**
+ * @brief  Reads a sensor and feeds the sample to its detector.
+ *
+ * @param[in,out] pDet     Pointer to the detector state.
+ * @param[in]     pConfig  Sensor to read.
+ * @param[out]    pRaw     Raw code read (may be NULL).
+ *
+ * @retval ADT7320_OK     Sample read and processed
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Anomaly_Read(ADT7320_AnomalyTypeDef *pDet, const ADT7320_ConfigTypeDef *pConfig, int16_t *pRaw);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_ANOMALY_H */
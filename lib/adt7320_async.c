@@ -0,0 +1,482 @@
+/**
+ * @file    adt7320_async.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Asynchronous (IT/DMA) ADT7320 register access with deadlines and cancel.
+ *
+ * @details
+ * The @c active field moves IDLE -> STARTING when an operation takes the bus, STARTING
+ * -> RUNNING once every field of the operation is written, and RUNNING -> ENDING when
+ * one of the completion paths (transfer complete, error, deadline, cancel) claims it.
+ * Poll and Cancel only act on RUNNING, so a tick interrupt landing while an operation
+ * is being set up never sees the previous operation's deadline or callback. The claims
+ * are made with interrupts masked, so of two racing paths (e.g. the transfer completing
+ * while the deadline expires) only the first ends the operation; the other sees ENDING
+ * or IDLE and does nothing.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_async.h"    /**< Asynchronous access interface */
+#include "adt7320_metrics.h"  /**< Metric recording hooks (no-ops unless ADT7320_METRICS_ENABLE) */
+#include "adt7320_trace.h"    /**< Bus-traffic trace hook (no-op unless ADT7320_TRACE_ENABLE) */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+#define  ADT7320_ASYNC_IDLE      (0U)  ///< No operation on the bus
+#define  ADT7320_ASYNC_RUNNING   (1U)  ///< Transfer in flight
+#define  ADT7320_ASYNC_ENDING    (2U)  ///< Operation claimed by a completion path
+#define  ADT7320_ASYNC_STARTING  (3U)  ///< Operation owns the bus, fields being written
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Moves the bus state from one value to another if it currently holds the first.
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ * @param[in]     from  Expected state.
+ * @param[in]     to    New state.
+ *
+ * @return Non-zero if the transition was made by this caller.
+ */
+static uint8_t ADT7320_Async_Transition(ADT7320_AsyncBusTypeDef *pBus, uint8_t from, uint8_t to)
+{
+    uint8_t  done    = 0U;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    if (pBus->active == from)
+    {
+        pBus->active = to;
+        done         = 1U;
+    }
+
+    __set_PRIMASK(primask);
+
+    return done;
+}
+
+/**
+ * @brief  Selects the sensor and starts the transfer of an operation that owns the bus.
+ *
+ * CS is only asserted once the HAL reports the SPI ready: a transfer of another
+ * driver on the same SPI must not see this sensor drive MISO. The operation becomes
+ * RUNNING, and so visible to Poll and Cancel, only after all its fields are written.
+ *
+ * @param[in,out] pBus        Pointer to the bus state (STARTING).
+ * @param[in]     pConfig     Sensor of the operation.
+ * @param[in]     pTx         Bytes to send.
+ * @param[out]    pRx         Bytes received.
+ * @param[in]     length      Number of bytes.
+ * @param[in]     dataSize    Data bytes of a register operation (0 for a raw transfer).
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback.
+ *
+ * @retval ADT7320_OK     Transfer started
+ * @retval ADT7320_BUSY   SPI in use; the bus is released, no callback
+ * @retval ADT7320_ERROR  HAL refused the transfer; the bus is released, no callback
+ */
+static ADT7320_StatusTypeDef ADT7320_Async_Start(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_ConfigTypeDef *pConfig, uint8_t *pTx, uint8_t *pRx,
+                                                 uint16_t length, uint8_t dataSize, uint32_t deadlineMs, ADT7320_AsyncCallbackTypeDef callback,
+                                                 void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    HAL_StatusTypeDef halStatus  = HAL_OK;
+
+    if (HAL_SPI_GetState(pBus->SPIx) != HAL_SPI_STATE_READY)
+    {
+        pBus->active = ADT7320_ASYNC_IDLE;
+        status       = ADT7320_BUSY;
+    }
+    else
+    {
+        pBus->pConfig     = pConfig;
+        pBus->pRx         = pRx;
+        pBus->length      = length;
+        pBus->dataSize    = dataSize;
+        pBus->deadlineMs  = deadlineMs;
+        pBus->callback    = callback;
+        pBus->pContext    = pContext;
+        pBus->startTick   = HAL_GetTick();
+        pBus->startCycles = ADT7320_METRIC_NOW();
+        pBus->active      = ADT7320_ASYNC_RUNNING;
+
+        ADT7320_Select(pConfig);
+        ADT7320_TRACE_SPI(pTx, length);
+
+        if (pBus->mode == ADT7320_ASYNC_DMA)
+        {
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+            SCB_CleanDCache_by_Addr((void *)pTx, (int32_t)ADT7320_ASYNC_CACHE_SIZE(length));
+#endif
+            halStatus = HAL_SPI_TransmitReceive_DMA(pBus->SPIx, pTx, pRx, length);
+        }
+        else
+        {
+            halStatus = HAL_SPI_TransmitReceive_IT(pBus->SPIx, pTx, pRx, length);
+        }
+
+        if (halStatus != HAL_OK)
+        {
+            ADT7320_Deselect(pConfig);
+            ADT7320_METRIC_SPI((ADT7320_StatusTypeDef)halStatus, pBus->startCycles);
+            pBus->active = ADT7320_ASYNC_IDLE;
+            status       = ADT7320_ERROR;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Releases CS and the bus, then invokes the callback of a claimed operation.
+ *
+ * The callback runs after the bus is released, so it may start the next operation.
+ *
+ * @param[in,out] pBus    Pointer to the bus state (ENDING).
+ * @param[in]     status  Outcome of the operation.
+ */
+static void ADT7320_Async_End(ADT7320_AsyncBusTypeDef *pBus, ADT7320_StatusTypeDef status)
+{
+    ADT7320_AsyncCallbackTypeDef callback = pBus->callback;
+    void    *pContext = pBus->pContext;
+    uint16_t data     = 0U;
+
+    ADT7320_Deselect(pBus->pConfig);
+    ADT7320_METRIC_SPI(status, pBus->startCycles);
+
+    if (status == ADT7320_OK)
+    {
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        if (pBus->mode == ADT7320_ASYNC_DMA)
+        {
+            /* Drop lines the core may have fetched while the DMA wrote the buffer */
+            SCB_InvalidateDCache_by_Addr((void *)pBus->pRx, (int32_t)ADT7320_ASYNC_CACHE_SIZE(pBus->length));
+        }
+#endif
+        for (uint8_t i = 1U; i <= pBus->dataSize; i++)
+        {
+            data = (data << 8U) | pBus->buf[i];
+        }
+        pBus->completed++;
+    }
+    else if (status == ADT7320_TIMEOUT)
+    {
+        pBus->timeouts++;
+        ADT7320_METRIC_INC(ADT7320_METRIC_ASYNC_TIMEOUTS);
+    }
+    else
+    {
+        pBus->failed++;
+    }
+
+    pBus->deadlineMs = 0U;
+    pBus->active     = ADT7320_ASYNC_IDLE;
+
+    callback(pContext, status, data);
+}
+
+/**
+ * @brief  Aborts the HAL transfer of a claimed operation and ends it with ADT7320_TIMEOUT.
+ *
+ * HAL_SPI_Abort() stops the SPI and its DMA streams and returns within a bounded time;
+ * a completion interrupt that still fires is ignored because the operation is claimed.
+ *
+ * @param[in,out] pBus  Pointer to the bus state (ENDING).
+ */
+static void ADT7320_Async_Abort(ADT7320_AsyncBusTypeDef *pBus)
+{
+    (void)HAL_SPI_Abort(pBus->SPIx);
+
+    ADT7320_Async_End(pBus, ADT7320_TIMEOUT);
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes an asynchronous bus.
+ *
+ * @param[out] pBus  Pointer to the bus state.
+ * @param[in]  SPIx  SPI handle shared by the sensors of the bus.
+ * @param[in]  mode  Transfer mechanism.
+ *
+ * @retval ADT7320_OK     Bus ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Init(ADT7320_AsyncBusTypeDef *pBus, SPI_HandleTypeDef *SPIx, ADT7320_AsyncModeTypeDef mode)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pBus == NULL) || (SPIx == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pBus->SPIx        = SPIx;
+        pBus->mode        = mode;
+        pBus->active      = ADT7320_ASYNC_IDLE;
+        pBus->pConfig     = NULL;
+        pBus->dataSize    = 0U;
+        pBus->startTick   = 0U;
+        pBus->startCycles = 0U;
+        pBus->deadlineMs  = 0U;
+        pBus->callback    = NULL;
+        pBus->pContext    = NULL;
+        pBus->completed   = 0U;
+        pBus->failed      = 0U;
+        pBus->timeouts    = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts an asynchronous register read.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pConfig     Sensor to read (must use the bus SPI handle).
+ * @param[in]     reg         Register address.
+ * @param[in]     dataSize    Number of bytes to read (1 or 2).
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Read(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize,
+                                         uint32_t deadlineMs, ADT7320_AsyncCallbackTypeDef callback, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pBus == NULL) || (ADT7320_IsValid(pConfig) == 0U) || (pConfig->SPIx != pBus->SPIx) ||
+         (dataSize == 0U) || (dataSize > 2U) || (callback == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_IDLE, ADT7320_ASYNC_STARTING) == 0U)
+    {
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        pBus->buf[0U] = (ADT7320_READ | ((reg & 0x1FU) << 3U));
+        pBus->buf[1U] = 0U;
+        pBus->buf[2U] = 0U;
+
+        status = ADT7320_Async_Start(pBus, pConfig, pBus->buf, pBus->buf, (uint16_t)(dataSize + 1U), dataSize, deadlineMs, callback, pContext);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts an asynchronous register write.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pConfig     Sensor to write (must use the bus SPI handle).
+ * @param[in]     reg         Register address.
+ * @param[in]     dataSize    Number of bytes to write (1 or 2).
+ * @param[in]     data        Value to write.
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Write(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize,
+                                          uint16_t data, uint32_t deadlineMs, ADT7320_AsyncCallbackTypeDef callback, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pBus == NULL) || (ADT7320_IsValid(pConfig) == 0U) || (pConfig->SPIx != pBus->SPIx) ||
+         (dataSize == 0U) || (dataSize > 2U) || (callback == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_IDLE, ADT7320_ASYNC_STARTING) == 0U)
+    {
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        pBus->buf[0U] = (ADT7320_WRITE | ((reg & 0x1FU) << 3U));
+
+        for (uint8_t i = 0U; i < dataSize; i++)
+        {
+            pBus->buf[1U + i] = (uint8_t)(data >> (8U * (dataSize - 1U - i)));
+        }
+
+        status = ADT7320_Async_Start(pBus, pConfig, pBus->buf, pBus->buf, (uint16_t)(dataSize + 1U), dataSize, deadlineMs, callback, pContext);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts a prepared transaction asynchronously.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pPrep       Prepared transaction (must use the bus SPI handle).
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Execute(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_PreparedTypeDef *pPrep, uint32_t deadlineMs,
+                                            ADT7320_AsyncCallbackTypeDef callback, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pBus == NULL) || (pPrep == NULL) || (pPrep->SPIx != pBus->SPIx) || (callback == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_IDLE, ADT7320_ASYNC_STARTING) == 0U)
+    {
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        pBus->buf[0U] = pPrep->tx[0U];
+        pBus->buf[1U] = pPrep->tx[1U];
+        pBus->buf[2U] = pPrep->tx[2U];
+
+        status = ADT7320_Async_Start(pBus, pPrep->pConfig, pBus->buf, pBus->buf, pPrep->length, (uint8_t)(pPrep->length - 1U), deadlineMs,
+                                     callback, pContext);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts a raw transfer of several bytes under one CS assertion (e.g. a command frame).
+ *
+ * The callback gets data 0; the received bytes are in @p pRx once it runs with
+ * ADT7320_OK. Both buffers must stay valid until then.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pConfig     Sensor to select (must use the bus SPI handle).
+ * @param[in]     pTx         Bytes to send.
+ * @param[out]    pRx         Bytes received (may equal @p pTx).
+ * @param[in]     length      Number of bytes.
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Transfer(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_ConfigTypeDef *pConfig, uint8_t *pTx, uint8_t *pRx,
+                                             uint16_t length, uint32_t deadlineMs, ADT7320_AsyncCallbackTypeDef callback, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pBus == NULL) || (ADT7320_IsValid(pConfig) == 0U) || (pConfig->SPIx != pBus->SPIx) ||
+         (pTx == NULL) || (pRx == NULL) || (length == 0U) || (callback == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_IDLE, ADT7320_ASYNC_STARTING) == 0U)
+    {
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        status = ADT7320_Async_Start(pBus, pConfig, pTx, pRx, length, 0U, deadlineMs, callback, pContext);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Ends the operation in flight on transfer completion (from HAL_SPI_TxRxCpltCallback()).
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback (other buses are ignored).
+ */
+void ADT7320_Async_Complete(ADT7320_AsyncBusTypeDef *pBus, const SPI_HandleTypeDef *hspi)
+{
+    if ( (pBus != NULL) && (hspi == pBus->SPIx) &&
+         (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_RUNNING, ADT7320_ASYNC_ENDING) != 0U) )
+    {
+        ADT7320_Async_End(pBus, ADT7320_OK);
+    }
+}
+
+/**
+ * @brief  Ends the operation in flight on SPI error (from HAL_SPI_ErrorCallback()).
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback (other buses are ignored).
+ */
+void ADT7320_Async_Error(ADT7320_AsyncBusTypeDef *pBus, const SPI_HandleTypeDef *hspi)
+{
+    if ( (pBus != NULL) && (hspi == pBus->SPIx) &&
+         (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_RUNNING, ADT7320_ASYNC_ENDING) != 0U) )
+    {
+        ADT7320_Async_End(pBus, ADT7320_ERROR);
+    }
+}
+
+/**
+ * @brief  Aborts the operation in flight if its deadline has expired.
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ */
+void ADT7320_Async_Poll(ADT7320_AsyncBusTypeDef *pBus)
+{
+    if ( (pBus != NULL) && (pBus->active == ADT7320_ASYNC_RUNNING) && (pBus->deadlineMs != 0U) &&
+         ((HAL_GetTick() - pBus->startTick) >= pBus->deadlineMs) &&
+         (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_RUNNING, ADT7320_ASYNC_ENDING) != 0U) )
+    {
+        ADT7320_Async_Abort(pBus);
+    }
+}
+
+/**
+ * @brief  Aborts the operation in flight, if any.
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ *
+ * @retval ADT7320_OK     Operation aborted; its callback got ADT7320_TIMEOUT
+ * @retval ADT7320_ERROR  Invalid parameters or no operation in flight
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Cancel(ADT7320_AsyncBusTypeDef *pBus)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pBus == NULL) || (ADT7320_Async_Transition(pBus, ADT7320_ASYNC_RUNNING, ADT7320_ASYNC_ENDING) == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        ADT7320_Async_Abort(pBus);
+    }
+
+    return status;
+}
+
+
+/* adt7320_async.c */
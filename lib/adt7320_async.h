@@ -0,0 +1,249 @@
+/**
+ * @file    adt7320_async.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Asynchronous (IT/DMA) ADT7320 register access with deadlines and cancel.
+ *
+ * @details
+ * One ADT7320_AsyncBusTypeDef per SPI bus serializes operations: starting an
+ * operation takes the bus lock, and the lock is released when the operation ends.
+ * Every operation ends exactly once, with its callback invoked in one of these ways:
+ *
+ * - transfer complete: ADT7320_OK and the register value;
+ * - SPI error: ADT7320_ERROR;
+ * - deadline expired (checked by ADT7320_Async_Poll()) or ADT7320_Async_Cancel():
+ *   the HAL transfer is aborted, CS released, and the callback gets ADT7320_TIMEOUT.
+ *
+ * The bus is therefore available again at most deadline + abort time after an
+ * operation started, plus the poll period, even if the sensor or the bus hangs.
+ *
+ * The application forwards the HAL callbacks of the SPI:
+ * @code
+ * void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) { ADT7320_Async_Complete(&bus, hspi); }
+ * void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)    { ADT7320_Async_Error(&bus, hspi); }
+ * @endcode
+ * and calls ADT7320_Async_Poll() periodically (e.g. from HAL_SYSTICK_Callback() or the
+ * main loop).
+ *
+ * An operation only asserts CS once the HAL reports the SPI ready, so a transfer of
+ * another driver on the same SPI is never corrupted; the operation returns
+ * ADT7320_BUSY instead.
+ *
+ * @note On cores with a data cache (F7/H7, __DCACHE_PRESENT), the transfer buffer is a
+ *       32-byte cache line of its own: DMA operations clean it before the transfer and
+ *       invalidate it before the received bytes are read, so the bus structure may
+ *       live in cacheable memory. Its DMA streams must reach that memory (e.g. AXI SRAM
+ *       or D2 SRAM on H7, not DTCM). Buffers given to ADT7320_Async_Transfer() follow
+ *       the same rule: 32-byte aligned, padded to ADT7320_ASYNC_CACHE_SIZE(length).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_ASYNC_H
+#define ADT7320_ASYNC_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"           /**< ADT7320 driver interface and configuration */
+#include "adt7320_prepared.h"  /**< Prepared transactions */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Transfer buffer size and alignment: one cache line on cores with a data cache */
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    #define  ADT7320_ASYNC_BUF_SIZE   (32U)
+    #define  ADT7320_ASYNC_BUF_ALIGN  __ALIGNED(32)
+#else
+    #define  ADT7320_ASYNC_BUF_SIZE   (3U)
+    #define  ADT7320_ASYNC_BUF_ALIGN
+#endif
+
+/** @brief Bytes of cache maintained for a DMA buffer of @p length bytes (whole 32-byte lines) */
+#define  ADT7320_ASYNC_CACHE_SIZE(length)  ((((uint32_t)(length)) + 31U) & ~31UL)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Completion callback.
+ *
+ * @param pContext  Context given when the operation was started.
+ * @param status    ADT7320_OK, ADT7320_ERROR or ADT7320_TIMEOUT.
+ * @param data      Register value (reads completed with ADT7320_OK only).
+ */
+typedef void (*ADT7320_AsyncCallbackTypeDef)(void *pContext, ADT7320_StatusTypeDef status, uint16_t data);
+
+/**
+ * @brief Transfer mechanism.
+ */
+typedef enum
+{
+    ADT7320_ASYNC_IT  = 0U,  /**< Interrupt-driven transfer */
+    ADT7320_ASYNC_DMA = 1U   /**< DMA transfer */
+} ADT7320_AsyncModeTypeDef;
+
+/**
+ * @brief Asynchronous bus state.
+ */
+typedef struct
+{
+    SPI_HandleTypeDef *SPIx;                /**< SPI handle of the bus */
+    ADT7320_AsyncModeTypeDef mode;          /**< Transfer mechanism */
+    volatile uint8_t active;                /**< Non-zero while an operation owns the bus */
+    const ADT7320_ConfigTypeDef *pConfig;   /**< Sensor of the operation in flight */
+    ADT7320_ASYNC_BUF_ALIGN uint8_t buf[ADT7320_ASYNC_BUF_SIZE];  /**< Command and data bytes, received in place */
+    uint8_t  dataSize;                      /**< Data bytes of a register operation (0 for a raw transfer) */
+    uint8_t  *pRx;                          /**< Receive buffer of the operation in flight */
+    uint16_t length;                        /**< Bytes of the operation in flight */
+    uint32_t startTick;                     /**< Tick when the operation started, in ms */
+    uint32_t startCycles;                   /**< Cycle count at start (latency metric) */
+    uint32_t deadlineMs;                    /**< Allowed duration, in ms (0 = none) */
+    ADT7320_AsyncCallbackTypeDef callback;  /**< Completion callback */
+    void    *pContext;                      /**< Context passed to the callback */
+    uint32_t completed;                     /**< Operations completed with ADT7320_OK */
+    uint32_t failed;                        /**< Operations completed with ADT7320_ERROR */
+    uint32_t timeouts;                      /**< Operations aborted (deadline or cancel) */
+} ADT7320_AsyncBusTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes an asynchronous bus.
+ *
+ * @param[out] pBus  Pointer to the bus state.
+ * @param[in]  SPIx  SPI handle shared by the sensors of the bus.
+ * @param[in]  mode  Transfer mechanism.
+ *
+ * @retval ADT7320_OK     Bus ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Init(ADT7320_AsyncBusTypeDef *pBus, SPI_HandleTypeDef *SPIx, ADT7320_AsyncModeTypeDef mode);
+
+/**
+ * @brief  Starts an asynchronous register read.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pConfig     Sensor to read (must use the bus SPI handle).
+ * @param[in]     reg         Register address.
+ * @param[in]     dataSize    Number of bytes to read (1 or 2).
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Read(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize,
+                                         uint32_t deadlineMs, ADT7320_AsyncCallbackTypeDef callback, void *pContext);
+
+/**
+ * @brief  Starts an asynchronous register write.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pConfig     Sensor to write (must use the bus SPI handle).
+ * @param[in]     reg         Register address.
+ * @param[in]     dataSize    Number of bytes to write (1 or 2).
+ * @param[in]     data        Value to write.
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Write(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize,
+                                          uint16_t data, uint32_t deadlineMs, ADT7320_AsyncCallbackTypeDef callback, void *pContext);
+
+/**
+ * @brief  Starts a prepared transaction asynchronously.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pPrep       Prepared transaction (must use the bus SPI handle).
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Execute(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_PreparedTypeDef *pPrep, uint32_t deadlineMs,
+                                            ADT7320_AsyncCallbackTypeDef callback, void *pContext);
+
+/**
+ * @brief  Starts a raw transfer of several bytes under one CS assertion (e.g. a command frame).
+ *
+ * The callback gets data 0; the received bytes are in @p pRx once it runs with
+ * ADT7320_OK. Both buffers must stay valid until then.
+ *
+ * @param[in,out] pBus        Pointer to the bus state.
+ * @param[in]     pConfig     Sensor to select (must use the bus SPI handle).
+ * @param[in]     pTx         Bytes to send.
+ * @param[out]    pRx         Bytes received (may equal @p pTx).
+ * @param[in]     length      Number of bytes.
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ * @param[in]     callback    Completion callback.
+ * @param[in]     pContext    Context passed to the callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Operation started; the callback will be invoked once
+ * @retval ADT7320_BUSY   Another operation owns the bus, or the SPI is in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Transfer(ADT7320_AsyncBusTypeDef *pBus, const ADT7320_ConfigTypeDef *pConfig, uint8_t *pTx, uint8_t *pRx,
+                                             uint16_t length, uint32_t deadlineMs, ADT7320_AsyncCallbackTypeDef callback, void *pContext);
+
+/**
+ * @brief  Ends the operation in flight on transfer completion (from HAL_SPI_TxRxCpltCallback()).
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback (other buses are ignored).
+ */
+void ADT7320_Async_Complete(ADT7320_AsyncBusTypeDef *pBus, const SPI_HandleTypeDef *hspi);
+
+/**
+ * @brief  Ends the operation in flight on SPI error (from HAL_SPI_ErrorCallback()).
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback (other buses are ignored).
+ */
+void ADT7320_Async_Error(ADT7320_AsyncBusTypeDef *pBus, const SPI_HandleTypeDef *hspi);
+
+/**
+ * @brief  Aborts the operation in flight if its deadline has expired.
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ */
+void ADT7320_Async_Poll(ADT7320_AsyncBusTypeDef *pBus);
+
+/**
+ * @brief  Aborts the operation in flight, if any.
+ *
+ * @param[in,out] pBus  Pointer to the bus state.
+ *
+ * @retval ADT7320_OK     Operation aborted; its callback got ADT7320_TIMEOUT
+ * @retval ADT7320_ERROR  Invalid parameters or no operation in flight
+ */
+ADT7320_StatusTypeDef ADT7320_Async_Cancel(ADT7320_AsyncBusTypeDef *pBus);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_ASYNC_H */
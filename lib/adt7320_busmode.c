@@ -0,0 +1,252 @@
+/**
+ * @file    adt7320_busmode.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Lazy SPI mode switching for buses shared with devices in other SPI modes.
+ *
+ * @details
+ * HAL init values of polarity, phase and prescaler are the register bits themselves
+ * (CR1 on most series, CFG2/CFG1 on H7/U5), so a switch is a read-modify-write of those
+ * bits. The SPI is disabled first, as required to change them; the HAL transfer
+ * functions enable it again. The handle Init fields are updated too, so a later
+ * HAL_SPI_Init() keeps the mode.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_busmode.h"  /**< Bus mode switching interface */
+#include "adt7320_metrics.h"  /**< Metric recording hooks */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+#if defined (_STM32H7) || defined (_STM32U5)
+    #define  ADT7320_BUSMODE_CFG_REGS  (1U)  ///< Mode bits in CFG2, prescaler in CFG1
+#else
+    #define  ADT7320_BUSMODE_CFG_REGS  (0U)  ///< Mode bits and prescaler in CR1
+#endif
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Compares two modes.
+ *
+ * @param[in] pA  First mode.
+ * @param[in] pB  Second mode.
+ *
+ * @return Non-zero if equal.
+ */
+static uint8_t ADT7320_BusMode_Equal(const ADT7320_BusModeTypeDef *pA, const ADT7320_BusModeTypeDef *pB)
+{
+    return (uint8_t)( (pA->polarity == pB->polarity) && (pA->phase == pB->phase) && (pA->prescaler == pB->prescaler) );
+}
+
+/**
+ * @brief  Runs every pending job of a mode.
+ *
+ * @param[in,out] pJobs  Jobs of the batch.
+ * @param[in]     count  Number of jobs.
+ * @param[in]     pMode  Mode the SPI is in.
+ *
+ * @return Non-zero if one of the jobs failed.
+ */
+static uint8_t ADT7320_BusMode_RunGroup(ADT7320_BusJobTypeDef *pJobs, uint16_t count, const ADT7320_BusModeTypeDef *pMode)
+{
+    uint8_t failed = 0U;
+
+    for (uint16_t i = 0U; i < count; i++)
+    {
+        if ( (pJobs[i].done == 0U) && (ADT7320_BusMode_Equal(pJobs[i].pMode, pMode) != 0U) )
+        {
+            pJobs[i].status = pJobs[i].run(pJobs[i].pContext);
+            pJobs[i].done   = 1U;
+
+            if (pJobs[i].status != ADT7320_OK)
+            {
+                failed = 1U;
+            }
+        }
+    }
+
+    return failed;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes a shared bus from the current HAL init values of its SPI.
+ *
+ * @param[out] pBus  Pointer to the bus state.
+ * @param[in]  SPIx  SPI handle of the bus (initialized with HAL_SPI_Init()).
+ *
+ * @retval ADT7320_OK     Bus ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_BusMode_Init(ADT7320_BusTypeDef *pBus, SPI_HandleTypeDef *SPIx)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pBus == NULL) || (SPIx == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pBus->SPIx           = SPIx;
+        pBus->mode.polarity  = SPIx->Init.CLKPolarity;
+        pBus->mode.phase     = SPIx->Init.CLKPhase;
+        pBus->mode.prescaler = SPIx->Init.BaudRatePrescaler;
+        pBus->switches       = 0U;
+        pBus->avoided        = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Puts the SPI in a mode, unless it is already in it.
+ *
+ * @param[in,out] pBus   Pointer to the bus state.
+ * @param[in]     pMode  Mode needed by the next transactions.
+ *
+ * @retval ADT7320_OK     SPI in the requested mode
+ * @retval ADT7320_BUSY   A transfer is in progress; mode unchanged
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_BusMode_Apply(ADT7320_BusTypeDef *pBus, const ADT7320_BusModeTypeDef *pMode)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    SPI_TypeDef *spi = NULL;
+
+    if ( (pBus == NULL) || (pMode == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (ADT7320_BusMode_Equal(&pBus->mode, pMode) != 0U)
+    {
+        pBus->avoided++;
+    }
+    else if (pBus->SPIx->State != HAL_SPI_STATE_READY)
+    {
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        spi = pBus->SPIx->Instance;
+
+        __HAL_SPI_DISABLE(pBus->SPIx);
+
+#if (ADT7320_BUSMODE_CFG_REGS == 1U)
+        spi->CFG1 = (spi->CFG1 & ~SPI_CFG1_MBR) | pMode->prescaler;
+        spi->CFG2 = (spi->CFG2 & ~(SPI_CFG2_CPOL | SPI_CFG2_CPHA)) | pMode->polarity | pMode->phase;
+#else
+        spi->CR1 = (spi->CR1 & ~(SPI_CR1_CPOL | SPI_CR1_CPHA | SPI_CR1_BR)) | pMode->polarity | pMode->phase | pMode->prescaler;
+#endif
+
+        pBus->SPIx->Init.CLKPolarity       = pMode->polarity;
+        pBus->SPIx->Init.CLKPhase          = pMode->phase;
+        pBus->SPIx->Init.BaudRatePrescaler = pMode->prescaler;
+
+        pBus->mode = *pMode;
+        pBus->switches++;
+        ADT7320_METRIC_INC(ADT7320_METRIC_BUSMODE_SWITCHES);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Runs a batch of jobs grouped by mode.
+ *
+ * Jobs needing the same mode run in their original order. Each job status is stored
+ * in the job.
+ *
+ * @param[in,out] pBus   Pointer to the bus state.
+ * @param[in,out] pJobs  Jobs to run.
+ * @param[in]     count  Number of jobs.
+ *
+ * @retval ADT7320_OK     Every job ran and returned ADT7320_OK
+ * @retval ADT7320_BUSY   A mode switch was refused; jobs not run keep done == 0
+ * @retval ADT7320_ERROR  Invalid parameters (including a job without mode or work; no job
+ *                        runs then) or at least one job failed
+ */
+ADT7320_StatusTypeDef ADT7320_BusMode_Run(ADT7320_BusTypeDef *pBus, ADT7320_BusJobTypeDef *pJobs, uint16_t count)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_BusModeTypeDef current;
+    uint32_t inOrder  = 0U;
+    uint32_t switches = 0U;
+    uint8_t  failed   = 0U;
+
+    if ( (pBus == NULL) || ((pJobs == NULL) && (count > 0U)) )
+    {
+        status = ADT7320_ERROR;
+    }
+
+    for (uint16_t i = 0U; (i < count) && (status == ADT7320_OK); i++)
+    {
+        if ( (pJobs[i].pMode == NULL) || (pJobs[i].run == NULL) )
+        {
+            status = ADT7320_ERROR;
+        }
+    }
+
+    if (status == ADT7320_OK)
+    {
+        /* Switches the jobs would have cost in their given order */
+        current = pBus->mode;
+
+        for (uint16_t i = 0U; i < count; i++)
+        {
+            pJobs[i].done = 0U;
+
+            if (ADT7320_BusMode_Equal(&current, pJobs[i].pMode) == 0U)
+            {
+                current = *pJobs[i].pMode;
+                inOrder++;
+            }
+        }
+
+        switches = pBus->switches;
+        failed   = ADT7320_BusMode_RunGroup(pJobs, count, &pBus->mode);
+
+        for (uint16_t i = 0U; (i < count) && (status == ADT7320_OK); i++)
+        {
+            if (pJobs[i].done == 0U)
+            {
+                status = ADT7320_BusMode_Apply(pBus, pJobs[i].pMode);
+
+                if (status == ADT7320_OK)
+                {
+                    failed |= ADT7320_BusMode_RunGroup(pJobs, count, pJobs[i].pMode);
+                }
+            }
+        }
+
+        switches = pBus->switches - switches;
+
+        if (inOrder > switches)
+        {
+            pBus->avoided += (inOrder - switches);
+        }
+
+        if ( (status == ADT7320_OK) && (failed != 0U) )
+        {
+            status = ADT7320_ERROR;
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_busmode.c */
@@ -0,0 +1,145 @@
+/**
+ * @file    adt7320_busmode.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Lazy SPI mode switching for buses shared with devices in other SPI modes.
+ *
+ * @details
+ * The ADT7320 needs CPOL=1/CPHA=1; other devices on the same bus (e.g. a mode-0 flash)
+ * may not. Calling HAL_SPI_Init() before each access is slow. This module instead:
+ *
+ * - tracks the mode (polarity, phase, prescaler) the SPI is currently in;
+ * - on ADT7320_BusMode_Apply(), does nothing when the mode already matches, and
+ *   otherwise rewrites only the CPOL/CPHA/baud-rate bits (CR1, or CFG1/CFG2 on
+ *   H7/U5) with the SPI disabled;
+ * - on ADT7320_BusMode_Run(), executes a list of jobs grouped by mode (the current
+ *   mode first, then the others in order of first appearance), so each mode is set
+ *   at most once per list.
+ *
+ * Counters give the switches made and the switches avoided (by the lazy check and by
+ * grouping).
+ *
+ * @note Every chip select of the bus must be released when the mode changes.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_BUSMODE_H
+#define ADT7320_BUSMODE_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Mode initializer for the ADT7320 (CPOL=1, CPHA=1) at a given SPI_BAUDRATEPRESCALER_x */
+#define  ADT7320_BUSMODE_ADT7320(prescaler)  { SPI_POLARITY_HIGH, SPI_PHASE_2EDGE, (prescaler) }
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief SPI mode and clock, as HAL init values.
+ */
+typedef struct
+{
+    uint32_t polarity;   /**< SPI_POLARITY_LOW or SPI_POLARITY_HIGH */
+    uint32_t phase;      /**< SPI_PHASE_1EDGE or SPI_PHASE_2EDGE */
+    uint32_t prescaler;  /**< SPI_BAUDRATEPRESCALER_x */
+} ADT7320_BusModeTypeDef;
+
+/**
+ * @brief Shared bus state.
+ */
+typedef struct
+{
+    SPI_HandleTypeDef *SPIx;        /**< SPI handle of the bus */
+    ADT7320_BusModeTypeDef mode;    /**< Mode the SPI is currently in */
+    uint32_t switches;              /**< Mode switches made */
+    uint32_t avoided;               /**< Mode switches avoided */
+} ADT7320_BusTypeDef;
+
+/**
+ * @brief Work run in one mode.
+ *
+ * @param pContext  Context of the job.
+ *
+ * @return Status of the job.
+ */
+typedef ADT7320_StatusTypeDef (*ADT7320_BusJobFnTypeDef)(void *pContext);
+
+/**
+ * @brief One job of a batch.
+ */
+typedef struct
+{
+    const ADT7320_BusModeTypeDef *pMode;  /**< Mode the job needs */
+    ADT7320_BusJobFnTypeDef run;          /**< Work to do */
+    void    *pContext;                    /**< Context passed to run */
+    ADT7320_StatusTypeDef status;         /**< Status returned by run */
+    uint8_t  done;                        /**< Set once the job has run */
+} ADT7320_BusJobTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes a shared bus from the current HAL init values of its SPI.
+ *
+ * @param[out] pBus  Pointer to the bus state.
+ * @param[in]  SPIx  SPI handle of the bus (initialized with HAL_SPI_Init()).
+ *
+ * @retval ADT7320_OK     Bus ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_BusMode_Init(ADT7320_BusTypeDef *pBus, SPI_HandleTypeDef *SPIx);
+
+/**
+ * @brief  Puts the SPI in a mode, unless it is already in it.
+ *
+ * @param[in,out] pBus   Pointer to the bus state.
+ * @param[in]     pMode  Mode needed by the next transactions.
+ *
+ * @retval ADT7320_OK     SPI in the requested mode
+ * @retval ADT7320_BUSY   A transfer is in progress; mode unchanged
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_BusMode_Apply(ADT7320_BusTypeDef *pBus, const ADT7320_BusModeTypeDef *pMode);
+
+/**
+ * @brief  Runs a batch of jobs grouped by mode.
+ *
+ * Jobs needing the same mode run in their original order. Each job status is stored
+ * in the job.
+ *
+ * @param[in,out] pBus   Pointer to the bus state.
+ * @param[in,out] pJobs  Jobs to run.
+ * @param[in]     count  Number of jobs.
+ *
+ * @retval ADT7320_OK     Every job ran and returned ADT7320_OK
+ * @retval ADT7320_BUSY   A mode switch was refused; jobs not run keep done == 0
+ * @retval ADT7320_ERROR  Invalid parameters (including a job without mode or work; no job
+ *                        runs then) or at least one job failed
+ */
+ADT7320_StatusTypeDef ADT7320_BusMode_Run(ADT7320_BusTypeDef *pBus, ADT7320_BusJobTypeDef *pJobs, uint16_t count);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_BUSMODE_H */
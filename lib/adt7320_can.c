@@ -0,0 +1,297 @@
+/**
+ * @file    adt7320_can.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   CAN / CAN-FD telemetry packer and unpacker for ADT7320 sensor arrays.
+ *
+ * @details
+ * A frame is built in a local buffer; the sensors it carries are marked as transmitted
+ * only once the transmit function accepted it.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_can.h"  /**< CAN packer interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Index marking the end of the entries */
+#define  ADT7320_CAN_END  (0xFFU)
+
+/** @brief Entries per frame at the largest payload */
+#define  ADT7320_CAN_MAX_ENTRIES  ((ADT7320_CAN_MAX_PAYLOAD - 1U) / ADT7320_CAN_ENTRY_SIZE)
+
+#if ( (ADT7320_CAN_MAX_SENSORS == 0U) || (ADT7320_CAN_MAX_SENSORS > 255U) )
+    #error "ADT7320_CAN_MAX_SENSORS must be between 1 and 255"
+#endif
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Rounds a payload length up to a valid frame length.
+ *
+ * @param[in] pCan  Pointer to the packer state.
+ * @param[in] used  Bytes in use.
+ *
+ * @return Frame length, in bytes.
+ */
+static uint8_t ADT7320_Can_Length(const ADT7320_CanTypeDef *pCan, uint8_t used)
+{
+    static const uint8_t fdLength[7U] = {12U, 16U, 20U, 24U, 32U, 48U, 64U};
+
+    uint8_t len = used;
+
+    if ( (pCan->payload > 8U) && (used > 8U) )
+    {
+        len = ADT7320_CAN_MAX_PAYLOAD;
+        for (uint8_t i = 7U; i > 0U; i--)
+        {
+            if (fdLength[i - 1U] >= used)
+            {
+                len = fdLength[i - 1U];
+            }
+        }
+    }
+
+    return len;
+}
+
+/**
+ * @brief  Transmits a built frame and marks its sensors as sent.
+ *
+ * @param[in,out] pCan     Pointer to the packer state.
+ * @param[in,out] pFrame   Frame buffer (padded here).
+ * @param[in]     pSensor  Sensors carried by the frame.
+ * @param[in]     pRaw     Raw codes, indexed by sensor.
+ * @param[in]     entries  Number of entries in the frame.
+ *
+ * @retval ADT7320_OK     Frame queued
+ * @retval ADT7320_ERROR  Transmit failure
+ */
+static ADT7320_StatusTypeDef ADT7320_Can_Flush(ADT7320_CanTypeDef *pCan, uint8_t *pFrame, const uint8_t *pSensor,
+                                               const int16_t *pRaw, uint8_t entries)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint8_t used = (uint8_t)(1U + (entries * ADT7320_CAN_ENTRY_SIZE));
+    uint8_t len  = ADT7320_Can_Length(pCan, used);
+
+    pFrame[0U] = pCan->seq;
+    for (uint8_t i = used; i < len; i++)
+    {
+        pFrame[i] = ADT7320_CAN_END;
+    }
+
+    status = pCan->transmit(pCan->pContext, pCan->id, pFrame, len);
+
+    if (status == ADT7320_OK)
+    {
+        pCan->seq++;
+        pCan->frames++;
+        pCan->entries += entries;
+        pCan->bytes   += len;
+
+        for (uint8_t i = 0U; i < entries; i++)
+        {
+            pCan->last[pSensor[i]]  = pRaw[pSensor[i]];
+            pCan->valid[pSensor[i]] = 1U;
+        }
+    }
+    else
+    {
+        status = ADT7320_ERROR;
+    }
+
+    return status;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes a packer.
+ *
+ * @param[out] pCan      Pointer to the packer state.
+ * @param[in]  mode      Frame format.
+ * @param[in]  id        Frame identifier.
+ * @param[in]  deadband  Change below or equal to this is not sent, in LSB (0 sends every change).
+ * @param[in]  refresh   Sweeps between full refreshes (0 = never).
+ * @param[in]  transmit  Transmit function.
+ * @param[in]  pContext  Context passed to transmit (may be NULL).
+ *
+ * @retval ADT7320_OK     Packer ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Can_Init(ADT7320_CanTypeDef *pCan, ADT7320_CanModeTypeDef mode, uint32_t id, uint16_t deadband,
+                                       uint16_t refresh, ADT7320_CanTransmitTypeDef transmit, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pCan == NULL) || (transmit == NULL) || (mode > ADT7320_CAN_FD) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pCan->transmit = transmit;
+        pCan->pContext = pContext;
+        pCan->id       = id;
+        pCan->payload  = (mode == ADT7320_CAN_FD) ? (uint8_t)ADT7320_CAN_MAX_PAYLOAD : 8U;
+        pCan->seq      = 0U;
+        pCan->deadband = deadband;
+        pCan->refresh  = refresh;
+        pCan->sweep    = 0U;
+        pCan->frames   = 0U;
+        pCan->entries  = 0U;
+        pCan->bytes    = 0U;
+
+        for (uint8_t s = 0U; s < ADT7320_CAN_MAX_SENSORS; s++)
+        {
+            pCan->last[s]  = 0;
+            pCan->valid[s] = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Packs and transmits the readings of one sweep that need to be sent.
+ *
+ * Readings left unsent after a transmit failure are retried on the next sweep; a full
+ * refresh cut short is repeated whole.
+ *
+ * @param[in,out] pCan   Pointer to the packer state.
+ * @param[in]     pRaw   Raw ADT7320_TEMP codes, indexed by sensor.
+ * @param[in]     count  Number of sensors (<= ADT7320_CAN_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Sweep transmitted (possibly no frame at all)
+ * @retval ADT7320_ERROR  Invalid parameters or transmit failure
+ */
+ADT7320_StatusTypeDef ADT7320_Can_Pack(ADT7320_CanTypeDef *pCan, const int16_t *pRaw, uint8_t count)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint8_t  frame[ADT7320_CAN_MAX_PAYLOAD];
+    uint8_t  sensor[ADT7320_CAN_MAX_ENTRIES];
+    uint8_t  perFrame = 0U;
+    uint8_t  entries  = 0U;
+    uint8_t  full     = 0U;
+    uint8_t  pos      = 0U;
+    int32_t  delta    = 0;
+
+    if ( (pCan == NULL) || (pRaw == NULL) || (count > ADT7320_CAN_MAX_SENSORS) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        perFrame = (uint8_t)((pCan->payload - 1U) / ADT7320_CAN_ENTRY_SIZE);
+
+        if (pCan->refresh != 0U)
+        {
+            if (((uint32_t)pCan->sweep + 1U) >= pCan->refresh)
+            {
+                full = 1U;
+            }
+            else
+            {
+                pCan->sweep++;
+            }
+        }
+
+        for (uint8_t s = 0U; (s < count) && (status == ADT7320_OK); s++)
+        {
+            delta = (int32_t)pRaw[s] - pCan->last[s];
+            delta = (delta < 0) ? -delta : delta;
+
+            if ( (full != 0U) || (pCan->valid[s] == 0U) || (delta > (int32_t)pCan->deadband) )
+            {
+                pos = (uint8_t)(1U + (entries * ADT7320_CAN_ENTRY_SIZE));
+                frame[pos]      = s;
+                frame[pos + 1U] = (uint8_t)((uint16_t)pRaw[s] & 0xFFU);
+                frame[pos + 2U] = (uint8_t)((uint16_t)pRaw[s] >> 8U);
+                sensor[entries] = s;
+                entries++;
+
+                if (entries == perFrame)
+                {
+                    status  = ADT7320_Can_Flush(pCan, frame, sensor, pRaw, entries);
+                    entries = 0U;
+                }
+            }
+        }
+
+        if ( (status == ADT7320_OK) && (entries != 0U) )
+        {
+            status = ADT7320_Can_Flush(pCan, frame, sensor, pRaw, entries);
+        }
+
+        /* A refresh cut short by a transmit failure is repeated in full on the next sweep */
+        if ( (full != 0U) && (status == ADT7320_OK) )
+        {
+            pCan->sweep = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Unpacks one received frame into a reading table.
+ *
+ * @param[in]     pData     Payload.
+ * @param[in]     len       Payload length, in bytes.
+ * @param[in,out] pRaw      Raw codes, indexed by sensor; updated entries are overwritten.
+ * @param[in]     count     Size of pRaw (entries with a larger index are skipped).
+ * @param[out]    pSeq      Sequence counter of the frame (may be NULL).
+ * @param[out]    pUpdated  Number of readings written (may be NULL).
+ *
+ * @retval ADT7320_OK     Frame unpacked
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Can_Unpack(const uint8_t *pData, uint8_t len, int16_t *pRaw, uint8_t count,
+                                         uint8_t *pSeq, uint8_t *pUpdated)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint8_t updated = 0U;
+    uint8_t pos     = 1U;
+
+    if ( (pData == NULL) || (pRaw == NULL) || (len == 0U) || (len > ADT7320_CAN_MAX_PAYLOAD) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        while ( ((pos + ADT7320_CAN_ENTRY_SIZE) <= len) && (pData[pos] != ADT7320_CAN_END) )
+        {
+            if (pData[pos] < count)
+            {
+                pRaw[pData[pos]] = (int16_t)(uint16_t)((uint16_t)pData[pos + 1U] | ((uint16_t)pData[pos + 2U] << 8U));
+                updated++;
+            }
+            pos = (uint8_t)(pos + ADT7320_CAN_ENTRY_SIZE);
+        }
+
+        if (pSeq != NULL)
+        {
+            *pSeq = pData[0U];
+        }
+        if (pUpdated != NULL)
+        {
+            *pUpdated = updated;
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_can.c */
@@ -0,0 +1,157 @@
+/**
+ * @file    adt7320_can.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   CAN / CAN-FD telemetry packer and unpacker for ADT7320 sensor arrays.
+ *
+ * @details
+ * Packs raw 16-bit readings of many sensors into classic CAN (8-byte) or CAN-FD
+ * (up to 64-byte) frames instead of one float per frame.
+ *
+ * Frame payload:
+ * - byte 0: sequence counter, incremented per frame (lets the receiver detect losses)
+ * - then 3-byte entries: sensor index, raw code low byte, raw code high byte
+ * - unused bytes up to the frame length are 0xFF (index 0xFF ends the entries)
+ *
+ * A classic frame carries 2 entries, a 64-byte CAN-FD frame 21. CAN-FD payloads are padded
+ * to the next valid DLC length.
+ *
+ * Change-only transmission: a sensor is sent when its code moved more than the deadband
+ * from the last transmitted value, and every sensor is re-sent every @c refresh sweeps so
+ * that a receiver joining late, or one that lost frames, converges.
+ *
+ * Frames leave through an application-supplied transmit function (HAL_CAN_AddTxMessage(),
+ * HAL_FDCAN_AddMessageToTxFifoQ(), or a fake when running on a host).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_CAN_H
+#define ADT7320_CAN_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Size of one entry, in bytes */
+#define  ADT7320_CAN_ENTRY_SIZE  (3U)
+
+/** @brief Largest CAN-FD payload, in bytes */
+#define  ADT7320_CAN_MAX_PAYLOAD  (64U)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Frame format.
+ */
+typedef enum
+{
+    ADT7320_CAN_CLASSIC = 0U,  /**< Classic CAN, 8-byte payload */
+    ADT7320_CAN_FD      = 1U   /**< CAN-FD, up to 64-byte payload */
+} ADT7320_CanModeTypeDef;
+
+/**
+ * @brief Transmit function.
+ *
+ * @param pContext  Context given to ADT7320_Can_Init() (e.g. CAN handle).
+ * @param id        Frame identifier.
+ * @param pData     Payload.
+ * @param len       Payload length, in bytes (a valid CAN / CAN-FD length).
+ *
+ * @return ADT7320_OK if the frame was queued.
+ */
+typedef ADT7320_StatusTypeDef (*ADT7320_CanTransmitTypeDef)(void *pContext, uint32_t id, const uint8_t *pData, uint8_t len);
+
+/**
+ * @brief Packer state.
+ */
+typedef struct
+{
+    ADT7320_CanTransmitTypeDef transmit;      /**< Transmit function */
+    void    *pContext;                        /**< Context passed to transmit */
+    uint32_t id;                              /**< Frame identifier */
+    uint8_t  payload;                         /**< Payload length, in bytes */
+    uint8_t  seq;                             /**< Sequence counter of the next frame */
+    uint16_t deadband;                        /**< Change below or equal to this is not sent, in LSB */
+    uint16_t refresh;                         /**< Sweeps between full refreshes (0 = never) */
+    uint16_t sweep;                           /**< Sweeps since the last full refresh */
+    int16_t  last[ADT7320_CAN_MAX_SENSORS];   /**< Last transmitted code per sensor */
+    uint8_t  valid[ADT7320_CAN_MAX_SENSORS];  /**< Non-zero once a sensor was transmitted */
+    uint32_t frames;                          /**< Frames transmitted */
+    uint32_t entries;                         /**< Readings transmitted */
+    uint32_t bytes;                           /**< Payload bytes transmitted, padding included */
+} ADT7320_CanTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes a packer.
+ *
+ * @param[out] pCan      Pointer to the packer state.
+ * @param[in]  mode      Frame format.
+ * @param[in]  id        Frame identifier.
+ * @param[in]  deadband  Change below or equal to this is not sent, in LSB (0 sends every change).
+ * @param[in]  refresh   Sweeps between full refreshes (0 = never).
+ * @param[in]  transmit  Transmit function.
+ * @param[in]  pContext  Context passed to transmit (may be NULL).
+ *
+ * @retval ADT7320_OK     Packer ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Can_Init(ADT7320_CanTypeDef *pCan, ADT7320_CanModeTypeDef mode, uint32_t id, uint16_t deadband,
+                                       uint16_t refresh, ADT7320_CanTransmitTypeDef transmit, void *pContext);
+
+/**
+ * @brief  Packs and transmits the readings of one sweep that need to be sent.
+ *
+ * Readings left unsent after a transmit failure are retried on the next sweep; a full
+ * refresh cut short is repeated whole.
+ *
+ * @param[in,out] pCan   Pointer to the packer state.
+ * @param[in]     pRaw   Raw ADT7320_TEMP codes, indexed by sensor.
+ * @param[in]     count  Number of sensors (<= ADT7320_CAN_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Sweep transmitted (possibly no frame at all)
+ * @retval ADT7320_ERROR  Invalid parameters or transmit failure
+ */
+ADT7320_StatusTypeDef ADT7320_Can_Pack(ADT7320_CanTypeDef *pCan, const int16_t *pRaw, uint8_t count);
+
+/**
+ * @brief  Unpacks one received frame into a reading table.
+ *
+ * @param[in]     pData     Payload.
+ * @param[in]     len       Payload length, in bytes.
+ * @param[in,out] pRaw      Raw codes, indexed by sensor; updated entries are overwritten.
+ * @param[in]     count     Size of pRaw (entries with a larger index are skipped).
+ * @param[out]    pSeq      Sequence counter of the frame (may be NULL).
+ * @param[out]    pUpdated  Number of readings written (may be NULL).
+ *
+ * @retval ADT7320_OK     Frame unpacked
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Can_Unpack(const uint8_t *pData, uint8_t len, int16_t *pRaw, uint8_t count,
+                                         uint8_t *pSeq, uint8_t *pUpdated);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_CAN_H */
@@ -0,0 +1,308 @@
+/**
+ * @file    adt7320_cmdframe.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Several ADT7320 register commands in one SPI transfer under a single CS assertion.
+ *
+ * @details
+ * The data size of a command is the distance to the next command byte (or to the end
+ * of the frame), and its direction is the read bit of its command byte, so only the
+ * command offsets are stored.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_cmdframe.h"  /**< Command frame interface */
+#include "adt7320_metrics.h"   /**< Metric recording hooks (no-ops unless ADT7320_METRICS_ENABLE) */
+#include "adt7320_trace.h"     /**< Bus-traffic trace hook (no-op unless ADT7320_TRACE_ENABLE) */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Appends a command byte and reserves its data bytes.
+ *
+ * @param[in,out] pFrame    Pointer to the command frame.
+ * @param[in]     command   Command byte.
+ * @param[in]     dataSize  Number of data bytes (1 or 2).
+ * @param[out]    pIndex    Index of the command (may be NULL).
+ *
+ * @retval ADT7320_OK     Command appended
+ * @retval ADT7320_ERROR  Invalid parameters, frame full or in flight
+ */
+static ADT7320_StatusTypeDef ADT7320_CmdFrame_Add(ADT7320_CmdFrameTypeDef *pFrame, uint8_t command, uint8_t dataSize, uint8_t *pIndex)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t offset = 0U;
+
+    if ( (pFrame == NULL) || (dataSize == 0U) || (dataSize > 2U) || (pFrame->count >= ADT7320_CMDFRAME_MAX_COMMANDS) ||
+         (pFrame->busy != 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        offset = pFrame->length;
+
+        pFrame->offset[pFrame->count] = (uint8_t)offset;
+        pFrame->tx[offset]            = command;
+
+        for (uint8_t i = 1U; i <= dataSize; i++)
+        {
+            pFrame->tx[offset + i] = ADT7320_DUMMY;
+        }
+
+        if (pIndex != NULL)
+        {
+            *pIndex = pFrame->count;
+        }
+
+        pFrame->count++;
+        pFrame->length = (uint16_t)(offset + 1U + dataSize);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Records the outcome of an asynchronous run (async bus callback, CS already released).
+ *
+ * @param[in] pContext  Command frame of the run.
+ * @param[in] status    Outcome of the transfer.
+ * @param[in] data      Unused (raw transfer).
+ */
+static void ADT7320_CmdFrame_Done(void *pContext, ADT7320_StatusTypeDef status, uint16_t data)
+{
+    ADT7320_CmdFrameTypeDef *pFrame = (ADT7320_CmdFrameTypeDef *)pContext;
+
+    (void)data;
+
+    pFrame->status = status;
+    pFrame->busy   = 0U;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes an empty command frame.
+ *
+ * @param[out] pFrame   Pointer to the command frame.
+ * @param[in]  pConfig  Sensor configuration (must outlive the frame).
+ *
+ * @retval ADT7320_OK     Frame ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Init(ADT7320_CmdFrameTypeDef *pFrame, const ADT7320_ConfigTypeDef *pConfig)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pFrame == NULL) || (ADT7320_IsValid(pConfig) == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pFrame->pConfig = pConfig;
+        pFrame->count   = 0U;
+        pFrame->length  = 0U;
+        pFrame->busy    = 0U;
+        pFrame->status  = ADT7320_ERROR;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Appends a register read.
+ *
+ * @param[in,out] pFrame    Pointer to the command frame.
+ * @param[in]     reg       Register address.
+ * @param[in]     dataSize  Number of bytes to read (1 or 2).
+ * @param[out]    pIndex    Index of the command, for ADT7320_CmdFrame_Get() (may be NULL).
+ *
+ * @retval ADT7320_OK     Command appended
+ * @retval ADT7320_ERROR  Invalid parameters or frame full
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_AddRead(ADT7320_CmdFrameTypeDef *pFrame, uint8_t reg, uint8_t dataSize, uint8_t *pIndex)
+{
+    return ADT7320_CmdFrame_Add(pFrame, (uint8_t)(ADT7320_READ | ((reg & 0x1FU) << 3U)), dataSize, pIndex);
+}
+
+/**
+ * @brief  Appends a register write.
+ *
+ * @param[in,out] pFrame    Pointer to the command frame.
+ * @param[in]     reg       Register address.
+ * @param[in]     dataSize  Number of bytes to write (1 or 2).
+ * @param[in]     data      Value to write.
+ * @param[out]    pIndex    Index of the command (may be NULL).
+ *
+ * @retval ADT7320_OK     Command appended
+ * @retval ADT7320_ERROR  Invalid parameters or frame full
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_AddWrite(ADT7320_CmdFrameTypeDef *pFrame, uint8_t reg, uint8_t dataSize, uint16_t data, uint8_t *pIndex)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t offset = 0U;
+
+    if (pFrame == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        offset = pFrame->length;
+        status = ADT7320_CmdFrame_Add(pFrame, (uint8_t)(ADT7320_WRITE | ((reg & 0x1FU) << 3U)), dataSize, pIndex);
+
+        if (status == ADT7320_OK)
+        {
+            for (uint8_t i = 0U; i < dataSize; i++)
+            {
+                pFrame->tx[offset + 1U + i] = (uint8_t)(data >> (8U * (dataSize - 1U - i)));
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Runs the frame with the blocking HAL call.
+ *
+ * @param[in,out] pFrame  Pointer to the command frame.
+ *
+ * @retval ADT7320_OK       Operation successful
+ * @retval ADT7320_ERROR    SPI communication failure or invalid parameters
+ * @retval ADT7320_BUSY     SPI peripheral or frame is busy
+ * @retval ADT7320_TIMEOUT  SPI operation timed out
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Execute(ADT7320_CmdFrameTypeDef *pFrame)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t start = 0U;
+
+    if ( (pFrame == NULL) || (pFrame->count == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if ( (pFrame->busy != 0U) || (HAL_SPI_GetState(pFrame->pConfig->SPIx) != HAL_SPI_STATE_READY) )
+    {
+        /* CS stays high while another transfer holds the SPI */
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        ADT7320_Select(pFrame->pConfig);
+        ADT7320_TRACE_SPI(pFrame->tx, pFrame->length);
+        start  = ADT7320_METRIC_NOW();
+        status = (ADT7320_StatusTypeDef) HAL_SPI_TransmitReceive(pFrame->pConfig->SPIx, pFrame->tx, pFrame->rx, pFrame->length, ADT7320_MAX_DELAY);
+        ADT7320_METRIC_SPI(status, start);
+        ADT7320_Deselect(pFrame->pConfig);
+
+        pFrame->status = status;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts the frame as one operation of an asynchronous bus.
+ *
+ * The run ends when the bus completes, fails, cancels or aborts the operation at its
+ * deadline; ADT7320_CmdFrame_Get() returns ADT7320_BUSY until then and the outcome of
+ * the run afterwards.
+ *
+ * @param[in,out] pFrame      Pointer to the command frame.
+ * @param[in,out] pBus        Asynchronous bus of the sensor SPI.
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ *
+ * @retval ADT7320_OK     Transfer started
+ * @retval ADT7320_BUSY   Frame already in flight, bus owned by another operation or SPI in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Start(ADT7320_CmdFrameTypeDef *pFrame, ADT7320_AsyncBusTypeDef *pBus, uint32_t deadlineMs)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pFrame == NULL) || (pBus == NULL) || (pFrame->count == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (pFrame->busy != 0U)
+    {
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        pFrame->busy   = 1U;
+        pFrame->status = ADT7320_BUSY;
+
+        status = ADT7320_Async_Transfer(pBus, pFrame->pConfig, pFrame->tx, pFrame->rx, pFrame->length, deadlineMs,
+                                        ADT7320_CmdFrame_Done, pFrame);
+
+        if (status != ADT7320_OK)
+        {
+            pFrame->status = status;
+            pFrame->busy   = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Returns the value read by a command during the last run.
+ *
+ * @param[in]  pFrame  Pointer to the command frame.
+ * @param[in]  index   Index given by ADT7320_CmdFrame_AddRead().
+ * @param[out] pData   Register value.
+ *
+ * @retval ADT7320_OK     Value returned
+ * @retval ADT7320_BUSY   Frame still in flight
+ * @retval ADT7320_ERROR  Invalid parameters, not a read, or the last run failed
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Get(const ADT7320_CmdFrameTypeDef *pFrame, uint8_t index, uint16_t *pData)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t offset = 0U;
+    uint16_t end    = 0U;
+    uint16_t data   = 0U;
+
+    if ( (pFrame == NULL) || (pData == NULL) || (index >= pFrame->count) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (pFrame->busy != 0U)
+    {
+        status = ADT7320_BUSY;
+    }
+    else if ( (pFrame->status != ADT7320_OK) || ((pFrame->tx[pFrame->offset[index]] & ADT7320_READ) == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        offset = pFrame->offset[index];
+        end    = ((index + 1U) < pFrame->count) ? pFrame->offset[index + 1U] : pFrame->length;
+
+        for (uint16_t i = (uint16_t)(offset + 1U); i < end; i++)
+        {
+            data = (uint16_t)((data << 8U) | pFrame->rx[i]);
+        }
+
+        *pData = data;
+    }
+
+    return status;
+}
+
+
+/* adt7320_cmdframe.c */
@@ -0,0 +1,186 @@
+/**
+ * @file    adt7320_cmdframe.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Several ADT7320 register commands in one SPI transfer under a single CS assertion.
+ *
+ * @details
+ * The ADT7320 accepts a new command byte right after the data bytes of the previous
+ * one while CS stays low. A command frame concatenates reads and writes into one
+ * transmit buffer, sends it in one HAL transfer (blocking, IT or DMA) between a single
+ * CS assertion and release, then returns the value of each read from the receive
+ * buffer:
+ *
+ * | Offset | Byte sent            | Byte received         |
+ * |-------:|----------------------|-----------------------|
+ * | 0      | Read STATUS command  | -                     |
+ * | 1      | 0x00                 | STATUS                |
+ * | 2      | Read TEMP command    | -                     |
+ * | 3..4   | 0x00 0x00            | TEMP (MSB first)      |
+ * | 5      | Read CONFIG command  | -                     |
+ * | 6      | 0x00                 | CONFIG                |
+ *
+ * A frame is built once and can be run any number of times, e.g. for a periodic
+ * diagnostic or alarm check:
+ * @code
+ * ADT7320_CmdFrame_Init(&diag, &sensor);
+ * ADT7320_CmdFrame_AddRead(&diag, ADT7320_STATUS, 1U, &iStatus);
+ * ADT7320_CmdFrame_AddRead(&diag, ADT7320_TEMP,   2U, &iTemp);
+ * ADT7320_CmdFrame_AddRead(&diag, ADT7320_CONFIG, 1U, &iConfig);
+ * ADT7320_CmdFrame_Execute(&diag);
+ * ADT7320_CmdFrame_Get(&diag, iTemp, &raw);
+ * @endcode
+ *
+ * IT/DMA runs go through an asynchronous bus (adt7320_async.h), so they share its bus
+ * ownership with the other operations of the SPI, its deadline and its abort path;
+ * the application forwards the HAL callbacks and polls that bus as usual.
+ *
+ * @note On cores with a data cache (F7/H7) the transmit and receive buffers are
+ *       32-byte aligned and padded to whole cache lines, as ADT7320_Async_Transfer()
+ *       requires for DMA.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_CMDFRAME_H
+#define ADT7320_CMDFRAME_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"        /**< ADT7320 driver interface and configuration */
+#include "adt7320_async.h"  /**< Asynchronous bus (IT/DMA) */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/* Command offsets are stored in 8 bits: 3 bytes per command must fit in 255 */
+#if (ADT7320_CMDFRAME_MAX_COMMANDS < 1U) || (ADT7320_CMDFRAME_MAX_COMMANDS > 85U)
+    #error "ADT7320_CMDFRAME_MAX_COMMANDS must be between 1 and 85"
+#endif
+
+/** @brief Transmit and receive buffer size: whole cache lines on cores with a data cache */
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    #define  ADT7320_CMDFRAME_BUF_SIZE  ADT7320_ASYNC_CACHE_SIZE(3U * ADT7320_CMDFRAME_MAX_COMMANDS)
+#else
+    #define  ADT7320_CMDFRAME_BUF_SIZE  (3U * ADT7320_CMDFRAME_MAX_COMMANDS)
+#endif
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Command frame of one sensor.
+ */
+typedef struct
+{
+    const ADT7320_ConfigTypeDef *pConfig;             /**< Sensor of the frame */
+    ADT7320_ASYNC_BUF_ALIGN uint8_t tx[ADT7320_CMDFRAME_BUF_SIZE];  /**< Commands and write data */
+    ADT7320_ASYNC_BUF_ALIGN uint8_t rx[ADT7320_CMDFRAME_BUF_SIZE];  /**< Bytes received during the last run */
+    uint8_t  offset[ADT7320_CMDFRAME_MAX_COMMANDS];   /**< Position of each command byte */
+    uint8_t  count;                                   /**< Commands in the frame */
+    uint16_t length;                                  /**< Bytes in the frame */
+    volatile uint8_t busy;                            /**< Non-zero while an asynchronous run is in flight */
+    volatile ADT7320_StatusTypeDef status;            /**< Result of the last run */
+} ADT7320_CmdFrameTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes an empty command frame.
+ *
+ * @param[out] pFrame   Pointer to the command frame.
+ * @param[in]  pConfig  Sensor configuration (must outlive the frame).
+ *
+ * @retval ADT7320_OK     Frame ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Init(ADT7320_CmdFrameTypeDef *pFrame, const ADT7320_ConfigTypeDef *pConfig);
+
+/**
+ * @brief  Appends a register read.
+ *
+ * @param[in,out] pFrame    Pointer to the command frame.
+ * @param[in]     reg       Register address.
+ * @param[in]     dataSize  Number of bytes to read (1 or 2).
+ * @param[out]    pIndex    Index of the command, for ADT7320_CmdFrame_Get() (may be NULL).
+ *
+ * @retval ADT7320_OK     Command appended
+ * @retval ADT7320_ERROR  Invalid parameters or frame full
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_AddRead(ADT7320_CmdFrameTypeDef *pFrame, uint8_t reg, uint8_t dataSize, uint8_t *pIndex);
+
+/**
+ * @brief  Appends a register write.
+ *
+ * @param[in,out] pFrame    Pointer to the command frame.
+ * @param[in]     reg       Register address.
+ * @param[in]     dataSize  Number of bytes to write (1 or 2).
+ * @param[in]     data      Value to write.
+ * @param[out]    pIndex    Index of the command (may be NULL).
+ *
+ * @retval ADT7320_OK     Command appended
+ * @retval ADT7320_ERROR  Invalid parameters or frame full
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_AddWrite(ADT7320_CmdFrameTypeDef *pFrame, uint8_t reg, uint8_t dataSize, uint16_t data, uint8_t *pIndex);
+
+/**
+ * @brief  Runs the frame with the blocking HAL call.
+ *
+ * @param[in,out] pFrame  Pointer to the command frame.
+ *
+ * @retval ADT7320_OK       Operation successful
+ * @retval ADT7320_ERROR    SPI communication failure or invalid parameters
+ * @retval ADT7320_BUSY     SPI peripheral or frame is busy
+ * @retval ADT7320_TIMEOUT  SPI operation timed out
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Execute(ADT7320_CmdFrameTypeDef *pFrame);
+
+/**
+ * @brief  Starts the frame as one operation of an asynchronous bus.
+ *
+ * The run ends when the bus completes, fails, cancels or aborts the operation at its
+ * deadline; ADT7320_CmdFrame_Get() returns ADT7320_BUSY until then and the outcome of
+ * the run afterwards.
+ *
+ * @param[in,out] pFrame      Pointer to the command frame.
+ * @param[in,out] pBus        Asynchronous bus of the sensor SPI.
+ * @param[in]     deadlineMs  Allowed duration, in ms (0 = no deadline).
+ *
+ * @retval ADT7320_OK     Transfer started
+ * @retval ADT7320_BUSY   Frame already in flight, bus owned by another operation or SPI in use
+ * @retval ADT7320_ERROR  Invalid parameters or transfer could not start
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Start(ADT7320_CmdFrameTypeDef *pFrame, ADT7320_AsyncBusTypeDef *pBus, uint32_t deadlineMs);
+
+/**
+ * @brief  Returns the value read by a command during the last run.
+ *
+ * @param[in]  pFrame  Pointer to the command frame.
+ * @param[in]  index   Index given by ADT7320_CmdFrame_AddRead().
+ * @param[out] pData   Register value.
+ *
+ * @retval ADT7320_OK     Value returned
+ * @retval ADT7320_BUSY   Frame still in flight
+ * @retval ADT7320_ERROR  Invalid parameters, not a read, or the last run failed
+ */
+ADT7320_StatusTypeDef ADT7320_CmdFrame_Get(const ADT7320_CmdFrameTypeDef *pFrame, uint8_t index, uint16_t *pData);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_CMDFRAME_H */
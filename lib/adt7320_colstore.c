@@ -0,0 +1,546 @@
+/**
+ * @file    adt7320_colstore.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Append-only columnar segments for ADT7320 readings, queried in place.
+ *
+ * @details
+ * The segment length is known before encoding (count and bit widths fix it), so the
+ * encoder streams the segment through a small staging buffer and never holds it whole.
+ * The staging buffer is a multiple of ADT7320_COLSTORE_WRITE_ALIGN and so is the
+ * padded segment, so every write call starts and ends on a program unit boundary.
+ *
+ * Segments are read in place from flash that may be corrupt or partly written, so the
+ * query checks the bit widths and the sample count against the segment length before
+ * decoding anything.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_colstore.h"  /**< Columnar store interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+#if (ADT7320_COLSTORE_SEGMENT_SAMPLES < 2U) || (ADT7320_COLSTORE_SEGMENT_SAMPLES > 8192U)
+    #error "ADT7320_COLSTORE_SEGMENT_SAMPLES must be between 2 and 8192"
+#endif
+
+/** @brief Longest segment: widest tick deltas and values, largest padding */
+#define  ADT7320_COLSTORE_LENGTH_MAX  (ADT7320_COLSTORE_HEADER + ADT7320_COLSTORE_FOOTER + (ADT7320_COLSTORE_WRITE_ALIGN - 1U) + \
+                                       ((((ADT7320_COLSTORE_SEGMENT_SAMPLES - 1U) * 32U) + (ADT7320_COLSTORE_SEGMENT_SAMPLES * 16U) + 7U) / 8U))
+
+#if (ADT7320_COLSTORE_LENGTH_MAX > 0xFFFFU)
+    #error "ADT7320_COLSTORE_SEGMENT_SAMPLES too large for the 16-bit segment length and count fields"
+#endif
+
+#if (ADT7320_COLSTORE_WRITE_ALIGN < 1U) || (ADT7320_COLSTORE_WRITE_ALIGN > 128U) || \
+    ((ADT7320_COLSTORE_WRITE_ALIGN & (ADT7320_COLSTORE_WRITE_ALIGN - 1U)) != 0U)
+    #error "ADT7320_COLSTORE_WRITE_ALIGN must be a power of 2 between 1 and 128"
+#endif
+
+/** @brief Bytes staged before each call of the write function (a multiple of the program unit) */
+#if (ADT7320_COLSTORE_WRITE_ALIGN > 32U)
+    #define  ADT7320_COLSTORE_CHUNK  ADT7320_COLSTORE_WRITE_ALIGN
+#else
+    #define  ADT7320_COLSTORE_CHUNK  (32U)
+#endif
+
+/** @brief Widest fields a segment may declare */
+#define  ADT7320_COLSTORE_TICK_BITS_MAX   (32U)
+#define  ADT7320_COLSTORE_VALUE_BITS_MAX  (16U)
+
+
+/* --------------------------------- Private Types ---------------------------------- */
+
+/**
+ * @brief Streaming bit writer.
+ */
+typedef struct
+{
+    uint8_t  buf[ADT7320_COLSTORE_CHUNK];  /**< Staged bytes */
+    uint8_t  len;                          /**< Staged byte count */
+    uint32_t acc;                          /**< Pending bits, LSB first */
+    uint8_t  accBits;                      /**< Number of pending bits */
+    ADT7320_ColumnTypeDef *pCol;           /**< Column being sealed */
+    ADT7320_StatusTypeDef status;          /**< First write failure */
+} ADT7320_ColStoreWriterTypeDef;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Returns the number of bits needed to hold a value.
+ *
+ * @param[in] value  Value.
+ *
+ * @return Bit count (0 for 0).
+ */
+static uint8_t ADT7320_ColStore_Width(uint32_t value)
+{
+    uint8_t bits = 0U;
+
+    while (value != 0U)
+    {
+        bits++;
+        value >>= 1U;
+    }
+
+    return bits;
+}
+
+/**
+ * @brief  Hands the staged bytes to the write function.
+ *
+ * @param[in,out] pW  Bit writer.
+ */
+static void ADT7320_ColStore_Flush(ADT7320_ColStoreWriterTypeDef *pW)
+{
+    if ( (pW->len > 0U) && (pW->status == ADT7320_OK) )
+    {
+        pW->status = pW->pCol->write(pW->pCol->pContext, pW->buf, pW->len);
+    }
+    pW->len = 0U;
+}
+
+/**
+ * @brief  Stages one byte.
+ *
+ * @param[in,out] pW    Bit writer.
+ * @param[in]     byte  Byte to append.
+ */
+static void ADT7320_ColStore_PutByte(ADT7320_ColStoreWriterTypeDef *pW, uint8_t byte)
+{
+    pW->buf[pW->len] = byte;
+    pW->len++;
+
+    if (pW->len == ADT7320_COLSTORE_CHUNK)
+    {
+        ADT7320_ColStore_Flush(pW);
+    }
+}
+
+/**
+ * @brief  Appends a little-endian field.
+ *
+ * @param[in,out] pW     Bit writer (byte aligned).
+ * @param[in]     value  Field value.
+ * @param[in]     size   Field size, in bytes.
+ */
+static void ADT7320_ColStore_PutField(ADT7320_ColStoreWriterTypeDef *pW, uint32_t value, uint8_t size)
+{
+    for (uint8_t i = 0U; i < size; i++)
+    {
+        ADT7320_ColStore_PutByte(pW, (uint8_t)(value >> (8U * i)));
+    }
+}
+
+/**
+ * @brief  Appends a bit-packed value.
+ *
+ * @param[in,out] pW     Bit writer.
+ * @param[in]     value  Value (only the low width bits are kept).
+ * @param[in]     width  Number of bits (0 to 32).
+ */
+static void ADT7320_ColStore_PutBits(ADT7320_ColStoreWriterTypeDef *pW, uint32_t value, uint8_t width)
+{
+    for (uint8_t i = 0U; i < width; i++)
+    {
+        pW->acc |= ((value >> i) & 1U) << pW->accBits;
+        pW->accBits++;
+
+        if (pW->accBits == 8U)
+        {
+            ADT7320_ColStore_PutByte(pW, (uint8_t)pW->acc);
+            pW->acc     = 0U;
+            pW->accBits = 0U;
+        }
+    }
+}
+
+/**
+ * @brief  Reads a little-endian field.
+ *
+ * @param[in] p     Field address.
+ * @param[in] size  Field size, in bytes.
+ *
+ * @return Field value.
+ */
+static uint32_t ADT7320_ColStore_GetField(const uint8_t *p, uint8_t size)
+{
+    uint32_t value = 0U;
+
+    for (uint8_t i = 0U; i < size; i++)
+    {
+        value |= (uint32_t)p[i] << (8U * i);
+    }
+
+    return value;
+}
+
+/**
+ * @brief  Reads a bit-packed value.
+ *
+ * @param[in]     p       Start of the bit stream.
+ * @param[in,out] pBitPos Bit position, advanced past the value.
+ * @param[in]     width   Number of bits (0 to 32).
+ *
+ * @return Value.
+ */
+static uint32_t ADT7320_ColStore_GetBits(const uint8_t *p, uint32_t *pBitPos, uint8_t width)
+{
+    uint32_t value = 0U;
+    uint32_t pos   = *pBitPos;
+
+    for (uint8_t i = 0U; i < width; i++)
+    {
+        value |= (uint32_t)((p[pos >> 3U] >> (pos & 7U)) & 1U) << i;
+        pos++;
+    }
+
+    *pBitPos = pos;
+
+    return value;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes an empty column.
+ *
+ * @param[out] pCol      Pointer to the column.
+ * @param[in]  sensor    Sensor index written to its segments.
+ * @param[in]  write     Segment output.
+ * @param[in]  pContext  Context passed to write (may be NULL).
+ *
+ * @retval ADT7320_OK     Column ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Init(ADT7320_ColumnTypeDef *pCol, uint8_t sensor, ADT7320_ColStoreWriteTypeDef write, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pCol == NULL) || (write == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pCol->count    = 0U;
+        pCol->sensor   = sensor;
+        pCol->write    = write;
+        pCol->pContext = pContext;
+        pCol->segments = 0U;
+        pCol->bytes    = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Appends a sample, sealing the segment when the column is full.
+ *
+ * A tick lower than the previous sample's (HAL_GetTick() wrapped) seals the segment
+ * first, so every segment covers one increasing tick range.
+ *
+ * @param[in,out] pCol  Pointer to the column.
+ * @param[in]     tick  Sample tick, in ms.
+ * @param[in]     raw   Raw ADT7320_TEMP code.
+ *
+ * @retval ADT7320_OK     Sample stored
+ * @retval ADT7320_ERROR  Invalid parameters, or the segment could not be written (sample dropped)
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Append(ADT7320_ColumnTypeDef *pCol, uint32_t tick, int16_t raw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pCol == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        if ( (pCol->count == ADT7320_COLSTORE_SEGMENT_SAMPLES) ||
+             ((pCol->count > 0U) && (tick < pCol->tick[pCol->count - 1U])) )
+        {
+            status = ADT7320_ColStore_Seal(pCol);
+        }
+
+        if (status == ADT7320_OK)
+        {
+            pCol->tick[pCol->count] = tick;
+            pCol->raw[pCol->count]  = raw;
+            pCol->count++;
+
+            if (pCol->count == ADT7320_COLSTORE_SEGMENT_SAMPLES)
+            {
+                /* A failed seal is retried by the next append */
+                (void)ADT7320_ColStore_Seal(pCol);
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Appends the valid readings of a sweep frame, one column per frame slot.
+ *
+ * @param[in,out] pCols   Columns, indexed like the frame.
+ * @param[in]     count   Number of columns.
+ * @param[in]     pFrame  Published frame.
+ *
+ * @retval ADT7320_OK     Readings stored
+ * @retval ADT7320_ERROR  Invalid parameters or a segment could not be written
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_AppendFrame(ADT7320_ColumnTypeDef *pCols, uint8_t count, const ADT7320_FrameTypeDef *pFrame)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pCols == NULL) || (pFrame == NULL) || (count > pFrame->count) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint8_t s = 0U; s < count; s++)
+        {
+            if ( (pFrame->status[s] == (uint8_t)ADT7320_OK) &&
+                 (ADT7320_ColStore_Append(&pCols[s], pFrame->tick, pFrame->raw[s]) != ADT7320_OK) )
+            {
+                status = ADT7320_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Encodes the collected samples as a segment and empties the column.
+ *
+ * @param[in,out] pCol  Pointer to the column.
+ *
+ * @retval ADT7320_OK     Segment written (or column empty)
+ * @retval ADT7320_ERROR  Invalid parameters or write failure (samples kept)
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Seal(ADT7320_ColumnTypeDef *pCol)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_ColStoreWriterTypeDef w;
+    int16_t  min      = 0;
+    int16_t  max      = 0;
+    uint32_t maxDelta = 0U;
+    uint8_t  tBits    = 0U;
+    uint8_t  vBits    = 0U;
+    uint32_t length   = 0U;
+    uint32_t padding  = 0U;
+
+    if (pCol == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (pCol->count > 0U)
+    {
+        min = pCol->raw[0U];
+        max = pCol->raw[0U];
+
+        for (uint16_t i = 1U; i < pCol->count; i++)
+        {
+            if ((pCol->tick[i] - pCol->tick[i - 1U]) > maxDelta)
+            {
+                maxDelta = pCol->tick[i] - pCol->tick[i - 1U];
+            }
+            if (pCol->raw[i] < min)
+            {
+                min = pCol->raw[i];
+            }
+            if (pCol->raw[i] > max)
+            {
+                max = pCol->raw[i];
+            }
+        }
+
+        tBits  = ADT7320_ColStore_Width(maxDelta);
+        vBits  = ADT7320_ColStore_Width((uint32_t)((int32_t)max - (int32_t)min));
+        length = ADT7320_COLSTORE_HEADER + ADT7320_COLSTORE_FOOTER +
+                 (((uint32_t)(pCol->count - 1U) * tBits) + ((uint32_t)pCol->count * vBits) + 7U) / 8U;
+        padding = (ADT7320_COLSTORE_WRITE_ALIGN - (length % ADT7320_COLSTORE_WRITE_ALIGN)) % ADT7320_COLSTORE_WRITE_ALIGN;
+        length += padding;
+
+        w.len     = 0U;
+        w.acc     = 0U;
+        w.accBits = 0U;
+        w.pCol    = pCol;
+        w.status  = ADT7320_OK;
+
+        ADT7320_ColStore_PutField(&w, ADT7320_COLSTORE_MAGIC, 2U);
+        ADT7320_ColStore_PutField(&w, length, 2U);
+        ADT7320_ColStore_PutField(&w, pCol->sensor, 1U);
+        ADT7320_ColStore_PutField(&w, tBits, 1U);
+        ADT7320_ColStore_PutField(&w, vBits, 1U);
+        ADT7320_ColStore_PutField(&w, 0U, 1U);
+        ADT7320_ColStore_PutField(&w, pCol->count, 2U);
+
+        for (uint16_t i = 1U; i < pCol->count; i++)
+        {
+            ADT7320_ColStore_PutBits(&w, pCol->tick[i] - pCol->tick[i - 1U], tBits);
+        }
+        for (uint16_t i = 0U; i < pCol->count; i++)
+        {
+            ADT7320_ColStore_PutBits(&w, (uint32_t)((int32_t)pCol->raw[i] - (int32_t)min), vBits);
+        }
+        if (w.accBits > 0U)
+        {
+            ADT7320_ColStore_PutBits(&w, 0U, (uint8_t)(8U - w.accBits));
+        }
+        for (uint32_t i = 0U; i < padding; i++)
+        {
+            ADT7320_ColStore_PutByte(&w, 0U);
+        }
+
+        ADT7320_ColStore_PutField(&w, pCol->tick[0U], 4U);
+        ADT7320_ColStore_PutField(&w, pCol->tick[pCol->count - 1U], 4U);
+        ADT7320_ColStore_PutField(&w, (uint16_t)min, 2U);
+        ADT7320_ColStore_PutField(&w, (uint16_t)max, 2U);
+        ADT7320_ColStore_Flush(&w);
+
+        status = w.status;
+
+        if (status == ADT7320_OK)
+        {
+            pCol->segments++;
+            pCol->bytes += length;
+            pCol->count  = 0U;
+        }
+        else
+        {
+            status = ADT7320_ERROR;
+        }
+    }
+    else
+    {
+        /* Nothing to seal */
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Visits the stored samples of a sensor within a tick and value range.
+ *
+ * @param[in]     pBase     Start of the stored segments.
+ * @param[in]     size      Bytes available from pBase (walking stops at the first non-segment).
+ * @param[in,out] pQuery    Query; its result counters are updated.
+ * @param[in]     visit     Visit function.
+ * @param[in]     pContext  Context passed to visit (may be NULL).
+ *
+ * @retval ADT7320_OK     Query done
+ * @retval ADT7320_ERROR  Invalid parameters or corrupt segment
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Query(const uint8_t *pBase, uint32_t size, ADT7320_ColStoreQueryTypeDef *pQuery,
+                                             ADT7320_ColStoreVisitTypeDef visit, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    const uint8_t *pSeg    = NULL;
+    const uint8_t *pFooter = NULL;
+    uint32_t offset = 0U;
+    uint32_t length = 0U;
+    uint32_t count  = 0U;
+    uint32_t tPos   = 0U;
+    uint32_t bitPos = 0U;
+    uint32_t tick   = 0U;
+    uint8_t  tBits  = 0U;
+    uint8_t  vBits  = 0U;
+    int16_t  min    = 0;
+    int16_t  raw    = 0;
+    uint8_t  done   = 0U;
+
+    if ( (pBase == NULL) || (pQuery == NULL) || (visit == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pQuery->matched        = 0U;
+        pQuery->segmentsRead   = 0U;
+        pQuery->segmentsPruned = 0U;
+
+        while ( (done == 0U) && ((offset + ADT7320_COLSTORE_HEADER + ADT7320_COLSTORE_FOOTER) <= size) )
+        {
+            pSeg   = &pBase[offset];
+            length = ADT7320_ColStore_GetField(&pSeg[2U], 2U);
+            count  = ADT7320_ColStore_GetField(&pSeg[8U], 2U);
+
+            if (ADT7320_ColStore_GetField(pSeg, 2U) != ADT7320_COLSTORE_MAGIC)
+            {
+                /* End of the stored segments (e.g. erased flash) */
+                done = 1U;
+            }
+            else if ( (length < (ADT7320_COLSTORE_HEADER + ADT7320_COLSTORE_FOOTER)) || ((offset + length) > size) || (count == 0U) ||
+                      (pSeg[5U] > ADT7320_COLSTORE_TICK_BITS_MAX) || (pSeg[6U] > ADT7320_COLSTORE_VALUE_BITS_MAX) ||
+                      ((((count - 1U) * pSeg[5U]) + (count * pSeg[6U])) > (8U * (length - ADT7320_COLSTORE_HEADER - ADT7320_COLSTORE_FOOTER))) )
+            {
+                /* Header inconsistent with its own length: decoding would read past the segment */
+                status = ADT7320_ERROR;
+                done   = 1U;
+            }
+            else if (pSeg[4U] == pQuery->sensor)
+            {
+                pFooter = &pSeg[length - ADT7320_COLSTORE_FOOTER];
+                min     = (int16_t)ADT7320_ColStore_GetField(&pFooter[8U], 2U);
+
+                if ( (ADT7320_ColStore_GetField(&pFooter[0U], 4U) > pQuery->toTick) ||
+                     (ADT7320_ColStore_GetField(&pFooter[4U], 4U) < pQuery->fromTick) ||
+                     (min > pQuery->rawMax) || ((int16_t)ADT7320_ColStore_GetField(&pFooter[10U], 2U) < pQuery->rawMin) )
+                {
+                    pQuery->segmentsPruned++;
+                }
+                else
+                {
+                    pQuery->segmentsRead++;
+                    tBits  = pSeg[5U];
+                    vBits  = pSeg[6U];
+                    tPos   = 0U;
+                    bitPos = (count - 1U) * tBits;
+                    tick   = ADT7320_ColStore_GetField(&pFooter[0U], 4U);
+
+                    for (uint32_t i = 0U; i < count; i++)
+                    {
+                        if (i > 0U)
+                        {
+                            tick += ADT7320_ColStore_GetBits(&pSeg[ADT7320_COLSTORE_HEADER], &tPos, tBits);
+                        }
+                        raw = (int16_t)((int32_t)min + (int32_t)ADT7320_ColStore_GetBits(&pSeg[ADT7320_COLSTORE_HEADER], &bitPos, vBits));
+
+                        if ( (tick >= pQuery->fromTick) && (tick <= pQuery->toTick) &&
+                             (raw >= pQuery->rawMin) && (raw <= pQuery->rawMax) )
+                        {
+                            pQuery->matched++;
+                            visit(pContext, tick, raw);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                /* Segment of another sensor */
+            }
+
+            offset += length;
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_colstore.c */
@@ -0,0 +1,203 @@
+/**
+ * @file    adt7320_colstore.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Append-only columnar segments for ADT7320 readings, queried in place.
+ *
+ * @details
+ * Each sensor has a column that collects (tick, raw) samples in RAM. When the column
+ * holds ADT7320_COLSTORE_SEGMENT_SAMPLES samples (or on ADT7320_ColStore_Seal()) it is
+ * encoded as one sealed segment and streamed to a write function, typically
+ * appending to a flash region. Segments are padded to a multiple of
+ * ADT7320_COLSTORE_WRITE_ALIGN and every write call covers whole program units, so
+ * on parts whose flash words can only be programmed once (STM32L4/G4/H7/U5) the next
+ * segment never shares a word with the previous one (the region must start on a
+ * program unit boundary):
+ *
+ * | Offset | Size | Field                                                   |
+ * |-------:|-----:|---------------------------------------------------------|
+ * | 0      | 2    | Magic 0x5343 ("CS")                                     |
+ * | 2      | 2    | Segment length in bytes, padding and footer included    |
+ * | 4      | 1    | Sensor index                                            |
+ * | 5      | 1    | Bits per tick delta                                     |
+ * | 6      | 1    | Bits per value                                          |
+ * | 7      | 1    | Reserved (0)                                            |
+ * | 8      | 2    | Sample count                                            |
+ * | 10     | n    | count-1 tick deltas, then count (raw - min) values,     |
+ * |        |      | bit-packed LSB first, padded to a byte                  |
+ * | ...    | p    | Zeros up to a multiple of ADT7320_COLSTORE_WRITE_ALIGN  |
+ * | end-12 | 12   | Footer: first tick, last tick (u32), min, max raw (i16) |
+ *
+ * All fields are little endian. Deltas and values use the fewest bits that hold the
+ * largest one in the segment, so a steady temperature sampled at a fixed period packs
+ * in a few bits per sample.
+ *
+ * ADT7320_ColStore_Query() walks sealed segments directly where they are stored (the
+ * internal flash of an STM32 is memory-mapped), skips segments whose footer excludes
+ * the query range, and decodes the others sample by sample into a visit function,
+ * without copying them.
+ *
+ * Ticks are HAL_GetTick() values. When the tick wraps (every 49.7 days), the open
+ * segment is sealed and the next one starts from the wrapped tick, so a segment never
+ * spans the wrap; a tick range query then matches samples from every lap of the counter.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_COLSTORE_H
+#define ADT7320_COLSTORE_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"         /**< ADT7320 driver interface and configuration */
+#include "adt7320_frames.h"  /**< Sweep frames */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Segment magic number */
+#define  ADT7320_COLSTORE_MAGIC   (0x5343U)
+
+/** @brief Segment header and footer sizes, in bytes */
+#define  ADT7320_COLSTORE_HEADER  (10U)
+#define  ADT7320_COLSTORE_FOOTER  (12U)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Segment output.
+ *
+ * Called several times per segment with consecutive pieces of it.
+ *
+ * @param pContext  Context given at init.
+ * @param pData     Bytes to append.
+ * @param len       Number of bytes.
+ *
+ * @return ADT7320_OK if the bytes were stored.
+ */
+typedef ADT7320_StatusTypeDef (*ADT7320_ColStoreWriteTypeDef)(void *pContext, const uint8_t *pData, uint16_t len);
+
+/**
+ * @brief Open column of one sensor.
+ */
+typedef struct
+{
+    uint32_t tick[ADT7320_COLSTORE_SEGMENT_SAMPLES];  /**< Sample ticks, in ms */
+    int16_t  raw[ADT7320_COLSTORE_SEGMENT_SAMPLES];   /**< Raw ADT7320_TEMP codes */
+    uint16_t count;                                   /**< Samples collected */
+    uint8_t  sensor;                                  /**< Sensor index written to segments */
+    ADT7320_ColStoreWriteTypeDef write;               /**< Segment output */
+    void    *pContext;                                /**< Context passed to write */
+    uint32_t segments;                                /**< Segments sealed */
+    uint32_t bytes;                                   /**< Segment bytes written */
+} ADT7320_ColumnTypeDef;
+
+/**
+ * @brief Range query and its result counters.
+ */
+typedef struct
+{
+    uint8_t  sensor;          /**< Sensor index */
+    uint32_t fromTick;        /**< First tick of the range */
+    uint32_t toTick;          /**< Last tick of the range */
+    int16_t  rawMin;          /**< Lowest raw value of interest */
+    int16_t  rawMax;          /**< Highest raw value of interest */
+    uint32_t matched;         /**< Out: samples visited */
+    uint16_t segmentsRead;    /**< Out: segments decoded */
+    uint16_t segmentsPruned;  /**< Out: segments of the sensor skipped by their footer */
+} ADT7320_ColStoreQueryTypeDef;
+
+/**
+ * @brief Visit function of a query.
+ *
+ * @param pContext  Context given to the query.
+ * @param tick      Sample tick, in ms.
+ * @param raw       Raw ADT7320_TEMP code.
+ */
+typedef void (*ADT7320_ColStoreVisitTypeDef)(void *pContext, uint32_t tick, int16_t raw);
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes an empty column.
+ *
+ * @param[out] pCol      Pointer to the column.
+ * @param[in]  sensor    Sensor index written to its segments.
+ * @param[in]  write     Segment output.
+ * @param[in]  pContext  Context passed to write (may be NULL).
+ *
+ * @retval ADT7320_OK     Column ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Init(ADT7320_ColumnTypeDef *pCol, uint8_t sensor, ADT7320_ColStoreWriteTypeDef write, void *pContext);
+
+/**
+ * @brief  Appends a sample, sealing the segment when the column is full.
+ *
+ * @param[in,out] pCol  Pointer to the column.
+ * @param[in]     tick  Sample tick, in ms (lower than the previous one seals the segment first).
+ * @param[in]     raw   Raw ADT7320_TEMP code.
+ *
+ * @retval ADT7320_OK     Sample stored
+ * @retval ADT7320_ERROR  Invalid parameters, or the segment could not be written (sample dropped)
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Append(ADT7320_ColumnTypeDef *pCol, uint32_t tick, int16_t raw);
+
+/**
+ * @brief  Appends the valid readings of a sweep frame, one column per frame slot.
+ *
+ * @param[in,out] pCols   Columns, indexed like the frame.
+ * @param[in]     count   Number of columns.
+ * @param[in]     pFrame  Published frame.
+ *
+ * @retval ADT7320_OK     Readings stored
+ * @retval ADT7320_ERROR  Invalid parameters or a segment could not be written
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_AppendFrame(ADT7320_ColumnTypeDef *pCols, uint8_t count, const ADT7320_FrameTypeDef *pFrame);
+
+/**
+ * @brief  Encodes the collected samples as a segment and empties the column.
+ *
+ * @param[in,out] pCol  Pointer to the column.
+ *
+ * @retval ADT7320_OK     Segment written (or column empty)
+ * @retval ADT7320_ERROR  Invalid parameters or write failure (samples kept)
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Seal(ADT7320_ColumnTypeDef *pCol);
+
+/**
+ * @brief  Visits the stored samples of a sensor within a tick and value range.
+ *
+ * @param[in]     pBase     Start of the stored segments.
+ * @param[in]     size      Bytes available from pBase (walking stops at the first non-segment).
+ * @param[in,out] pQuery    Query; its result counters are updated.
+ * @param[in]     visit     Visit function.
+ * @param[in]     pContext  Context passed to visit (may be NULL).
+ *
+ * @retval ADT7320_OK     Query done
+ * @retval ADT7320_ERROR  Invalid parameters or corrupt segment (bit widths or sample count
+ *                        inconsistent with the segment length)
+ */
+ADT7320_StatusTypeDef ADT7320_ColStore_Query(const uint8_t *pBase, uint32_t size, ADT7320_ColStoreQueryTypeDef *pQuery,
+                                             ADT7320_ColStoreVisitTypeDef visit, void *pContext);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_COLSTORE_H */
@@ -42,11 +42,236 @@
  *   _STM32G0, _STM32G4, _STM32H7,
  *   _STM32L0, _STM32L1, _STM32L4, _STM32L5,
  *   _STM32U0, _STM32U5
+ *
+ * A series given on the compiler command line (e.g. -D_STM32H7) takes precedence.
  */
 
-#define  _STM32F1
-    
-   
+#if !defined (_STM32F0) && !defined (_STM32F1) && !defined (_STM32F2) && !defined (_STM32F3) && \
+    !defined (_STM32F4) && !defined (_STM32F7) && !defined (_STM32G0) && !defined (_STM32G4) && \
+    !defined (_STM32H7) && !defined (_STM32L0) && !defined (_STM32L1) && !defined (_STM32L4) && \
+    !defined (_STM32L5) && !defined (_STM32U0) && !defined (_STM32U5)
+    #define  _STM32F1
+#endif
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                               Thermal Map (OPTIONAL)                                   */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Dimensions of the interpolated thermal map used by adt7320_thermalmap.c.
+ *
+ * Every cell keeps a 32-bit accumulator and every (cell, neighbour) pair keeps a
+ * 4-byte weight entry, so the RAM footprint is roughly
+ * WIDTH * HEIGHT * (4 + 4 * NEIGHBOURS) bytes.
+ */
+#define  ADT7320_MAP_WIDTH           (16U)  ///< Number of map columns
+#define  ADT7320_MAP_HEIGHT          (16U)  ///< Number of map rows
+#define  ADT7320_MAP_MAX_SENSORS     (16U)  ///< Maximum number of sensors placed on the map
+#define  ADT7320_MAP_NEIGHBOURS      (4U)   ///< Sensors blended into each cell (nearest first)
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                           STM32H7 Dual-Core Transport (OPTIONAL)                       */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Settings of the CM4 -> CM7 sample ring used by adt7320_dualcore.c.
+ *
+ * The ring must live in SRAM visible to both cores (SRAM4 in D3 by default).
+ * RING_SIZE must be a power of two.
+ */
+#define  ADT7320_DUALCORE_SHARED_ADDR  (0x38000000UL)  ///< Address of the shared ring
+#define  ADT7320_DUALCORE_RING_SIZE    (256U)          ///< Number of sample records in the ring
+#define  ADT7320_DUALCORE_HSEM_ID      (0U)            ///< Hardware semaphore used for notifications
+#define  ADT7320_DUALCORE_BATCH        (8U)            ///< Records pushed between two notifications
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                              Temperature Histogram (OPTIONAL)                          */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of bins of each histogram used by adt7320_histogram.c.
+ *
+ * Bin width and lower bound are chosen at run time; samples outside the
+ * covered range are counted in dedicated underflow/overflow counters.
+ */
+#define  ADT7320_HIST_BINS  (64U)
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                Rollup Pyramid (OPTIONAL)                               */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Tiers of the min/max/mean rollup engine used by adt7320_rollup.c.
+ *
+ * Periods are listed finest first, in milliseconds, and each must be a multiple of
+ * the previous one. Every tier keeps DEPTH closed buckets of 24 bytes, so the RAM
+ * footprint is about TIERS * (DEPTH + 1) * 24 bytes per sensor.
+ */
+#define  ADT7320_ROLLUP_TIERS       (3U)                                 ///< Number of tiers
+#define  ADT7320_ROLLUP_DEPTH       (60U)                                ///< Closed buckets kept per tier
+#define  ADT7320_ROLLUP_PERIODS_MS  { 1000UL, 60000UL, 3600000UL }       ///< Bucket period of each tier
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                              Time-to-Threshold Trend (OPTIONAL)                        */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of recent samples used for the linear fit in adt7320_trend.c (2 .. 32).
+ *
+ * The fit costs O(WINDOW) per sample. Samples older than about 17 minutes relative
+ * to the newest one are discarded from the window.
+ */
+#define  ADT7320_TREND_WINDOW  (16U)
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                               Thermal Exposure (OPTIONAL)                              */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Temperature span of the Arrhenius lookup table used by adt7320_exposure.c.
+ *
+ * The table holds one 32-bit entry per °C; samples outside the span are clamped.
+ */
+#define  ADT7320_EXPOSURE_LUT_MIN_C  (-40)   ///< Lowest tabulated temperature, in °C
+#define  ADT7320_EXPOSURE_LUT_MAX_C  (150)   ///< Highest tabulated temperature, in °C
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                   Event Log (OPTIONAL)                                 */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Sizing of the alarm/event log used by adt7320_eventlog.c.
+ *
+ * Each record takes 12 bytes. A new event is folded into one of the DEDUP_DEPTH most
+ * recent records when it has the same type and sensor.
+ */
+#define  ADT7320_EVENTLOG_SIZE         (64U)  ///< Records kept in the ring
+#define  ADT7320_EVENTLOG_DEDUP_DEPTH  (4U)   ///< Recent records searched for coalescing
+#define  ADT7320_EVENTLOG_MAX_SENSORS  (16U)  ///< Sensors whose status is tracked
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                Modbus RTU Slave (OPTIONAL)                             */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of sensors exposed by the Modbus register map in adt7320_modbus.c.
+ *
+ * Each sensor occupies one input register and one holding register, so the whole
+ * array can be read with a single request (at most 125 registers).
+ */
+#define  ADT7320_MODBUS_MAX_SENSORS  (16U)
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                 CAN Telemetry (OPTIONAL)                               */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of sensors tracked by the CAN packer in adt7320_can.c (1 .. 255).
+ *
+ * The packer keeps the last transmitted code of each sensor (2 bytes) for change-only
+ * transmission.
+ */
+#define  ADT7320_CAN_MAX_SENSORS  (16U)
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                  Metrics Registry (OPTIONAL)                           */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Records driver counters into the registry of adt7320_metrics.c.
+ *
+ * Set to 1U and add adt7320_metrics.c to the build to enable. With 0U the recording
+ * hooks compile to nothing.
+ */
+#ifndef ADT7320_METRICS_ENABLE
+    #define  ADT7320_METRICS_ENABLE  (0U)
+#endif
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                   Sweep Frames (OPTIONAL)                              */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Sweep frame buffers handed between acquisition and consumer in adt7320_frames.c.
+ *
+ * DEPTH = 2 gives ping-pong buffering; more frames let the consumer fall behind by
+ * DEPTH - 1 sweeps before a sweep is dropped.
+ */
+#define  ADT7320_FRAMES_DEPTH        (2U)   ///< Number of frames (power of two, >= 2)
+#define  ADT7320_FRAMES_MAX_SENSORS  (16U)  ///< Sensors per frame
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                  Bus Traffic Trace (OPTIONAL)                          */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Records every SPI transaction of the driver into adt7320_trace.c.
+ *
+ * Set ENABLE to 1U and add adt7320_trace.c to the build to enable. With 0U the hook
+ * compiles to nothing. Each transaction takes (1 + transmitted bytes) of the buffer.
+ */
+#ifndef ADT7320_TRACE_ENABLE
+    #define  ADT7320_TRACE_ENABLE  (0U)  ///< Record SPI transactions
+#endif
+#define  ADT7320_TRACE_SIZE    (256U)  ///< Trace buffer size, in bytes
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                 Multi-Bus Sweep (OPTIONAL)                             */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Maximum number of SPI buses swept in parallel by adt7320_multibus.c.
+ */
+#define  ADT7320_MULTIBUS_MAX_BUSES  (4U)  ///< SPI buses per sweep
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                 Columnar Store (OPTIONAL)                              */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Samples per sealed segment in adt7320_colstore.c.
+ *
+ * Each open column holds this many samples in RAM (6 bytes each) before it is encoded
+ * and written out.
+ */
+#define  ADT7320_COLSTORE_SEGMENT_SAMPLES  (128U)  ///< Samples per segment
+
+/**
+ * @brief Flash programming granularity of the segment store, in bytes (power of 2, 1 to 128).
+ *
+ * Segments are padded to a multiple of it, and each call of the write function covers
+ * whole program units, so no flash word is programmed twice. STM32L4/G4: 8 (double
+ * word), STM32U5: 16 (quad word), STM32H7: 32 (flash word), STM32F4/F7: 1.
+ */
+#define  ADT7320_COLSTORE_WRITE_ALIGN  (8U)  ///< Flash program unit, in bytes
+
+
+/* ------------------------------------------------------------------------------------- */
+/*                                 Command Frames (OPTIONAL)                              */
+/* ------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Maximum number of commands in one adt7320_cmdframe.c frame.
+ *
+ * Each command takes up to 3 bytes in both the transmit and the receive buffer.
+ */
+#define  ADT7320_CMDFRAME_MAX_COMMANDS  (8U)  ///< Commands per frame
+
+
 #ifdef __cplusplus
     }
 #endif
@@ -0,0 +1,351 @@
+/**
+ * @file    adt7320_dualcore.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   CM4 -> CM7 sample transport for STM32H7 dual-core devices.
+ *
+ * @details
+ * head and tail are free-running 32-bit counters; the slot of a counter is
+ * (counter & (ADT7320_DUALCORE_RING_SIZE - 1)) and the fill level is (head - tail).
+ * Only the CM4 writes head and only the CM7 writes tail, so no lock is needed on the
+ * data path; the hardware semaphore is used purely as a cross-core doorbell.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_dualcore.h"  /**< Dual-core transport interface */
+#include "adt7320_metrics.h"   /**< Metric recording hooks */
+
+
+#if defined (_STM32H7)
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Slot mask of the ring */
+#define  ADT7320_DUALCORE_MASK  (ADT7320_DUALCORE_RING_SIZE - 1U)
+
+#if ( (ADT7320_DUALCORE_RING_SIZE & ADT7320_DUALCORE_MASK) != 0U )
+    #error "ADT7320_DUALCORE_RING_SIZE must be a power of two"
+#endif
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+#if defined (CORE_CM7)
+static volatile uint32_t adt7320_dualcorePending = 0U;  /**< Set by the HSEM free interrupt */
+#endif  /* CORE_CM7 */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+#if defined (CORE_CM4)
+
+/**
+ * @brief  Rings the CM7 doorbell by taking and releasing the notification semaphore.
+ */
+static void ADT7320_DualCore_Notify(void)
+{
+    if (HAL_HSEM_FastTake(ADT7320_DUALCORE_HSEM_ID) == HAL_OK)
+    {
+        HAL_HSEM_Release(ADT7320_DUALCORE_HSEM_ID, 0U);
+    }
+}
+
+#endif  /* CORE_CM4 */
+
+#if defined (CORE_CM7)
+
+/**
+ * @brief  Invalidates the cache lines holding @p count records starting at counter @p from.
+ *
+ * @param[in] pRing  Pointer to the shared ring.
+ * @param[in] from   Counter of the first record.
+ * @param[in] count  Number of records.
+ */
+static void ADT7320_DualCore_Invalidate(ADT7320_DualCoreRingTypeDef *pRing, uint32_t from, uint32_t count)
+{
+    uint32_t slot  = from & ADT7320_DUALCORE_MASK;
+    uint32_t first = ADT7320_DUALCORE_RING_SIZE - slot;
+
+    if (first > count)
+    {
+        first = count;
+    }
+
+    SCB_InvalidateDCache_by_Addr((void *)&pRing->record[slot], (int32_t)(first * sizeof(ADT7320_DualCoreRecordTypeDef)));
+
+    if (count > first)
+    {
+        SCB_InvalidateDCache_by_Addr((void *)&pRing->record[0U], (int32_t)((count - first) * sizeof(ADT7320_DualCoreRecordTypeDef)));
+    }
+}
+
+#endif  /* CORE_CM7 */
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes the shared ring.
+ *
+ * Call once, from either core, before the other core starts using the ring.
+ *
+ * @param[out] pRing  Pointer to the shared ring (usually ADT7320_DUALCORE_RING).
+ *
+ * @retval ADT7320_OK     Ring initialized
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Init(ADT7320_DualCoreRingTypeDef *pRing)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pRing == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pRing->head    = 0U;
+        pRing->tail    = 0U;
+        pRing->dropped = 0U;
+        __DMB();
+        pRing->magic   = ADT7320_DUALCORE_MAGIC;
+
+#if defined (CORE_CM7)
+        SCB_CleanDCache_by_Addr((void *)pRing, (int32_t)sizeof(ADT7320_DualCoreRingTypeDef));
+#endif  /* CORE_CM7 */
+    }
+
+    return status;
+}
+
+#if defined (CORE_CM4)
+
+/**
+ * @brief  Pushes one sample record into the ring (CM4).
+ *
+ * @param[in,out] pRing   Pointer to the shared ring.
+ * @param[in]     sensor  Sensor index.
+ * @param[in]     raw     Raw ADT7320_TEMP code.
+ * @param[in]     result  Status of the read that produced the sample.
+ *
+ * @retval ADT7320_OK     Record pushed
+ * @retval ADT7320_BUSY   Ring full, record dropped
+ * @retval ADT7320_ERROR  Invalid parameters or ring not initialized
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Push(ADT7320_DualCoreRingTypeDef *pRing, uint8_t sensor, int16_t raw, ADT7320_StatusTypeDef result)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_DualCoreRecordTypeDef *pRec = NULL;
+    uint32_t head = 0U;
+    uint32_t tail = 0U;
+
+    if ( (pRing == NULL) || (pRing->magic != ADT7320_DUALCORE_MAGIC) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        head = pRing->head;
+        tail = pRing->tail;
+
+        if ((head - tail) >= ADT7320_DUALCORE_RING_SIZE)
+        {
+            pRing->dropped++;
+            status = ADT7320_BUSY;
+        }
+        else
+        {
+            pRec = &pRing->record[head & ADT7320_DUALCORE_MASK];
+            pRec->seq    = head;
+            pRec->tick   = HAL_GetTick();
+            pRec->raw    = raw;
+            pRec->sensor = sensor;
+            pRec->status = (uint8_t)result;
+
+            /* Record must be visible before the new head */
+            __DMB();
+            pRing->head = head + 1U;
+            ADT7320_METRIC_MAX(ADT7320_METRIC_DUALCORE_DEPTH_MAX, (head + 1U) - tail);
+
+            if ( (head == tail) || (((head + 1U) % ADT7320_DUALCORE_BATCH) == 0U) )
+            {
+                ADT7320_DualCore_Notify();
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Reads every sensor once and pushes one record per sensor (CM4).
+ *
+ * @param[in,out] pRing     Pointer to the shared ring.
+ * @param[in]     pSensors  Array of sensor configurations.
+ * @param[in]     count     Number of sensors.
+ *
+ * @retval ADT7320_OK     All records pushed
+ * @retval ADT7320_BUSY   At least one record dropped because the ring was full
+ * @retval ADT7320_ERROR  Invalid parameters or ring not initialized
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Acquire(ADT7320_DualCoreRingTypeDef *pRing, const ADT7320_ConfigTypeDef *pSensors, uint8_t count)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_StatusTypeDef result = ADT7320_OK;
+    uint16_t data = 0U;
+
+    if ( (pRing == NULL) || (pSensors == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint8_t i = 0U; (i < count) && (status != ADT7320_ERROR); i++)
+        {
+            data   = 0U;
+            result = ADT7320_ReadRegister(&pSensors[i], ADT7320_TEMP, 2U, &data);
+
+            if (ADT7320_DualCore_Push(pRing, i, (int16_t)data, result) != ADT7320_OK)
+            {
+                status = (pRing->magic == ADT7320_DUALCORE_MAGIC) ? ADT7320_BUSY : ADT7320_ERROR;
+            }
+        }
+    }
+
+    return status;
+}
+
+#endif  /* CORE_CM4 */
+
+#if defined (CORE_CM7)
+
+/**
+ * @brief  Enables the HSEM notification on the CM7.
+ *
+ * Requires HSEM1_IRQn to be enabled in the NVIC.
+ */
+void ADT7320_DualCore_EnableNotify(void)
+{
+    HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(ADT7320_DUALCORE_HSEM_ID));
+}
+
+/**
+ * @brief  Handles the HSEM free interrupt (CM7).
+ *
+ * Call from HAL_HSEM_FreeCallback(). Re-arms the notification and flags pending data.
+ *
+ * @param[in] semMask  Mask passed to HAL_HSEM_FreeCallback().
+ */
+void ADT7320_DualCore_FreeCallback(uint32_t semMask)
+{
+    if ((semMask & __HAL_HSEM_SEMID_TO_MASK(ADT7320_DUALCORE_HSEM_ID)) != 0U)
+    {
+        adt7320_dualcorePending = 1U;
+        HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(ADT7320_DUALCORE_HSEM_ID));
+    }
+}
+
+/**
+ * @brief  Returns and clears the pending-notification flag (CM7).
+ *
+ * A notification arriving during the call is never lost: it is either returned or
+ * left pending for the next call.
+ *
+ * @return Non-zero if the CM4 signalled new records since the last call.
+ */
+uint8_t ADT7320_DualCore_Pending(void)
+{
+    uint32_t pending = 0U;
+
+    /* Read and clear in one exclusive sequence: a notification in between makes the store fail */
+    do
+    {
+        pending = __LDREXW(&adt7320_dualcorePending);
+    } while (__STREXW(0U, &adt7320_dualcorePending) != 0U);
+
+    return (uint8_t)pending;
+}
+
+/**
+ * @brief  Pops up to @p max records from the ring in one batch (CM7).
+ *
+ * @param[in,out] pRing   Pointer to the shared ring.
+ * @param[out]    pOut    Destination array.
+ * @param[in]     max     Capacity of @p pOut.
+ * @param[out]    pCount  Number of records copied.
+ *
+ * @retval ADT7320_OK     Records popped (possibly zero)
+ * @retval ADT7320_ERROR  Invalid parameters or ring not initialized
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Pop(ADT7320_DualCoreRingTypeDef *pRing, ADT7320_DualCoreRecordTypeDef *pOut,
+                                           uint16_t max, uint16_t *pCount)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t head  = 0U;
+    uint32_t tail  = 0U;
+    uint32_t count = 0U;
+
+    if ( (pRing == NULL) || (pOut == NULL) || (pCount == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        /* head, magic and dropped share the producer's cache line */
+        SCB_InvalidateDCache_by_Addr((void *)&pRing->head, 32);
+
+        if (pRing->magic != ADT7320_DUALCORE_MAGIC)
+        {
+            status = ADT7320_ERROR;
+        }
+    }
+
+    if (status == ADT7320_OK)
+    {
+        head  = pRing->head;
+        tail  = pRing->tail;
+        count = head - tail;
+
+        if (count > max)
+        {
+            count = max;
+        }
+
+        if (count > 0U)
+        {
+            /* Records must be read after head */
+            __DMB();
+            ADT7320_DualCore_Invalidate(pRing, tail, count);
+
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                pOut[i] = pRing->record[(tail + i) & ADT7320_DUALCORE_MASK];
+            }
+
+            __DMB();
+            pRing->tail = tail + count;
+            SCB_CleanDCache_by_Addr((void *)&pRing->tail, 32);
+        }
+
+        *pCount = (uint16_t)count;
+    }
+
+    return status;
+}
+
+#endif  /* CORE_CM7 */
+
+
+#endif  /* _STM32H7 */
+
+
+/* adt7320_dualcore.c */
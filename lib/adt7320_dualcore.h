@@ -0,0 +1,182 @@
+/**
+ * @file    adt7320_dualcore.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   CM4 -> CM7 sample transport for STM32H7 dual-core devices.
+ *
+ * @details
+ * The CM4 owns the SPI bus and the ADT7320 handles and pushes sample records into a
+ * single-producer / single-consumer ring in shared SRAM. The CM7 drains the ring in batches.
+ *
+ * - The producer index, the consumer index and the record array each start on their own
+ *   32-byte cache line, so the CM7 never writes back a line the CM4 is updating.
+ * - The CM4 has no data cache; the CM7 invalidates the lines it reads and cleans the
+ *   line it writes, so the ring also works in cacheable memory.
+ * - Every ADT7320_DUALCORE_BATCH records (and whenever a push finds the ring empty),
+ *   the CM4 takes and releases hardware semaphore ADT7320_DUALCORE_HSEM_ID, which raises
+ *   the HSEM free interrupt on the CM7.
+ *
+ * @note
+ * Only available when _STM32H7 is selected. Producer functions are built for CORE_CM4,
+ * consumer functions for CORE_CM7 (the symbols defined by STM32CubeH7 dual-core projects).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_DUALCORE_H
+#define ADT7320_DUALCORE_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+#if defined (_STM32H7)
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Shared ring placed at the configured address */
+#define  ADT7320_DUALCORE_RING  ((ADT7320_DualCoreRingTypeDef *)ADT7320_DUALCORE_SHARED_ADDR)
+
+/** @brief Marker written by ADT7320_DualCore_Init() once the ring is ready */
+#define  ADT7320_DUALCORE_MAGIC  (0x54373230UL)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief One sample record (12 bytes).
+ */
+typedef struct
+{
+    uint32_t seq;     /**< Sequence number, incremented per record by the producer */
+    uint32_t tick;    /**< HAL_GetTick() on the CM4 when the sample was read */
+    int16_t  raw;     /**< Raw 16-bit ADT7320_TEMP code */
+    uint8_t  sensor;  /**< Sensor index on the CM4 */
+    uint8_t  status;  /**< ADT7320_StatusTypeDef of the read */
+} ADT7320_DualCoreRecordTypeDef;
+
+/**
+ * @brief Shared ring layout.
+ */
+typedef struct
+{
+    __ALIGNED(32) volatile uint32_t head;  /**< Next slot written by the CM4 */
+    volatile uint32_t magic;               /**< ADT7320_DUALCORE_MAGIC once initialized */
+    volatile uint32_t dropped;             /**< Records lost because the ring was full */
+    __ALIGNED(32) volatile uint32_t tail;  /**< Next slot read by the CM7 */
+    __ALIGNED(32) ADT7320_DualCoreRecordTypeDef record[ADT7320_DUALCORE_RING_SIZE];  /**< Sample records */
+} ADT7320_DualCoreRingTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes the shared ring.
+ *
+ * Call once, from either core, before the other core starts using the ring.
+ *
+ * @param[out] pRing  Pointer to the shared ring (usually ADT7320_DUALCORE_RING).
+ *
+ * @retval ADT7320_OK     Ring initialized
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Init(ADT7320_DualCoreRingTypeDef *pRing);
+
+#if defined (CORE_CM4)
+
+/**
+ * @brief  Pushes one sample record into the ring (CM4).
+ *
+ * @param[in,out] pRing   Pointer to the shared ring.
+ * @param[in]     sensor  Sensor index.
+ * @param[in]     raw     Raw ADT7320_TEMP code.
+ * @param[in]     result  Status of the read that produced the sample.
+ *
+ * @retval ADT7320_OK     Record pushed
+ * @retval ADT7320_BUSY   Ring full, record dropped
+ * @retval ADT7320_ERROR  Invalid parameters or ring not initialized
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Push(ADT7320_DualCoreRingTypeDef *pRing, uint8_t sensor, int16_t raw, ADT7320_StatusTypeDef result);
+
+/**
+ * @brief  Reads every sensor once and pushes one record per sensor (CM4).
+ *
+ * @param[in,out] pRing     Pointer to the shared ring.
+ * @param[in]     pSensors  Array of sensor configurations.
+ * @param[in]     count     Number of sensors.
+ *
+ * @retval ADT7320_OK     All records pushed
+ * @retval ADT7320_BUSY   At least one record dropped because the ring was full
+ * @retval ADT7320_ERROR  Invalid parameters or ring not initialized
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Acquire(ADT7320_DualCoreRingTypeDef *pRing, const ADT7320_ConfigTypeDef *pSensors, uint8_t count);
+
+#endif  /* CORE_CM4 */
+
+#if defined (CORE_CM7)
+
+/**
+ * @brief  Enables the HSEM notification on the CM7.
+ *
+ * Requires HSEM1_IRQn to be enabled in the NVIC.
+ */
+void ADT7320_DualCore_EnableNotify(void);
+
+/**
+ * @brief  Handles the HSEM free interrupt (CM7).
+ *
+ * Call from HAL_HSEM_FreeCallback(). Re-arms the notification and flags pending data.
+ *
+ * @param[in] semMask  Mask passed to HAL_HSEM_FreeCallback().
+ */
+void ADT7320_DualCore_FreeCallback(uint32_t semMask);
+
+/**
+ * @brief  Returns and clears the pending-notification flag (CM7).
+ *
+ * A notification arriving during the call is never lost: it is either returned or
+ * left pending for the next call.
+ *
+ * @return Non-zero if the CM4 signalled new records since the last call.
+ */
+uint8_t ADT7320_DualCore_Pending(void);
+
+/**
+ * @brief  Pops up to @p max records from the ring in one batch (CM7).
+ *
+ * @param[in,out] pRing   Pointer to the shared ring.
+ * @param[out]    pOut    Destination array.
+ * @param[in]     max     Capacity of @p pOut.
+ * @param[out]    pCount  Number of records copied.
+ *
+ * @retval ADT7320_OK     Records popped (possibly zero)
+ * @retval ADT7320_ERROR  Invalid parameters or ring not initialized
+ */
+ADT7320_StatusTypeDef ADT7320_DualCore_Pop(ADT7320_DualCoreRingTypeDef *pRing, ADT7320_DualCoreRecordTypeDef *pOut,
+                                           uint16_t max, uint16_t *pCount);
+
+#endif  /* CORE_CM7 */
+
+
+#endif  /* _STM32H7 */
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_DUALCORE_H */
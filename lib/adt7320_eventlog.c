@@ -0,0 +1,255 @@
+/**
+ * @file    adt7320_eventlog.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Deduplicating alarm/event log for ADT7320 limit crossings and faults.
+ *
+ * @details
+ * The oldest record sits at (head - count) modulo the ring size. The @c held oldest ones
+ * belong to an upload in progress: coalescing only looks at the newest
+ * ADT7320_EVENTLOG_DEDUP_DEPTH records that are not held, so recording stays O(1), and
+ * the oldest record is only overwritten while nothing is held.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_eventlog.h"  /**< Event log interface */
+#include "adt7320_metrics.h"   /**< Metric recording hooks */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Status flags tracked for transitions */
+#define  ADT7320_EVENTLOG_FLAGS  (ADT7320_STATUS_TLOW | ADT7320_STATUS_THIGH | ADT7320_STATUS_TCRIT)
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Clears the log.
+ *
+ * @param[out] pLog        Pointer to the event log.
+ * @param[in]  coalesceMs  Repeated events closer than this to a record's last occurrence are folded into it.
+ *
+ * @retval ADT7320_OK     Log ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_Init(ADT7320_EventLogTypeDef *pLog, uint32_t coalesceMs)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pLog == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pLog->head        = 0U;
+        pLog->count       = 0U;
+        pLog->held        = 0U;
+        pLog->overwritten = 0U;
+        pLog->dropped     = 0U;
+        pLog->coalesceMs  = coalesceMs;
+
+        for (uint8_t s = 0U; s < ADT7320_EVENTLOG_MAX_SENSORS; s++)
+        {
+            pLog->status[s]  = 0U;
+            pLog->faulted[s] = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Records one event, coalescing it with a recent identical one if possible.
+ *
+ * @param[in,out] pLog    Pointer to the event log.
+ * @param[in]     type    Event type.
+ * @param[in]     sensor  Sensor index.
+ * @param[in]     tick    Event time, in ms.
+ */
+void ADT7320_EventLog_Record(ADT7320_EventLogTypeDef *pLog, ADT7320_EventTypeDef type, uint8_t sensor, uint32_t tick)
+{
+    ADT7320_EventRecordTypeDef *pRec = NULL;
+    uint16_t open  = (uint16_t)(pLog->count - pLog->held);
+    uint16_t depth = (open < ADT7320_EVENTLOG_DEDUP_DEPTH) ? open : (uint16_t)ADT7320_EVENTLOG_DEDUP_DEPTH;
+    uint16_t slot  = 0U;
+
+    /* Newest records first, never into a held one */
+    for (uint16_t i = 1U; (i <= depth) && (pRec == NULL); i++)
+    {
+        slot = (uint16_t)((pLog->head + ADT7320_EVENTLOG_SIZE - i) % ADT7320_EVENTLOG_SIZE);
+
+        if ( (pLog->record[slot].type == (uint8_t)type) && (pLog->record[slot].sensor == sensor) &&
+             ((tick - pLog->record[slot].last) <= pLog->coalesceMs) )
+        {
+            pRec = &pLog->record[slot];
+        }
+    }
+
+    if (pRec != NULL)
+    {
+        if (pRec->count < 0xFFFFU)
+        {
+            pRec->count++;
+        }
+        pRec->last = tick;
+    }
+    else if ( (pLog->count == ADT7320_EVENTLOG_SIZE) && (pLog->held != 0U) )
+    {
+        /* The oldest record is being uploaded */
+        pLog->dropped++;
+    }
+    else
+    {
+        if (pLog->count == ADT7320_EVENTLOG_SIZE)
+        {
+            pLog->overwritten++;
+        }
+        else
+        {
+            pLog->count++;
+        }
+
+        pRec = &pLog->record[pLog->head];
+        pRec->type   = (uint8_t)type;
+        pRec->sensor = sensor;
+        pRec->count  = 1U;
+        pRec->first  = tick;
+        pRec->last   = tick;
+
+        pLog->head = (uint16_t)((pLog->head + 1U) % ADT7320_EVENTLOG_SIZE);
+        ADT7320_METRIC_MAX(ADT7320_METRIC_EVENTLOG_DEPTH_MAX, pLog->count);
+    }
+}
+
+/**
+ * @brief  Reads ADT7320_STATUS and records flag transitions, faults and recoveries.
+ *
+ * @param[in,out] pLog     Pointer to the event log.
+ * @param[in]     pConfig  Sensor to poll.
+ * @param[in]     sensor   Sensor index (< ADT7320_EVENTLOG_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Status polled
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure (recorded as a fault)
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_PollStatus(ADT7320_EventLogTypeDef *pLog, const ADT7320_ConfigTypeDef *pConfig, uint8_t sensor)
+{
+    static const uint8_t flag[3U] = {ADT7320_STATUS_TLOW, ADT7320_STATUS_THIGH, ADT7320_STATUS_TCRIT};
+
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t data    = 0U;
+    uint8_t  changed = 0U;
+    uint32_t tick    = HAL_GetTick();
+
+    if ( (pLog == NULL) || (pConfig == NULL) || (sensor >= ADT7320_EVENTLOG_MAX_SENSORS) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        status = ADT7320_ReadRegister(pConfig, ADT7320_STATUS, 1U, &data);
+
+        if (status != ADT7320_OK)
+        {
+            pLog->faulted[sensor] = 1U;
+            ADT7320_EventLog_Record(pLog, ADT7320_EVENT_FAULT, sensor, tick);
+        }
+        else
+        {
+            if (pLog->faulted[sensor] != 0U)
+            {
+                pLog->faulted[sensor] = 0U;
+                ADT7320_EventLog_Record(pLog, ADT7320_EVENT_RECOVERED, sensor, tick);
+            }
+
+            changed = (uint8_t)((data ^ pLog->status[sensor]) & ADT7320_EVENTLOG_FLAGS);
+
+            for (uint8_t i = 0U; i < 3U; i++)
+            {
+                if ((changed & flag[i]) != 0U)
+                {
+                    /* SET/CLEAR pairs are laid out as 2 * i and 2 * i + 1 */
+                    ADT7320_EventLog_Record(pLog, (ADT7320_EventTypeDef)((2U * i) + (((data & flag[i]) != 0U) ? 0U : 1U)), sensor, tick);
+                }
+            }
+
+            pLog->status[sensor] = (uint8_t)(data & ADT7320_EVENTLOG_FLAGS);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Returns the oldest stored records as one contiguous array and holds them.
+ *
+ * The span stops at the end of the ring; call again after ADT7320_EventLog_Consume()
+ * to get the remainder. The records stay unchanged until they are consumed.
+ *
+ * @param[in,out] pLog      Pointer to the event log.
+ * @param[out]    ppRecord  First record of the span.
+ * @param[out]    pCount    Number of records in the span (0 if empty).
+ *
+ * @retval ADT7320_OK     Span returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_GetSpan(ADT7320_EventLogTypeDef *pLog, const ADT7320_EventRecordTypeDef **ppRecord, uint16_t *pCount)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t tail = 0U;
+    uint16_t span = 0U;
+
+    if ( (pLog == NULL) || (ppRecord == NULL) || (pCount == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        tail = (uint16_t)((pLog->head + ADT7320_EVENTLOG_SIZE - pLog->count) % ADT7320_EVENTLOG_SIZE);
+        span = (uint16_t)(ADT7320_EVENTLOG_SIZE - tail);
+
+        pLog->held = (pLog->count < span) ? pLog->count : span;
+        *ppRecord  = &pLog->record[tail];
+        *pCount    = pLog->held;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Releases the oldest records after they have been uploaded.
+ *
+ * @param[in,out] pLog   Pointer to the event log.
+ * @param[in]     count  Number of records to release (<= records held by GetSpan).
+ *
+ * @retval ADT7320_OK     Records released
+ * @retval ADT7320_ERROR  Invalid parameters or more records than held
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_Consume(ADT7320_EventLogTypeDef *pLog, uint16_t count)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pLog == NULL) || (count > pLog->held) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pLog->count = (uint16_t)(pLog->count - count);
+        pLog->held  = (uint16_t)(pLog->held - count);
+    }
+
+    return status;
+}
+
+
+/* adt7320_eventlog.c */
@@ -0,0 +1,162 @@
+/**
+ * @file    adt7320_eventlog.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Deduplicating alarm/event log for ADT7320 limit crossings and faults.
+ *
+ * @details
+ * ADT7320_EventLog_PollStatus() reads the ADT7320_STATUS register and records only the
+ * transitions of the TLOW/THIGH/TCRIT flags, plus communication faults and recoveries.
+ *
+ * A sensor oscillating around a limit produces the same few events over and over. Instead
+ * of appending each one, an event with the same type and sensor as one of the
+ * ADT7320_EVENTLOG_DEDUP_DEPTH newest records, within the coalescing window, increments
+ * that record's count and updates its last timestamp.
+ *
+ * Records are 12 bytes and kept in a fixed ring; when it is full the oldest record is
+ * overwritten and counted in @c overwritten. ADT7320_EventLog_GetSpan() exposes the oldest
+ * records as a contiguous array for zero-copy upload (e.g. UART DMA), and
+ * ADT7320_EventLog_Consume() releases them afterwards.
+ *
+ * Records handed out by ADT7320_EventLog_GetSpan() are held until consumed: they are
+ * never coalesced into nor overwritten, so the upload sees them unchanged and Consume()
+ * releases exactly what was sent. A repeat of a held record starts a new record, and an
+ * event arriving while the ring is full and its oldest record is held is dropped and
+ * counted in @c dropped.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_EVENTLOG_H
+#define ADT7320_EVENTLOG_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Event types.
+ */
+typedef enum
+{
+    ADT7320_EVENT_TLOW_SET    = 0U,  /**< TLOW flag set */
+    ADT7320_EVENT_TLOW_CLEAR  = 1U,  /**< TLOW flag cleared */
+    ADT7320_EVENT_THIGH_SET   = 2U,  /**< THIGH flag set */
+    ADT7320_EVENT_THIGH_CLEAR = 3U,  /**< THIGH flag cleared */
+    ADT7320_EVENT_TCRIT_SET   = 4U,  /**< TCRIT flag set */
+    ADT7320_EVENT_TCRIT_CLEAR = 5U,  /**< TCRIT flag cleared */
+    ADT7320_EVENT_FAULT       = 6U,  /**< SPI communication failed */
+    ADT7320_EVENT_RECOVERED   = 7U   /**< SPI communication recovered after a fault */
+} ADT7320_EventTypeDef;
+
+/**
+ * @brief One log record (12 bytes).
+ */
+typedef struct
+{
+    uint8_t  type;    /**< ADT7320_EventTypeDef */
+    uint8_t  sensor;  /**< Sensor index */
+    uint16_t count;   /**< Occurrences folded into this record (saturating) */
+    uint32_t first;   /**< Tick of the first occurrence, in ms */
+    uint32_t last;    /**< Tick of the last occurrence, in ms */
+} ADT7320_EventRecordTypeDef;
+
+/**
+ * @brief Event log state.
+ */
+typedef struct
+{
+    ADT7320_EventRecordTypeDef record[ADT7320_EVENTLOG_SIZE];  /**< Record ring */
+    uint16_t head;                                             /**< Slot of the next record */
+    uint16_t count;                                            /**< Records stored */
+    uint16_t held;                                             /**< Oldest records handed out by GetSpan, not yet consumed */
+    uint32_t overwritten;                                      /**< Records lost to overwrite */
+    uint32_t dropped;                                          /**< Events lost because the ring was full of held records */
+    uint32_t coalesceMs;                                       /**< Coalescing window, in ms */
+    uint8_t  status[ADT7320_EVENTLOG_MAX_SENSORS];             /**< Last status flags per sensor */
+    uint8_t  faulted[ADT7320_EVENTLOG_MAX_SENSORS];            /**< Non-zero while a sensor is faulted */
+} ADT7320_EventLogTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Clears the log.
+ *
+ * @param[out] pLog        Pointer to the event log.
+ * @param[in]  coalesceMs  Repeated events closer than this to a record's last occurrence are folded into it.
+ *
+ * @retval ADT7320_OK     Log ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_Init(ADT7320_EventLogTypeDef *pLog, uint32_t coalesceMs);
+
+/**
+ * @brief  Records one event, coalescing it with a recent identical one if possible.
+ *
+ * @param[in,out] pLog    Pointer to the event log.
+ * @param[in]     type    Event type.
+ * @param[in]     sensor  Sensor index.
+ * @param[in]     tick    Event time, in ms.
+ */
+void ADT7320_EventLog_Record(ADT7320_EventLogTypeDef *pLog, ADT7320_EventTypeDef type, uint8_t sensor, uint32_t tick);
+
+/**
+ * @brief  Reads ADT7320_STATUS and records flag transitions, faults and recoveries.
+ *
+ * @param[in,out] pLog     Pointer to the event log.
+ * @param[in]     pConfig  Sensor to poll.
+ * @param[in]     sensor   Sensor index (< ADT7320_EVENTLOG_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Status polled
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure (recorded as a fault)
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_PollStatus(ADT7320_EventLogTypeDef *pLog, const ADT7320_ConfigTypeDef *pConfig, uint8_t sensor);
+
+/**
+ * @brief  Returns the oldest stored records as one contiguous array and holds them.
+ *
+ * The span stops at the end of the ring; call again after ADT7320_EventLog_Consume()
+ * to get the remainder. The records stay unchanged until they are consumed.
+ *
+ * @param[in,out] pLog      Pointer to the event log.
+ * @param[out]    ppRecord  First record of the span.
+ * @param[out]    pCount    Number of records in the span (0 if empty).
+ *
+ * @retval ADT7320_OK     Span returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_GetSpan(ADT7320_EventLogTypeDef *pLog, const ADT7320_EventRecordTypeDef **ppRecord, uint16_t *pCount);
+
+/**
+ * @brief  Releases the oldest records after they have been uploaded.
+ *
+ * @param[in,out] pLog   Pointer to the event log.
+ * @param[in]     count  Number of records to release (<= records held by GetSpan).
+ *
+ * @retval ADT7320_OK     Records released
+ * @retval ADT7320_ERROR  Invalid parameters or more records than held
+ */
+ADT7320_StatusTypeDef ADT7320_EventLog_Consume(ADT7320_EventLogTypeDef *pLog, uint16_t count);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_EVENTLOG_H */
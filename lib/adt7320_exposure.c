@@ -0,0 +1,296 @@
+/**
+ * @file    adt7320_exposure.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Thermal exposure integrators: Arrhenius ageing and degree-minutes.
+ *
+ * @details
+ * Table entry i holds AF at (ADT7320_EXPOSURE_LUT_MIN_C + i) °C. A raw code is split into
+ * an entry index (raw / 128) and a 7-bit fraction used for linear interpolation. The
+ * interpolation is done in signed 64-bit, so the table need not be monotonic.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <math.h>               /**< exp() for building the lookup table */
+#include "adt7320_exposure.h"   /**< Exposure integrator interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Boltzmann constant, in meV/K */
+#define  ADT7320_EXPOSURE_K_MEV  (8.617333e-2)
+
+/** @brief Raw code of the lowest table entry */
+#define  ADT7320_EXPOSURE_LUT_MIN_RAW  ((int32_t)ADT7320_EXPOSURE_LUT_MIN_C * 128)
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Saturating 64-bit addition.
+ *
+ * @param[in,out] pAcc   Accumulator.
+ * @param[in]     value  Value to add.
+ */
+static void ADT7320_Exposure_Accumulate(uint64_t *pAcc, uint64_t value)
+{
+    *pAcc = (value > (UINT64_MAX - *pAcc)) ? UINT64_MAX : (*pAcc + value);
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Builds the Arrhenius acceleration-factor table.
+ *
+ * AF(T) = exp(Ea / k * (1 / Tref - 1 / T)), stored in Q16 and saturated to 32 bits.
+ * Uses floating point once at start-up; the per-sample path does not.
+ *
+ * @param[out] pTable     Table of ADT7320_EXPOSURE_LUT_SIZE entries.
+ * @param[in]  eaMilliEv  Activation energy, in meV (e.g. 700 for 0.7 eV).
+ * @param[in]  refC       Reference temperature, in °C.
+ *
+ * @retval ADT7320_OK     Table built
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_BuildTable(uint32_t *pTable, uint16_t eaMilliEv, int16_t refC)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    double tRef = (double)refC + 273.15;
+    double tK   = 0.0;
+    double af   = 0.0;
+
+    if ( (pTable == NULL) || (refC <= -273) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint16_t i = 0U; i < ADT7320_EXPOSURE_LUT_SIZE; i++)
+        {
+            tK = (double)(ADT7320_EXPOSURE_LUT_MIN_C + (int32_t)i) + 273.15;
+            af = exp(((double)eaMilliEv / ADT7320_EXPOSURE_K_MEV) * ((1.0 / tRef) - (1.0 / tK))) * 65536.0;
+
+            pTable[i] = (af >= 4294967295.0) ? 0xFFFFFFFFUL : (uint32_t)(af + 0.5);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Initializes an integrator.
+ *
+ * @param[out] pExp     Pointer to the integrator.
+ * @param[in]  pTable   Table built by ADT7320_Exposure_BuildTable() (or a const table).
+ * @param[in]  lowRaw   Low threshold for degree-minutes below (raw code).
+ * @param[in]  highRaw  High threshold for degree-minutes above (raw code).
+ * @param[in]  pState   Previously saved accumulators to resume from (may be NULL).
+ *
+ * @retval ADT7320_OK     Integrator ready
+ * @retval ADT7320_ERROR  Invalid parameters or incompatible saved state
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_Init(ADT7320_ExposureTypeDef *pExp, const uint32_t *pTable, int16_t lowRaw, int16_t highRaw,
+                                            const ADT7320_ExposureStateTypeDef *pState)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pExp == NULL) || (pTable == NULL) || (lowRaw > highRaw) ||
+         ( (pState != NULL) && (pState->version != ADT7320_EXPOSURE_VERSION) ) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pExp->pTable    = pTable;
+        pExp->lowRaw    = lowRaw;
+        pExp->highRaw   = highRaw;
+        pExp->lastRaw   = 0;
+        pExp->lastTick  = 0U;
+        pExp->primed    = 0U;
+        pExp->persistMs = 0U;
+        pExp->sinceSave = 0U;
+        pExp->save      = NULL;
+
+        if (pState != NULL)
+        {
+            pExp->state = *pState;
+        }
+        else
+        {
+            pExp->state.version    = ADT7320_EXPOSURE_VERSION;
+            pExp->state.ageing     = 0U;
+            pExp->state.aboveRawMs = 0U;
+            pExp->state.belowRawMs = 0U;
+            pExp->state.totalMs    = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Sets the persistence hook.
+ *
+ * @param[in,out] pExp       Pointer to the integrator.
+ * @param[in]     persistMs  Save period in integrated ms (0 disables).
+ * @param[in]     save       Save callback.
+ *
+ * @retval ADT7320_OK     Hook set
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_SetPersist(ADT7320_ExposureTypeDef *pExp, uint32_t persistMs, ADT7320_ExposureSaveTypeDef save)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pExp == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pExp->persistMs = persistMs;
+        pExp->save      = save;
+        pExp->sinceSave = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Returns the acceleration factor of a raw code.
+ *
+ * @param[in] pExp  Pointer to the integrator.
+ * @param[in] raw   Raw ADT7320_TEMP code.
+ *
+ * @return Acceleration factor, Q16.
+ */
+uint32_t ADT7320_Exposure_Factor(const ADT7320_ExposureTypeDef *pExp, int16_t raw)
+{
+    int32_t  offset = (int32_t)raw - ADT7320_EXPOSURE_LUT_MIN_RAW;
+    uint32_t entry  = 0U;
+    uint32_t frac   = 0U;
+    int64_t  delta  = 0;
+    uint32_t af     = 0U;
+
+    if (offset <= 0)
+    {
+        af = pExp->pTable[0U];
+    }
+    else
+    {
+        entry = (uint32_t)offset >> 7U;
+        frac  = (uint32_t)offset & 0x7FU;
+
+        if (entry >= (ADT7320_EXPOSURE_LUT_SIZE - 1U))
+        {
+            af = pExp->pTable[ADT7320_EXPOSURE_LUT_SIZE - 1U];
+        }
+        else
+        {
+            /* Signed: a table that decreases between two entries must not wrap */
+            delta = (int64_t)pExp->pTable[entry + 1U] - (int64_t)pExp->pTable[entry];
+            af    = (uint32_t)((int64_t)pExp->pTable[entry] + ((delta * (int64_t)frac) / 128));
+        }
+    }
+
+    return af;
+}
+
+/**
+ * @brief  Integrates up to a new sample.
+ *
+ * @param[in,out] pExp  Pointer to the integrator.
+ * @param[in]     tick  Sample time, in ms.
+ * @param[in]     raw   Raw ADT7320_TEMP code.
+ */
+void ADT7320_Exposure_Add(ADT7320_ExposureTypeDef *pExp, uint32_t tick, int16_t raw)
+{
+    uint32_t dt = 0U;
+
+    if (pExp->primed != 0U)
+    {
+        dt = tick - pExp->lastTick;
+
+        ADT7320_Exposure_Accumulate(&pExp->state.ageing, (uint64_t)ADT7320_Exposure_Factor(pExp, pExp->lastRaw) * dt);
+
+        if (pExp->lastRaw > pExp->highRaw)
+        {
+            ADT7320_Exposure_Accumulate(&pExp->state.aboveRawMs, (uint64_t)((int32_t)pExp->lastRaw - pExp->highRaw) * dt);
+        }
+        else if (pExp->lastRaw < pExp->lowRaw)
+        {
+            ADT7320_Exposure_Accumulate(&pExp->state.belowRawMs, (uint64_t)((int32_t)pExp->lowRaw - pExp->lastRaw) * dt);
+        }
+        else
+        {
+            /* Inside the band: no degree-minutes */
+        }
+
+        ADT7320_Exposure_Accumulate(&pExp->state.totalMs, dt);
+
+        if ( (pExp->persistMs != 0U) && (pExp->save != NULL) )
+        {
+            pExp->sinceSave += dt;
+            if (pExp->sinceSave >= pExp->persistMs)
+            {
+                pExp->sinceSave = 0U;
+                pExp->save(&pExp->state);
+            }
+        }
+    }
+
+    pExp->lastRaw  = raw;
+    pExp->lastTick = tick;
+    pExp->primed   = 1U;
+}
+
+/**
+ * @brief  Returns the accumulated exposure in engineering units.
+ *
+ * @param[in]  pExp           Pointer to the integrator.
+ * @param[out] pAgeingMin     Equivalent minutes at the reference temperature (may be NULL).
+ * @param[out] pAboveDegMin   Degree-minutes above the high threshold (may be NULL).
+ * @param[out] pBelowDegMin   Degree-minutes below the low threshold (may be NULL).
+ *
+ * @retval ADT7320_OK     Values returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_Get(const ADT7320_ExposureTypeDef *pExp, uint64_t *pAgeingMin,
+                                           uint64_t *pAboveDegMin, uint64_t *pBelowDegMin)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pExp == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        if (pAgeingMin != NULL)
+        {
+            *pAgeingMin = pExp->state.ageing / (65536ULL * 60000ULL);
+        }
+        if (pAboveDegMin != NULL)
+        {
+            *pAboveDegMin = pExp->state.aboveRawMs / (128ULL * 60000ULL);
+        }
+        if (pBelowDegMin != NULL)
+        {
+            *pBelowDegMin = pExp->state.belowRawMs / (128ULL * 60000ULL);
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_exposure.c */
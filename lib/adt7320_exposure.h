@@ -0,0 +1,177 @@
+/**
+ * @file    adt7320_exposure.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Thermal exposure integrators: Arrhenius ageing and degree-minutes.
+ *
+ * @details
+ * Integrates thermal stress on the device, sample by sample, from raw ADT7320_TEMP codes:
+ *
+ * - Arrhenius ageing: equivalent time at a reference temperature, using an acceleration
+ *   factor looked up from a table indexed by raw code (1 °C per entry, linear
+ *   interpolation on the 7 fractional bits). The table is built once by
+ *   ADT7320_Exposure_BuildTable(); the per-sample path is integer only.
+ * - Degree-minutes above a high threshold and below a low threshold (cold chain).
+ *
+ * Each sample's value is held until the next sample. Accumulators are 64-bit and
+ * saturate instead of wrapping.
+ *
+ * Persistence: the accumulators live in ADT7320_ExposureStateTypeDef, which can be saved
+ * and restored as a block. If a save callback is set, it is invoked every persistMs of
+ * integrated time so the application can write the state to flash or EEPROM.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_EXPOSURE_H
+#define ADT7320_EXPOSURE_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Number of entries in the Arrhenius lookup table */
+#define  ADT7320_EXPOSURE_LUT_SIZE  ((uint16_t)(ADT7320_EXPOSURE_LUT_MAX_C - ADT7320_EXPOSURE_LUT_MIN_C + 1))
+
+/** @brief Version tag stored in ADT7320_ExposureStateTypeDef */
+#define  ADT7320_EXPOSURE_VERSION  (1U)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Persistent accumulators.
+ */
+typedef struct
+{
+    uint32_t version;     /**< ADT7320_EXPOSURE_VERSION */
+    uint64_t ageing;      /**< Equivalent time at the reference temperature, ms in Q16 */
+    uint64_t aboveRawMs;  /**< Integral of (T - high threshold) while above, raw code * ms */
+    uint64_t belowRawMs;  /**< Integral of (low threshold - T) while below, raw code * ms */
+    uint64_t totalMs;     /**< Integrated time, in ms */
+} ADT7320_ExposureStateTypeDef;
+
+/**
+ * @brief Save callback, invoked every persistMs of integrated time.
+ *
+ * @param pState  Accumulators to persist.
+ */
+typedef void (*ADT7320_ExposureSaveTypeDef)(const ADT7320_ExposureStateTypeDef *pState);
+
+/**
+ * @brief Integrator of one sensor.
+ */
+typedef struct
+{
+    const uint32_t *pTable;              /**< Acceleration factors (Q16), ADT7320_EXPOSURE_LUT_SIZE entries */
+    ADT7320_ExposureStateTypeDef state;  /**< Accumulators */
+    int16_t  highRaw;                    /**< High threshold (raw code) */
+    int16_t  lowRaw;                     /**< Low threshold (raw code) */
+    int16_t  lastRaw;                    /**< Previous sample */
+    uint32_t lastTick;                   /**< Tick of the previous sample, in ms */
+    uint8_t  primed;                     /**< Non-zero once a first sample was seen */
+    uint32_t persistMs;                  /**< Save period in integrated ms (0 = never) */
+    uint32_t sinceSave;                  /**< Integrated ms since the last save */
+    ADT7320_ExposureSaveTypeDef save;    /**< Save callback (may be NULL) */
+} ADT7320_ExposureTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Builds the Arrhenius acceleration-factor table.
+ *
+ * AF(T) = exp(Ea / k * (1 / Tref - 1 / T)), stored in Q16 and saturated to 32 bits.
+ * Uses floating point once at start-up; the per-sample path does not.
+ *
+ * @param[out] pTable     Table of ADT7320_EXPOSURE_LUT_SIZE entries.
+ * @param[in]  eaMilliEv  Activation energy, in meV (e.g. 700 for 0.7 eV).
+ * @param[in]  refC       Reference temperature, in °C.
+ *
+ * @retval ADT7320_OK     Table built
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_BuildTable(uint32_t *pTable, uint16_t eaMilliEv, int16_t refC);
+
+/**
+ * @brief  Initializes an integrator.
+ *
+ * @param[out] pExp     Pointer to the integrator.
+ * @param[in]  pTable   Table built by ADT7320_Exposure_BuildTable() (or a const table,
+ *                      which need not be monotonic).
+ * @param[in]  lowRaw   Low threshold for degree-minutes below (raw code).
+ * @param[in]  highRaw  High threshold for degree-minutes above (raw code).
+ * @param[in]  pState   Previously saved accumulators to resume from (may be NULL).
+ *
+ * @retval ADT7320_OK     Integrator ready
+ * @retval ADT7320_ERROR  Invalid parameters or incompatible saved state
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_Init(ADT7320_ExposureTypeDef *pExp, const uint32_t *pTable, int16_t lowRaw, int16_t highRaw,
+                                            const ADT7320_ExposureStateTypeDef *pState);
+
+/**
+ * @brief  Sets the persistence hook.
+ *
+ * @param[in,out] pExp       Pointer to the integrator.
+ * @param[in]     persistMs  Save period in integrated ms (0 disables).
+ * @param[in]     save       Save callback.
+ *
+ * @retval ADT7320_OK     Hook set
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_SetPersist(ADT7320_ExposureTypeDef *pExp, uint32_t persistMs, ADT7320_ExposureSaveTypeDef save);
+
+/**
+ * @brief  Integrates up to a new sample.
+ *
+ * @param[in,out] pExp  Pointer to the integrator.
+ * @param[in]     tick  Sample time, in ms.
+ * @param[in]     raw   Raw ADT7320_TEMP code.
+ */
+void ADT7320_Exposure_Add(ADT7320_ExposureTypeDef *pExp, uint32_t tick, int16_t raw);
+
+/**
+ * @brief  Returns the acceleration factor of a raw code.
+ *
+ * @param[in] pExp  Pointer to the integrator.
+ * @param[in] raw   Raw ADT7320_TEMP code.
+ *
+ * @return Acceleration factor, Q16.
+ */
+uint32_t ADT7320_Exposure_Factor(const ADT7320_ExposureTypeDef *pExp, int16_t raw);
+
+/**
+ * @brief  Returns the accumulated exposure in engineering units.
+ *
+ * @param[in]  pExp           Pointer to the integrator.
+ * @param[out] pAgeingMin     Equivalent minutes at the reference temperature (may be NULL).
+ * @param[out] pAboveDegMin   Degree-minutes above the high threshold (may be NULL).
+ * @param[out] pBelowDegMin   Degree-minutes below the low threshold (may be NULL).
+ *
+ * @retval ADT7320_OK     Values returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Exposure_Get(const ADT7320_ExposureTypeDef *pExp, uint64_t *pAgeingMin,
+                                           uint64_t *pAboveDegMin, uint64_t *pBelowDegMin);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_EXPOSURE_H */
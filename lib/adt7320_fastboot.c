@@ -0,0 +1,204 @@
+/**
+ * @file    adt7320_fastboot.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Bounded-time path from reset to the first ADT7320 temperature sample.
+ *
+ * @details
+ * Cycle counts are converted with SystemCoreClock, so the clock tree must be set up
+ * (SystemClock_Config()) before ADT7320_FastBoot_Run() is called.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_fastboot.h"  /**< Fast boot interface */
+#include "adt7320_metrics.h"   /**< Metric recording hooks (no-ops unless ADT7320_METRICS_ENABLE) */
+#include "adt7320_trace.h"     /**< Bus-traffic trace hook (no-op unless ADT7320_TRACE_ENABLE) */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Returns the current time.
+ *
+ * @return Cycle count, or HAL tick on cores without DWT.
+ */
+static uint32_t ADT7320_FastBoot_Now(void)
+{
+#if (ADT7320_HAS_DWT == 1U)
+    return DWT->CYCCNT;
+#else
+    return HAL_GetTick();
+#endif
+}
+
+/**
+ * @brief  Converts a time difference to microseconds.
+ *
+ * @param[in] elapsed  Difference of two ADT7320_FastBoot_Now() values.
+ *
+ * @return Microseconds.
+ */
+static uint32_t ADT7320_FastBoot_ToUs(uint32_t elapsed)
+{
+#if (ADT7320_HAS_DWT == 1U)
+    return elapsed / (SystemCoreClock / 1000000U);
+#else
+    return elapsed * 1000U;
+#endif
+}
+
+/**
+ * @brief  Waits at least the given time.
+ *
+ * @param[in] us  Time to wait, in microseconds.
+ */
+static void ADT7320_FastBoot_Wait(uint32_t us)
+{
+#if (ADT7320_HAS_DWT == 1U)
+    uint32_t start  = DWT->CYCCNT;
+    uint32_t cycles = us * (SystemCoreClock / 1000000U);
+
+    while ((DWT->CYCCNT - start) < cycles)
+    {
+    }
+#else
+    HAL_Delay((us + 999U) / 1000U);
+#endif
+}
+
+/**
+ * @brief  Sends one script step.
+ *
+ * @param[in] pConfig  Pointer to the ADT7320 configuration structure (validated by the caller).
+ * @param[in] pStep    Script step.
+ *
+ * @retval ADT7320_OK     Step written
+ * @retval ADT7320_ERROR  Invalid step or SPI failure
+ * @retval ADT7320_BUSY   SPI peripheral is busy
+ * @retval ADT7320_TIMEOUT  SPI operation timed out
+ */
+static ADT7320_StatusTypeDef ADT7320_FastBoot_Send(const ADT7320_ConfigTypeDef *pConfig, const ADT7320_FastBootStepTypeDef *pStep)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t start = 0U;
+
+    if ( (pStep->length < 2U) || (pStep->length > 3U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        ADT7320_Select(pConfig);
+        ADT7320_TRACE_SPI(pStep->tx, pStep->length);
+        start  = ADT7320_METRIC_NOW();
+        status = (ADT7320_StatusTypeDef) HAL_SPI_Transmit(pConfig->SPIx, (uint8_t *)pStep->tx, pStep->length, ADT7320_MAX_DELAY);
+        ADT7320_METRIC_SPI(status, start);
+        ADT7320_Deselect(pConfig);
+    }
+
+    return status;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Resets the sensor, runs the script and returns the first sample as soon as it is ready.
+ *
+ * @param[in]  pConfig    Pointer to the ADT7320 configuration structure.
+ * @param[in]  pScript    Register writes (may be NULL if steps is 0).
+ * @param[in]  steps      Number of script steps.
+ * @param[in]  timeoutMs  Longest wait for RDY, in ms.
+ * @param[out] pRaw       Raw ADT7320_TEMP code of the first sample.
+ * @param[out] pReport    Phase timings (may be NULL).
+ *
+ * @retval ADT7320_OK       Sample returned
+ * @retval ADT7320_ERROR    Invalid parameters or SPI failure
+ * @retval ADT7320_BUSY     SPI peripheral is busy
+ * @retval ADT7320_TIMEOUT  RDY not seen within timeoutMs
+ */
+ADT7320_StatusTypeDef ADT7320_FastBoot_Run(const ADT7320_ConfigTypeDef *pConfig, const ADT7320_FastBootStepTypeDef *pScript, uint8_t steps,
+                                           uint32_t timeoutMs, int16_t *pRaw, ADT7320_FastBootReportTypeDef *pReport)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_FastBootReportTypeDef report = {0U};
+    uint32_t entry     = 0U;
+    uint32_t mark      = 0U;
+    uint32_t now       = 0U;
+    uint32_t startTick = 0U;
+    uint16_t data      = ADT7320_STATUS_NRDY;
+
+    if ( (ADT7320_IsValid(pConfig) == 0U) || (pRaw == NULL) || ( (pScript == NULL) && (steps != 0U) ) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        ADT7320_DWT_Enable();
+
+        entry  = ADT7320_FastBoot_Now();
+        status = ADT7320_Init(pConfig);
+
+        if (status == ADT7320_OK)
+        {
+            ADT7320_FastBoot_Wait(ADT7320_FASTBOOT_RESET_US);
+            mark           = ADT7320_FastBoot_Now();
+            report.resetUs = ADT7320_FastBoot_ToUs(mark - entry);
+
+            for (uint8_t i = 0U; (i < steps) && (status == ADT7320_OK); i++)
+            {
+                status = ADT7320_FastBoot_Send(pConfig, &pScript[i]);
+            }
+
+            now             = ADT7320_FastBoot_Now();
+            report.scriptUs = ADT7320_FastBoot_ToUs(now - mark);
+            mark            = now;
+        }
+
+        /* RDY is active low: read the status register until the conversion is done */
+        startTick = HAL_GetTick();
+
+        while ( (status == ADT7320_OK) && ((data & ADT7320_STATUS_NRDY) != 0U) )
+        {
+            status = ADT7320_ReadRegister(pConfig, ADT7320_STATUS, 1U, &data);
+            report.polls++;
+
+            if ( (status == ADT7320_OK) && ((data & ADT7320_STATUS_NRDY) != 0U) && ((HAL_GetTick() - startTick) >= timeoutMs) )
+            {
+                status = ADT7320_TIMEOUT;
+            }
+        }
+
+        if (status == ADT7320_OK)
+        {
+            status = ADT7320_ReadRegister(pConfig, ADT7320_TEMP, 2U, &data);
+        }
+
+        if (status == ADT7320_OK)
+        {
+            now                 = ADT7320_FastBoot_Now();
+            report.conversionUs = ADT7320_FastBoot_ToUs(now - mark);
+            report.totalUs      = ADT7320_FastBoot_ToUs(now - entry);
+            report.sampleTick   = HAL_GetTick();
+            *pRaw               = (int16_t)data;
+        }
+
+        if (pReport != NULL)
+        {
+            *pReport = report;
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_fastboot.c */
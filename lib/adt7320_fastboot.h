@@ -0,0 +1,121 @@
+/**
+ * @file    adt7320_fastboot.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Bounded-time path from reset to the first ADT7320 temperature sample.
+ *
+ * @details
+ * ADT7320_FastBoot_Run() replaces the usual ADT7320_Init(), configuration writes,
+ * fixed HAL_Delay() and read with the shortest sequence:
+ *
+ * 1. the serial reset (32 ones), then the 500 us the ADT7320 needs before the next
+ *    access, timed with the DWT cycle counter instead of a millisecond delay;
+ * 2. a script of register writes, encoded at compile time as ready-to-send SPI
+ *    frames and kept in flash, one transaction per step;
+ * 3. polling of the RDY flag of the status register, so the sample is read as soon
+ *    as the conversion ends rather than after a worst-case wait;
+ * 4. one read of the temperature register.
+ *
+ * The last script step normally starts the conversion, e.g. a one-shot write:
+ * @code
+ * static const ADT7320_FastBootStepTypeDef boot[] = {
+ *     ADT7320_FASTBOOT_WRITE16(ADT7320_THIGH, 0x2800U),
+ *     ADT7320_FASTBOOT_WRITE8(ADT7320_CONFIG, ADT7320_FASTBOOT_16BIT_ONE_SHOT),
+ * };
+ * status = ADT7320_FastBoot_Run(&sensor, boot, 2U, 300U, &raw, &report);
+ * @endcode
+ *
+ * Every phase is timed and returned in the report, in microseconds, together with the
+ * HAL tick of the first sample (time since HAL_Init()). On Cortex-M0/M0+, which have
+ * no cycle counter, times come from HAL_GetTick() and have 1 ms resolution.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_FASTBOOT_H
+#define ADT7320_FASTBOOT_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Time the ADT7320 needs after a serial reset before it accepts a command, in microseconds */
+#define  ADT7320_FASTBOOT_RESET_US  (500U)
+
+/** @brief ADT7320_CONFIG value for a 16-bit one-shot conversion */
+#define  ADT7320_FASTBOOT_16BIT_ONE_SHOT  (0xA0U)
+
+/** @brief Script step writing an 8-bit register */
+#define  ADT7320_FASTBOOT_WRITE8(reg, value)   { 2U, { (uint8_t)(ADT7320_WRITE | (((reg) & 0x1FU) << 3U)), (uint8_t)(value), 0U } }
+
+/** @brief Script step writing a 16-bit register */
+#define  ADT7320_FASTBOOT_WRITE16(reg, value)  { 3U, { (uint8_t)(ADT7320_WRITE | (((reg) & 0x1FU) << 3U)), \
+                                                       (uint8_t)((value) >> 8U), (uint8_t)(value) } }
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief One precomputed register write.
+ */
+typedef struct
+{
+    uint8_t length;  /**< Bytes to send (2 or 3) */
+    uint8_t tx[3U];  /**< Command byte, then data MSB first */
+} ADT7320_FastBootStepTypeDef;
+
+/**
+ * @brief Phase timings of a fast boot, in microseconds.
+ */
+typedef struct
+{
+    uint32_t resetUs;       /**< Serial reset and post-reset wait */
+    uint32_t scriptUs;      /**< Script writes */
+    uint32_t conversionUs;  /**< Wait for RDY */
+    uint32_t totalUs;       /**< Entry to first sample */
+    uint32_t polls;         /**< Status reads until RDY */
+    uint32_t sampleTick;    /**< HAL tick at the first sample, in ms */
+} ADT7320_FastBootReportTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Resets the sensor, runs the script and returns the first sample as soon as it is ready.
+ *
+ * @param[in]  pConfig    Pointer to the ADT7320 configuration structure.
+ * @param[in]  pScript    Register writes (may be NULL if steps is 0).
+ * @param[in]  steps      Number of script steps.
+ * @param[in]  timeoutMs  Longest wait for RDY, in ms.
+ * @param[out] pRaw       Raw ADT7320_TEMP code of the first sample.
+ * @param[out] pReport    Phase timings (may be NULL).
+ *
+ * @retval ADT7320_OK       Sample returned
+ * @retval ADT7320_ERROR    Invalid parameters or SPI failure
+ * @retval ADT7320_BUSY     SPI peripheral is busy
+ * @retval ADT7320_TIMEOUT  RDY not seen within timeoutMs
+ */
+ADT7320_StatusTypeDef ADT7320_FastBoot_Run(const ADT7320_ConfigTypeDef *pConfig, const ADT7320_FastBootStepTypeDef *pScript, uint8_t steps,
+                                           uint32_t timeoutMs, int16_t *pRaw, ADT7320_FastBootReportTypeDef *pReport);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_FASTBOOT_H */
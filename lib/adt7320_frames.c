@@ -0,0 +1,290 @@
+/**
+ * @file    adt7320_frames.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Double-buffered (N-deep) sweep frames with zero-copy handoff to a consumer.
+ *
+ * @details
+ * The frame of a counter is (counter & (ADT7320_FRAMES_DEPTH - 1)). Frames [tail, head)
+ * are published or held by the consumer; frame head is the one the producer fills. The
+ * depth must be a power of two so the slot sequence stays continuous when the 32-bit
+ * counters wrap.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_frames.h"   /**< Sweep frames interface */
+#include "adt7320_metrics.h"  /**< Metric recording hooks */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Frame mask of the set */
+#define  ADT7320_FRAMES_MASK  (ADT7320_FRAMES_DEPTH - 1U)
+
+#if (ADT7320_FRAMES_DEPTH < 2U)
+    #error "ADT7320_FRAMES_DEPTH must be at least 2"
+#endif
+
+#if ( (ADT7320_FRAMES_DEPTH & ADT7320_FRAMES_MASK) != 0U )
+    #error "ADT7320_FRAMES_DEPTH must be a power of two"
+#endif
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes a frame set.
+ *
+ * @param[out] pFrames  Pointer to the frame set.
+ * @param[in]  notify   Publish notification (may be NULL).
+ *
+ * @retval ADT7320_OK     Frame set ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Init(ADT7320_FramesTypeDef *pFrames, ADT7320_FramesNotifyTypeDef notify)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pFrames == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pFrames->head    = 0U;
+        pFrames->tail    = 0U;
+        pFrames->dropped = 0U;
+        pFrames->notify  = notify;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Gives the producer the next free frame to fill.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ * @param[out]    ppFrame  Frame to fill.
+ *
+ * @retval ADT7320_OK     Frame available
+ * @retval ADT7320_BUSY   No free frame, sweep dropped
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Begin(ADT7320_FramesTypeDef *pFrames, ADT7320_FrameTypeDef **ppFrame)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t head = 0U;
+
+    if ( (pFrames == NULL) || (ppFrame == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        head = pFrames->head;
+
+        /* Frames [tail, head) belong to the consumer */
+        if ((head - pFrames->tail) >= ADT7320_FRAMES_DEPTH)
+        {
+            pFrames->dropped++;
+            ADT7320_METRIC_INC(ADT7320_METRIC_FRAMES_DROPPED);
+            *ppFrame = NULL;
+            status   = ADT7320_BUSY;
+        }
+        else
+        {
+            *ppFrame = &pFrames->frame[head & ADT7320_FRAMES_MASK];
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Hands the frame obtained from ADT7320_Frames_Begin() to the consumer.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ *
+ * @retval ADT7320_OK     Frame published
+ * @retval ADT7320_ERROR  Invalid parameters or no frame being filled
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Publish(ADT7320_FramesTypeDef *pFrames)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pFrames == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        status = ADT7320_Frames_PublishSeq(pFrames, pFrames->head);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Hands the frame obtained from ADT7320_Frames_Begin() to the consumer with a given sequence number.
+ *
+ * Used when the sequence number comes from outside the frame set, e.g. a sync pulse
+ * counted by several boards.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ * @param[in]     seq      Sequence number of the frame.
+ *
+ * @retval ADT7320_OK     Frame published
+ * @retval ADT7320_ERROR  Invalid parameters or no frame being filled
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_PublishSeq(ADT7320_FramesTypeDef *pFrames, uint32_t seq)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_FrameTypeDef *pFrame = NULL;
+    uint32_t head = 0U;
+
+    if ( (pFrames == NULL) || ((pFrames->head - pFrames->tail) >= ADT7320_FRAMES_DEPTH) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        head   = pFrames->head;
+        pFrame = &pFrames->frame[head & ADT7320_FRAMES_MASK];
+        pFrame->seq = seq;
+
+        /* Frame contents must be visible before the new head */
+        __DMB();
+        pFrames->head = head + 1U;
+        ADT7320_METRIC_MAX(ADT7320_METRIC_FRAMES_DEPTH_MAX, (head + 1U) - pFrames->tail);
+
+        if (pFrames->notify != NULL)
+        {
+            pFrames->notify(pFrame);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Reads every sensor into a free frame and publishes it.
+ *
+ * @param[in,out] pFrames   Pointer to the frame set.
+ * @param[in]     pSensors  Sensor configurations.
+ * @param[in]     count     Number of sensors (<= ADT7320_FRAMES_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Frame published (per-sensor failures are in the frame status)
+ * @retval ADT7320_BUSY   No free frame, sweep dropped
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Sweep(ADT7320_FramesTypeDef *pFrames, const ADT7320_ConfigTypeDef *pSensors, uint8_t count)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_FrameTypeDef *pFrame = NULL;
+    uint16_t data = 0U;
+
+    if ( (pFrames == NULL) || (pSensors == NULL) || (count > ADT7320_FRAMES_MAX_SENSORS) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        status = ADT7320_Frames_Begin(pFrames, &pFrame);
+
+        if (status == ADT7320_OK)
+        {
+            pFrame->tick  = HAL_GetTick();
+            pFrame->count = count;
+
+            for (uint8_t s = 0U; s < count; s++)
+            {
+                data = 0U;
+                pFrame->status[s] = (uint8_t)ADT7320_ReadRegister(&pSensors[s], ADT7320_TEMP, 2U, &data);
+                pFrame->raw[s]    = (int16_t)data;
+            }
+
+            status = ADT7320_Frames_Publish(pFrames);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Gives the consumer the oldest published frame.
+ *
+ * @param[in]  pFrames  Pointer to the frame set.
+ * @param[out] ppFrame  Frame to process; valid until ADT7320_Frames_Release().
+ *
+ * @retval ADT7320_OK     Frame available
+ * @retval ADT7320_BUSY   No published frame
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Take(ADT7320_FramesTypeDef *pFrames, const ADT7320_FrameTypeDef **ppFrame)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t tail = 0U;
+
+    if ( (pFrames == NULL) || (ppFrame == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        tail = pFrames->tail;
+
+        if (pFrames->head == tail)
+        {
+            *ppFrame = NULL;
+            status   = ADT7320_BUSY;
+        }
+        else
+        {
+            /* Frame contents must be read after head */
+            __DMB();
+            *ppFrame = &pFrames->frame[tail & ADT7320_FRAMES_MASK];
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Returns the frame obtained from ADT7320_Frames_Take() to the producer.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ *
+ * @retval ADT7320_OK     Frame released
+ * @retval ADT7320_ERROR  Invalid parameters or no frame held
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Release(ADT7320_FramesTypeDef *pFrames)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t tail = 0U;
+
+    if ( (pFrames == NULL) || (pFrames->head == pFrames->tail) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        tail = pFrames->tail;
+
+        /* Reads of the frame must complete before the producer can reuse it */
+        __DMB();
+        pFrames->tail = tail + 1U;
+    }
+
+    return status;
+}
+
+
+/* adt7320_frames.c */
@@ -0,0 +1,173 @@
+/**
+ * @file    adt7320_frames.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Double-buffered (N-deep) sweep frames with zero-copy handoff to a consumer.
+ *
+ * @details
+ * A sweep writes the readings of every sensor straight into a frame owned by the
+ * module. Once complete the frame is published and the consumer processes it in
+ * place, while the next sweep fills another frame. Nothing is copied and no
+ * critical section is needed:
+ *
+ * - Producer (acquisition task or ISR): ADT7320_Frames_Begin(), fill the frame,
+ *   ADT7320_Frames_Publish(); or simply ADT7320_Frames_Sweep().
+ * - Consumer (processing task): ADT7320_Frames_Take(), read the frame,
+ *   ADT7320_Frames_Release().
+ *
+ * Ownership moves through two free-running counters: @c head is written only by the
+ * producer and @c tail only by the consumer, each with a single word store. A frame is
+ * therefore never visible to the consumer while it is being filled, and never reused
+ * by the producer while the consumer holds it. When every frame is published or held,
+ * the new sweep is dropped and counted.
+ *
+ * An optional notify callback runs after each publish, e.g. to set an RTOS task
+ * notification or event flag.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_FRAMES_H
+#define ADT7320_FRAMES_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Readings of one sweep.
+ */
+typedef struct
+{
+    uint32_t seq;                                 /**< Sweep sequence number */
+    uint32_t tick;                                /**< Tick at the start of the sweep, in ms */
+    uint8_t  count;                               /**< Sensors in the frame */
+    uint8_t  status[ADT7320_FRAMES_MAX_SENSORS];  /**< ADT7320_StatusTypeDef of each read */
+    int16_t  raw[ADT7320_FRAMES_MAX_SENSORS];     /**< Raw ADT7320_TEMP codes */
+} ADT7320_FrameTypeDef;
+
+/**
+ * @brief Publish notification.
+ *
+ * @param pFrame  Frame just published.
+ */
+typedef void (*ADT7320_FramesNotifyTypeDef)(const ADT7320_FrameTypeDef *pFrame);
+
+/**
+ * @brief Frame set shared by one producer and one consumer.
+ */
+typedef struct
+{
+    ADT7320_FrameTypeDef frame[ADT7320_FRAMES_DEPTH];  /**< Frame buffers */
+    volatile uint32_t head;                            /**< Frames published (written by the producer) */
+    volatile uint32_t tail;                            /**< Frames released (written by the consumer) */
+    uint32_t dropped;                                  /**< Sweeps dropped because no frame was free */
+    ADT7320_FramesNotifyTypeDef notify;                /**< Publish notification (may be NULL) */
+} ADT7320_FramesTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes a frame set.
+ *
+ * @param[out] pFrames  Pointer to the frame set.
+ * @param[in]  notify   Publish notification (may be NULL).
+ *
+ * @retval ADT7320_OK     Frame set ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Init(ADT7320_FramesTypeDef *pFrames, ADT7320_FramesNotifyTypeDef notify);
+
+/**
+ * @brief  Gives the producer the next free frame to fill.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ * @param[out]    ppFrame  Frame to fill.
+ *
+ * @retval ADT7320_OK     Frame available
+ * @retval ADT7320_BUSY   No free frame, sweep dropped
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Begin(ADT7320_FramesTypeDef *pFrames, ADT7320_FrameTypeDef **ppFrame);
+
+/**
+ * @brief  Hands the frame obtained from ADT7320_Frames_Begin() to the consumer.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ *
+ * @retval ADT7320_OK     Frame published
+ * @retval ADT7320_ERROR  Invalid parameters or no frame being filled
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Publish(ADT7320_FramesTypeDef *pFrames);
+
+/**
+ * @brief  Hands the frame obtained from ADT7320_Frames_Begin() to the consumer with a given sequence number.
+ *
+ * Used when the sequence number comes from outside the frame set, e.g. a sync pulse
+ * counted by several boards.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ * @param[in]     seq      Sequence number of the frame.
+ *
+ * @retval ADT7320_OK     Frame published
+ * @retval ADT7320_ERROR  Invalid parameters or no frame being filled
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_PublishSeq(ADT7320_FramesTypeDef *pFrames, uint32_t seq);
+
+/**
+ * @brief  Reads every sensor into a free frame and publishes it.
+ *
+ * @param[in,out] pFrames   Pointer to the frame set.
+ * @param[in]     pSensors  Sensor configurations.
+ * @param[in]     count     Number of sensors (<= ADT7320_FRAMES_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Frame published (per-sensor failures are in the frame status)
+ * @retval ADT7320_BUSY   No free frame, sweep dropped
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Sweep(ADT7320_FramesTypeDef *pFrames, const ADT7320_ConfigTypeDef *pSensors, uint8_t count);
+
+/**
+ * @brief  Gives the consumer the oldest published frame.
+ *
+ * @param[in]  pFrames  Pointer to the frame set.
+ * @param[out] ppFrame  Frame to process; valid until ADT7320_Frames_Release().
+ *
+ * @retval ADT7320_OK     Frame available
+ * @retval ADT7320_BUSY   No published frame
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Take(ADT7320_FramesTypeDef *pFrames, const ADT7320_FrameTypeDef **ppFrame);
+
+/**
+ * @brief  Returns the frame obtained from ADT7320_Frames_Take() to the producer.
+ *
+ * @param[in,out] pFrames  Pointer to the frame set.
+ *
+ * @retval ADT7320_OK     Frame released
+ * @retval ADT7320_ERROR  Invalid parameters or no frame held
+ */
+ADT7320_StatusTypeDef ADT7320_Frames_Release(ADT7320_FramesTypeDef *pFrames);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_FRAMES_H */
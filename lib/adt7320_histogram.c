@@ -0,0 +1,467 @@
+/**
+ * @file    adt7320_histogram.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Fixed-bin temperature histogram and P² streaming quantile estimator.
+ *
+ * @details
+ * The P² implementation follows the original algorithm with 1-based marker positions.
+ * Desired positions are tracked in Q16 so that quantiles such as 0.95 advance exactly.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_histogram.h"  /**< Histogram interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief 1.0 in Q16 */
+#define  ADT7320_Q16_ONE  (65536UL)
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Stores a 32-bit value in little-endian order.
+ *
+ * @param[out] pBuf   Destination.
+ * @param[in]  value  Value to store.
+ */
+static void ADT7320_Hist_Put32(uint8_t *pBuf, uint32_t value)
+{
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        pBuf[i] = (uint8_t)(value >> (8U * i));
+    }
+}
+
+/**
+ * @brief  Desired-position increment of a P² marker, Q16.
+ *
+ * @param[in] quantile  Tracked quantile, Q16.
+ * @param[in] marker    Marker index (0 .. 4).
+ *
+ * @return Increment per sample, Q16.
+ */
+static uint32_t ADT7320_Quantile_Step(uint32_t quantile, uint8_t marker)
+{
+    /* dn = {0, p/2, p, (1 + p)/2, 1} */
+    static const uint8_t num[5U] = {0U, 1U, 2U, 1U, 0U};  /* multiples of p ...       */
+    static const uint8_t off[5U] = {0U, 0U, 0U, 1U, 2U};  /* ... plus multiples of 1, */
+                                                          /* all divided by 2         */
+    return ((num[marker] * quantile) + (off[marker] * ADT7320_Q16_ONE)) / 2U;
+}
+
+/**
+ * @brief  Piecewise-parabolic prediction of a marker height.
+ *
+ * @param[in] pQ  Pointer to the estimator.
+ * @param[in] i   Marker index (1 .. 3).
+ * @param[in] d   Direction of the adjustment (+1 or -1).
+ *
+ * @return Predicted height, raw code Q8.
+ */
+static int32_t ADT7320_Quantile_Parabolic(const ADT7320_QuantileTypeDef *pQ, uint8_t i, int32_t d)
+{
+    int64_t t1 = ((int64_t)(pQ->n[i] - pQ->n[i - 1U] + d) * (pQ->q[i + 1U] - pQ->q[i])) / (pQ->n[i + 1U] - pQ->n[i]);
+    int64_t t2 = ((int64_t)(pQ->n[i + 1U] - pQ->n[i] - d) * (pQ->q[i] - pQ->q[i - 1U])) / (pQ->n[i] - pQ->n[i - 1U]);
+
+    return pQ->q[i] + (int32_t)(((int64_t)d * (t1 + t2)) / (pQ->n[i + 1U] - pQ->n[i - 1U]));
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Clears a histogram and sets its layout.
+ *
+ * @param[out] pHist     Pointer to the histogram.
+ * @param[in]  minRaw    Raw code at the lower edge of bin 0.
+ * @param[in]  binWidth  Bin width, in LSB (at least 1).
+ *
+ * @retval ADT7320_OK     Histogram ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Init(ADT7320_HistTypeDef *pHist, int16_t minRaw, uint16_t binWidth)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pHist == NULL) || (binWidth == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pHist->minRaw    = minRaw;
+        pHist->binWidth  = binWidth;
+        pHist->underflow = 0U;
+        pHist->overflow  = 0U;
+
+        for (uint16_t b = 0U; b < ADT7320_HIST_BINS; b++)
+        {
+            pHist->bin[b] = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Counts one raw sample.
+ *
+ * @param[in,out] pHist  Pointer to the histogram.
+ * @param[in]     raw    Raw ADT7320_TEMP code.
+ */
+void ADT7320_Hist_Add(ADT7320_HistTypeDef *pHist, int16_t raw)
+{
+    int32_t  offset = (int32_t)raw - (int32_t)pHist->minRaw;
+    uint32_t bin    = 0U;
+
+    if (offset < 0)
+    {
+        pHist->underflow++;
+    }
+    else
+    {
+        bin = (uint32_t)offset / pHist->binWidth;
+
+        if (bin >= ADT7320_HIST_BINS)
+        {
+            pHist->overflow++;
+        }
+        else
+        {
+            pHist->bin[bin]++;
+        }
+    }
+}
+
+/**
+ * @brief  Counts the samples within [lowRaw, highRaw], at bin resolution.
+ *
+ * Multiplied by the sampling period, this gives the time spent in a temperature band.
+ *
+ * @param[in]  pHist    Pointer to the histogram.
+ * @param[in]  lowRaw   Lower bound of the band (raw code).
+ * @param[in]  highRaw  Upper bound of the band (raw code).
+ * @param[out] pCount   Samples whose bin lies inside the band.
+ *
+ * @retval ADT7320_OK     Count returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_CountInBand(const ADT7320_HistTypeDef *pHist, int16_t lowRaw, int16_t highRaw, uint32_t *pCount)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t count = 0U;
+    int32_t  edge  = 0;
+
+    if ( (pHist == NULL) || (pCount == NULL) || (lowRaw > highRaw) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint16_t b = 0U; b < ADT7320_HIST_BINS; b++)
+        {
+            edge = (int32_t)pHist->minRaw + ((int32_t)b * (int32_t)pHist->binWidth);
+
+            if ( (edge >= (int32_t)lowRaw) && ((edge + (int32_t)pHist->binWidth - 1) <= (int32_t)highRaw) )
+            {
+                count += pHist->bin[b];
+            }
+        }
+        *pCount = count;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Estimates a percentile from the histogram.
+ *
+ * @param[in]  pHist     Pointer to the histogram.
+ * @param[in]  permille  Percentile in 1/1000 (e.g. 950 for p95).
+ * @param[out] pRaw      Upper edge of the bin holding the percentile (raw code).
+ *
+ * @retval ADT7320_OK     Percentile returned
+ * @retval ADT7320_ERROR  Invalid parameters or empty histogram
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Percentile(const ADT7320_HistTypeDef *pHist, uint16_t permille, int16_t *pRaw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint64_t total  = 0U;
+    uint64_t target = 0U;
+    uint64_t seen   = 0U;
+    int32_t  edge   = 0;
+
+    if ( (pHist == NULL) || (pRaw == NULL) || (permille > 1000U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        total = (uint64_t)pHist->underflow + pHist->overflow;
+        for (uint16_t b = 0U; b < ADT7320_HIST_BINS; b++)
+        {
+            total += pHist->bin[b];
+        }
+
+        if (total == 0U)
+        {
+            status = ADT7320_ERROR;
+        }
+    }
+
+    if (status == ADT7320_OK)
+    {
+        target = ((total * permille) + 999U) / 1000U;
+        seen   = pHist->underflow;
+        edge   = (int32_t)pHist->minRaw - 1;
+
+        for (uint16_t b = 0U; (b < ADT7320_HIST_BINS) && (seen < target); b++)
+        {
+            seen += pHist->bin[b];
+            edge  = (int32_t)pHist->minRaw + (((int32_t)b + 1) * (int32_t)pHist->binWidth) - 1;
+        }
+
+        if (seen < target)
+        {
+            edge = INT16_MAX;
+        }
+
+        *pRaw = (int16_t)((edge > INT16_MAX) ? INT16_MAX : ((edge < INT16_MIN) ? INT16_MIN : edge));
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Adds the counts of one histogram into another with the same layout.
+ *
+ * @param[in,out] pDst  Destination histogram.
+ * @param[in]     pSrc  Source histogram.
+ *
+ * @retval ADT7320_OK     Histograms merged
+ * @retval ADT7320_ERROR  Invalid parameters or different layouts
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Merge(ADT7320_HistTypeDef *pDst, const ADT7320_HistTypeDef *pSrc)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pDst == NULL) || (pSrc == NULL) || (pDst->minRaw != pSrc->minRaw) || (pDst->binWidth != pSrc->binWidth) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint16_t b = 0U; b < ADT7320_HIST_BINS; b++)
+        {
+            pDst->bin[b] += pSrc->bin[b];
+        }
+        pDst->underflow += pSrc->underflow;
+        pDst->overflow  += pSrc->overflow;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Writes a little-endian snapshot of the histogram.
+ *
+ * @param[in]  pHist  Pointer to the histogram.
+ * @param[out] pBuf   Destination buffer.
+ * @param[in]  size   Size of @p pBuf (at least ADT7320_HIST_EXPORT_SIZE).
+ *
+ * @retval ADT7320_OK     Snapshot written (ADT7320_HIST_EXPORT_SIZE bytes)
+ * @retval ADT7320_ERROR  Invalid parameters or buffer too small
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Export(const ADT7320_HistTypeDef *pHist, uint8_t *pBuf, uint16_t size)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pHist == NULL) || (pBuf == NULL) || (size < ADT7320_HIST_EXPORT_SIZE) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pBuf[0U] = (uint8_t)((uint16_t)pHist->minRaw);
+        pBuf[1U] = (uint8_t)((uint16_t)pHist->minRaw >> 8U);
+        pBuf[2U] = (uint8_t)pHist->binWidth;
+        pBuf[3U] = (uint8_t)(pHist->binWidth >> 8U);
+        pBuf[4U] = (uint8_t)ADT7320_HIST_BINS;
+        pBuf[5U] = (uint8_t)(ADT7320_HIST_BINS >> 8U);
+        ADT7320_Hist_Put32(&pBuf[6U], pHist->underflow);
+        ADT7320_Hist_Put32(&pBuf[10U], pHist->overflow);
+
+        for (uint16_t b = 0U; b < ADT7320_HIST_BINS; b++)
+        {
+            ADT7320_Hist_Put32(&pBuf[14U + (4U * b)], pHist->bin[b]);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Initializes a P² estimator.
+ *
+ * @param[out] pQ        Pointer to the estimator.
+ * @param[in]  permille  Quantile to track in 1/1000 (1 .. 999).
+ *
+ * @retval ADT7320_OK     Estimator ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Quantile_Init(ADT7320_QuantileTypeDef *pQ, uint16_t permille)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pQ == NULL) || (permille == 0U) || (permille >= 1000U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pQ->quantile = ((uint32_t)permille * ADT7320_Q16_ONE) / 1000U;
+        pQ->count    = 0U;
+
+        for (uint8_t i = 0U; i < 5U; i++)
+        {
+            pQ->q[i]  = 0;
+            pQ->n[i]  = (int32_t)i + 1;
+            pQ->np[i] = ADT7320_Q16_ONE + (4U * ADT7320_Quantile_Step(pQ->quantile, i));
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Feeds one raw sample into a P² estimator.
+ *
+ * @param[in,out] pQ   Pointer to the estimator.
+ * @param[in]     raw  Raw ADT7320_TEMP code.
+ */
+void ADT7320_Quantile_Add(ADT7320_QuantileTypeDef *pQ, int16_t raw)
+{
+    int32_t x = (int32_t)raw * 256;
+    uint8_t k = 0U;
+    int32_t d = 0;
+    int32_t h = 0;
+
+    if (pQ->count < 5U)
+    {
+        /* Insertion sort of the first five samples */
+        k = (uint8_t)pQ->count;
+        while ( (k > 0U) && (pQ->q[k - 1U] > x) )
+        {
+            pQ->q[k] = pQ->q[k - 1U];
+            k--;
+        }
+        pQ->q[k] = x;
+    }
+    else
+    {
+        /* Locate the cell of x, extending the extreme markers if needed */
+        if (x < pQ->q[0U])
+        {
+            pQ->q[0U] = x;
+            k = 0U;
+        }
+        else if (x >= pQ->q[4U])
+        {
+            pQ->q[4U] = x;
+            k = 3U;
+        }
+        else
+        {
+            k = 0U;
+            while (x >= pQ->q[k + 1U])
+            {
+                k++;
+            }
+        }
+
+        for (uint8_t i = (uint8_t)(k + 1U); i < 5U; i++)
+        {
+            pQ->n[i]++;
+        }
+        for (uint8_t i = 0U; i < 5U; i++)
+        {
+            pQ->np[i] += ADT7320_Quantile_Step(pQ->quantile, i);
+        }
+
+        /* Adjust the three middle markers */
+        for (uint8_t i = 1U; i < 4U; i++)
+        {
+            d = (int32_t)((int64_t)pQ->np[i] - ((int64_t)pQ->n[i] * (int64_t)ADT7320_Q16_ONE));
+
+            if ( ((d >= (int32_t)ADT7320_Q16_ONE) && ((pQ->n[i + 1U] - pQ->n[i]) > 1)) ||
+                 ((d <= -(int32_t)ADT7320_Q16_ONE) && ((pQ->n[i - 1U] - pQ->n[i]) < -1)) )
+            {
+                d = (d > 0) ? 1 : -1;
+                h = ADT7320_Quantile_Parabolic(pQ, i, d);
+
+                if ( (h <= pQ->q[i - 1U]) || (h >= pQ->q[i + 1U]) )
+                {
+                    /* Linear fallback towards the neighbour in direction d */
+                    h = (d > 0) ? (pQ->q[i] + ((pQ->q[i + 1U] - pQ->q[i]) / (pQ->n[i + 1U] - pQ->n[i])))
+                                : (pQ->q[i] - ((pQ->q[i] - pQ->q[i - 1U]) / (pQ->n[i] - pQ->n[i - 1U])));
+                }
+
+                pQ->q[i]  = h;
+                pQ->n[i] += d;
+            }
+        }
+    }
+
+    pQ->count++;
+}
+
+/**
+ * @brief  Returns the current quantile estimate.
+ *
+ * @param[in]  pQ    Pointer to the estimator.
+ * @param[out] pRaw  Estimated quantile (raw code).
+ *
+ * @retval ADT7320_OK     Estimate returned
+ * @retval ADT7320_ERROR  Invalid parameters or no sample yet
+ */
+ADT7320_StatusTypeDef ADT7320_Quantile_Get(const ADT7320_QuantileTypeDef *pQ, int16_t *pRaw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    int32_t  h   = 0;
+    uint32_t idx = 0U;
+
+    if ( (pQ == NULL) || (pRaw == NULL) || (pQ->count == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        if (pQ->count < 5U)
+        {
+            idx = (((pQ->count - 1U) * pQ->quantile) + (ADT7320_Q16_ONE / 2U)) / ADT7320_Q16_ONE;
+            h   = pQ->q[idx];
+        }
+        else
+        {
+            h = pQ->q[2U];
+        }
+
+        *pRaw = (int16_t)((h >= 0) ? ((h + 128) / 256) : ((h - 128) / 256));
+    }
+
+    return status;
+}
+
+
+/* adt7320_histogram.c */
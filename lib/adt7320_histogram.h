@@ -0,0 +1,188 @@
+/**
+ * @file    adt7320_histogram.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Fixed-bin temperature histogram and P² streaming quantile estimator.
+ *
+ * @details
+ * The histogram is keyed directly on the raw ADT7320_TEMP code (1/128 °C per LSB in
+ * 16-bit mode): bin = (raw - minRaw) / binWidth. Adding a sample is O(1) and integer only.
+ * Histograms with the same layout can be merged, and ADT7320_Hist_Export() writes a
+ * little-endian snapshot that a host can decode and sum across devices:
+ *
+ * | Offset | Size          | Field                          |
+ * |--------|---------------|--------------------------------|
+ * | 0      | 2             | minRaw (int16)                 |
+ * | 2      | 2             | binWidth (uint16)              |
+ * | 4      | 2             | bin count (uint16)             |
+ * | 6      | 4             | underflow (uint32)             |
+ * | 10     | 4             | overflow (uint32)              |
+ * | 14     | 4 * bin count | bin counters (uint32)          |
+ *
+ * The P² estimator (Jain & Chlamtac) tracks one quantile with five markers and
+ * no sample storage. Marker heights are kept in raw code Q8.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_HISTOGRAM_H
+#define ADT7320_HISTOGRAM_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Size in bytes of a snapshot written by ADT7320_Hist_Export() */
+#define  ADT7320_HIST_EXPORT_SIZE  (14U + (4U * ADT7320_HIST_BINS))
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Histogram of raw temperature codes.
+ */
+typedef struct
+{
+    int16_t  minRaw;                    /**< Raw code at the lower edge of bin 0 */
+    uint16_t binWidth;                  /**< Bin width, in LSB */
+    uint32_t bin[ADT7320_HIST_BINS];    /**< Sample count per bin */
+    uint32_t underflow;                 /**< Samples below minRaw */
+    uint32_t overflow;                  /**< Samples above the last bin */
+} ADT7320_HistTypeDef;
+
+/**
+ * @brief P² streaming quantile estimator.
+ */
+typedef struct
+{
+    uint32_t quantile;  /**< Tracked quantile, Q16 (e.g. 62259 = 0.95) */
+    uint32_t count;     /**< Number of samples seen */
+    int32_t  q[5];      /**< Marker heights, raw code Q8 */
+    int32_t  n[5];      /**< Marker positions */
+    uint64_t np[5];     /**< Desired marker positions, Q16 (64-bit: no wrap) */
+} ADT7320_QuantileTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Clears a histogram and sets its layout.
+ *
+ * @param[out] pHist     Pointer to the histogram.
+ * @param[in]  minRaw    Raw code at the lower edge of bin 0.
+ * @param[in]  binWidth  Bin width, in LSB (at least 1).
+ *
+ * @retval ADT7320_OK     Histogram ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Init(ADT7320_HistTypeDef *pHist, int16_t minRaw, uint16_t binWidth);
+
+/**
+ * @brief  Counts one raw sample.
+ *
+ * @param[in,out] pHist  Pointer to the histogram.
+ * @param[in]     raw    Raw ADT7320_TEMP code.
+ */
+void ADT7320_Hist_Add(ADT7320_HistTypeDef *pHist, int16_t raw);
+
+/**
+ * @brief  Counts the samples within [lowRaw, highRaw], at bin resolution.
+ *
+ * Multiplied by the sampling period, this gives the time spent in a temperature band.
+ *
+ * @param[in]  pHist    Pointer to the histogram.
+ * @param[in]  lowRaw   Lower bound of the band (raw code).
+ * @param[in]  highRaw  Upper bound of the band (raw code).
+ * @param[out] pCount   Samples whose bin lies inside the band.
+ *
+ * @retval ADT7320_OK     Count returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_CountInBand(const ADT7320_HistTypeDef *pHist, int16_t lowRaw, int16_t highRaw, uint32_t *pCount);
+
+/**
+ * @brief  Estimates a percentile from the histogram.
+ *
+ * @param[in]  pHist     Pointer to the histogram.
+ * @param[in]  permille  Percentile in 1/1000 (e.g. 950 for p95).
+ * @param[out] pRaw      Upper edge of the bin holding the percentile (raw code).
+ *
+ * @retval ADT7320_OK     Percentile returned
+ * @retval ADT7320_ERROR  Invalid parameters or empty histogram
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Percentile(const ADT7320_HistTypeDef *pHist, uint16_t permille, int16_t *pRaw);
+
+/**
+ * @brief  Adds the counts of one histogram into another with the same layout.
+ *
+ * @param[in,out] pDst  Destination histogram.
+ * @param[in]     pSrc  Source histogram.
+ *
+ * @retval ADT7320_OK     Histograms merged
+ * @retval ADT7320_ERROR  Invalid parameters or different layouts
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Merge(ADT7320_HistTypeDef *pDst, const ADT7320_HistTypeDef *pSrc);
+
+/**
+ * @brief  Writes a little-endian snapshot of the histogram.
+ *
+ * @param[in]  pHist  Pointer to the histogram.
+ * @param[out] pBuf   Destination buffer.
+ * @param[in]  size   Size of @p pBuf (at least ADT7320_HIST_EXPORT_SIZE).
+ *
+ * @retval ADT7320_OK     Snapshot written (ADT7320_HIST_EXPORT_SIZE bytes)
+ * @retval ADT7320_ERROR  Invalid parameters or buffer too small
+ */
+ADT7320_StatusTypeDef ADT7320_Hist_Export(const ADT7320_HistTypeDef *pHist, uint8_t *pBuf, uint16_t size);
+
+/**
+ * @brief  Initializes a P² estimator.
+ *
+ * @param[out] pQ        Pointer to the estimator.
+ * @param[in]  permille  Quantile to track in 1/1000 (1 .. 999).
+ *
+ * @retval ADT7320_OK     Estimator ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Quantile_Init(ADT7320_QuantileTypeDef *pQ, uint16_t permille);
+
+/**
+ * @brief  Feeds one raw sample into a P² estimator.
+ *
+ * @param[in,out] pQ   Pointer to the estimator.
+ * @param[in]     raw  Raw ADT7320_TEMP code.
+ */
+void ADT7320_Quantile_Add(ADT7320_QuantileTypeDef *pQ, int16_t raw);
+
+/**
+ * @brief  Returns the current quantile estimate.
+ *
+ * @param[in]  pQ    Pointer to the estimator.
+ * @param[out] pRaw  Estimated quantile (raw code).
+ *
+ * @retval ADT7320_OK     Estimate returned
+ * @retval ADT7320_ERROR  Invalid parameters or no sample yet
+ */
+ADT7320_StatusTypeDef ADT7320_Quantile_Get(const ADT7320_QuantileTypeDef *pQ, int16_t *pRaw);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_HISTOGRAM_H */
@@ -0,0 +1,304 @@
+/**
+ * @file    adt7320_metrics.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Compile-time metrics registry with a text shell for ADT7320 driver counters.
+ *
+ * @details
+ * Output lines are formatted into a small stack buffer without printf, so the shell
+ * does not pull the C library formatter into the image.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>            /**< strlen(), strncmp() */
+#include "adt7320_metrics.h"  /**< Metrics registry interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Prefix of every exported name */
+#define  ADT7320_METRICS_PREFIX  "adt7320_"
+
+/** @brief Size of the line buffer */
+#define  ADT7320_METRICS_LINE  (96U)
+
+/** @brief Expands a registry entry to its exported name */
+#define  ADT7320_METRIC_NAME(id, type, name, help)  ADT7320_METRICS_PREFIX name,
+
+/** @brief Expands a registry entry to its help string */
+#define  ADT7320_METRIC_HELP(id, type, name, help)  help,
+
+/** @brief Expands a registry entry to its type string */
+#define  ADT7320_METRIC_TYPE(id, type, name, help)  ADT7320_METRICS_TYPE_##type,
+
+#define  ADT7320_METRICS_TYPE_COUNTER  "counter"  ///< Prometheus type of counters
+#define  ADT7320_METRICS_TYPE_GAUGE    "gauge"    ///< Prometheus type of gauges
+
+
+/* ------------------------------- Private Variables -------------------------------- */
+
+/** @brief Exported names */
+static const char * const ADT7320_Metrics_Name[ADT7320_METRIC_COUNT] = { ADT7320_METRICS_LIST(ADT7320_METRIC_NAME) };
+
+/** @brief Help strings */
+static const char * const ADT7320_Metrics_Help[ADT7320_METRIC_COUNT] = { ADT7320_METRICS_LIST(ADT7320_METRIC_HELP) };
+
+/** @brief Type strings */
+static const char * const ADT7320_Metrics_Type[ADT7320_METRIC_COUNT] = { ADT7320_METRICS_LIST(ADT7320_METRIC_TYPE) };
+
+
+/* -------------------------------- Public Variables -------------------------------- */
+
+/** @brief Metric values, indexed by ADT7320_MetricIdTypeDef */
+volatile uint32_t ADT7320_Metrics_Value[ADT7320_METRIC_COUNT];
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Appends a string to the line buffer, truncating at its end.
+ *
+ * @param[in,out] pLine  Line buffer of ADT7320_METRICS_LINE bytes.
+ * @param[in]     pos    Current length.
+ * @param[in]     pText  Null-terminated text.
+ *
+ * @return New length.
+ */
+static uint16_t ADT7320_Metrics_Append(char *pLine, uint16_t pos, const char *pText)
+{
+    uint16_t len = pos;
+
+    for (uint16_t i = 0U; (pText[i] != '\0') && (len < ADT7320_METRICS_LINE); i++)
+    {
+        pLine[len] = pText[i];
+        len++;
+    }
+
+    return len;
+}
+
+/**
+ * @brief  Appends an unsigned decimal number to the line buffer.
+ *
+ * @param[in,out] pLine  Line buffer of ADT7320_METRICS_LINE bytes.
+ * @param[in]     pos    Current length.
+ * @param[in]     value  Number.
+ *
+ * @return New length.
+ */
+static uint16_t ADT7320_Metrics_AppendU32(char *pLine, uint16_t pos, uint32_t value)
+{
+    char     digit[11U];
+    uint8_t  first = 10U;
+    uint32_t v     = value;
+
+    digit[10U] = '\0';
+
+    do
+    {
+        first--;
+        digit[first] = (char)('0' + (v % 10U));
+        v /= 10U;
+    } while (v != 0U);
+
+    return ADT7320_Metrics_Append(pLine, pos, &digit[first]);
+}
+
+/**
+ * @brief  Finds a metric by exported name.
+ *
+ * @param[in] pName  Name (not necessarily null-terminated).
+ * @param[in] len    Name length.
+ *
+ * @return Metric identifier, or ADT7320_METRIC_COUNT if unknown.
+ */
+static uint32_t ADT7320_Metrics_Find(const char *pName, size_t len)
+{
+    uint32_t found = (uint32_t)ADT7320_METRIC_COUNT;
+
+    for (uint32_t m = 0U; (m < (uint32_t)ADT7320_METRIC_COUNT) && (found == (uint32_t)ADT7320_METRIC_COUNT); m++)
+    {
+        if ( (strlen(ADT7320_Metrics_Name[m]) == len) && (strncmp(ADT7320_Metrics_Name[m], pName, len) == 0) )
+        {
+            found = m;
+        }
+    }
+
+    return found;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Clears every metric and starts the DWT cycle counter when available.
+ */
+void ADT7320_Metrics_Init(void)
+{
+    for (uint32_t m = 0U; m < (uint32_t)ADT7320_METRIC_COUNT; m++)
+    {
+        ADT7320_Metrics_Value[m] = 0U;
+    }
+
+    ADT7320_DWT_Enable();
+}
+
+/**
+ * @brief  Records a finished SPI transaction (called through ADT7320_METRIC_SPI()).
+ *
+ * @param[in] status  Result of the transaction.
+ * @param[in] start   ADT7320_METRIC_NOW() taken before the transaction.
+ */
+void ADT7320_Metrics_RecordSpi(ADT7320_StatusTypeDef status, uint32_t start)
+{
+#if (ADT7320_METRICS_ENABLE == 1U)
+    uint32_t elapsed = ADT7320_METRIC_NOW() - start;
+
+    ADT7320_METRIC_INC(ADT7320_METRIC_SPI_TRANSACTIONS);
+    ADT7320_METRIC_MAX(ADT7320_METRIC_SPI_LATENCY_MAX, elapsed);
+
+    if (status == ADT7320_ERROR)
+    {
+        ADT7320_METRIC_INC(ADT7320_METRIC_SPI_ERRORS);
+    }
+    else if (status == ADT7320_BUSY)
+    {
+        ADT7320_METRIC_INC(ADT7320_METRIC_SPI_BUSY);
+    }
+    else if (status == ADT7320_TIMEOUT)
+    {
+        ADT7320_METRIC_INC(ADT7320_METRIC_SPI_TIMEOUTS);
+    }
+    else
+    {
+        /* Successful transaction */
+    }
+#else
+    (void)status;
+    (void)start;
+#endif
+}
+
+/**
+ * @brief  Writes every metric in Prometheus text format.
+ *
+ * @param[in] write     Output function.
+ * @param[in] pContext  Context passed to write (may be NULL).
+ *
+ * @retval ADT7320_OK     Metrics written
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Metrics_Dump(ADT7320_MetricsWriteTypeDef write, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    char     line[ADT7320_METRICS_LINE];
+    uint16_t len = 0U;
+
+    if (write == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint32_t m = 0U; m < (uint32_t)ADT7320_METRIC_COUNT; m++)
+        {
+            len = ADT7320_Metrics_Append(line, 0U, "# HELP ");
+            len = ADT7320_Metrics_Append(line, len, ADT7320_Metrics_Name[m]);
+            len = ADT7320_Metrics_Append(line, len, " ");
+            len = ADT7320_Metrics_Append(line, len, ADT7320_Metrics_Help[m]);
+            len = ADT7320_Metrics_Append(line, len, "\n");
+            write(pContext, line, len);
+
+            len = ADT7320_Metrics_Append(line, 0U, "# TYPE ");
+            len = ADT7320_Metrics_Append(line, len, ADT7320_Metrics_Name[m]);
+            len = ADT7320_Metrics_Append(line, len, " ");
+            len = ADT7320_Metrics_Append(line, len, ADT7320_Metrics_Type[m]);
+            len = ADT7320_Metrics_Append(line, len, "\n");
+            write(pContext, line, len);
+
+            len = ADT7320_Metrics_Append(line, 0U, ADT7320_Metrics_Name[m]);
+            len = ADT7320_Metrics_Append(line, len, " ");
+            len = ADT7320_Metrics_AppendU32(line, len, ADT7320_Metrics_Value[m]);
+            len = ADT7320_Metrics_Append(line, len, "\n");
+            write(pContext, line, len);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Executes one shell command line.
+ *
+ * @param[in] pLine     Command line (null-terminated; trailing CR/LF and spaces are ignored).
+ * @param[in] write     Output function.
+ * @param[in] pContext  Context passed to write (may be NULL).
+ *
+ * @retval ADT7320_OK     Command executed
+ * @retval ADT7320_ERROR  Invalid parameters or unknown command / metric
+ */
+ADT7320_StatusTypeDef ADT7320_Metrics_Shell(const char *pLine, ADT7320_MetricsWriteTypeDef write, void *pContext)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    size_t   len = 0U;
+    uint32_t m   = 0U;
+
+    if ( (pLine == NULL) || (write == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        len = strlen(pLine);
+        while ( (len > 0U) && ( (pLine[len - 1U] == '\r') || (pLine[len - 1U] == '\n') || (pLine[len - 1U] == ' ') ) )
+        {
+            len--;
+        }
+
+        if ( (len == 7U) && (strncmp(pLine, "metrics", 7U) == 0) )
+        {
+            status = ADT7320_Metrics_Dump(write, pContext);
+        }
+        else if ( (len == 5U) && (strncmp(pLine, "reset", 5U) == 0) )
+        {
+            for (m = 0U; m < (uint32_t)ADT7320_METRIC_COUNT; m++)
+            {
+                ADT7320_Metrics_Value[m] = 0U;
+            }
+            write(pContext, "OK\n", 3U);
+        }
+        else if ( (len > 6U) && (strncmp(pLine, "reset ", 6U) == 0) )
+        {
+            m = ADT7320_Metrics_Find(&pLine[6U], len - 6U);
+
+            if (m < (uint32_t)ADT7320_METRIC_COUNT)
+            {
+                ADT7320_Metrics_Value[m] = 0U;
+                write(pContext, "OK\n", 3U);
+            }
+            else
+            {
+                write(pContext, "ERR unknown metric\n", 19U);
+                status = ADT7320_ERROR;
+            }
+        }
+        else
+        {
+            write(pContext, "ERR unknown command\n", 20U);
+            status = ADT7320_ERROR;
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_metrics.c */
@@ -0,0 +1,295 @@
+/**
+ * @file    adt7320_metrics.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Compile-time metrics registry with a text shell for ADT7320 driver counters.
+ *
+ * @details
+ * Every metric is declared once in ADT7320_METRICS_LIST; the list generates the metric
+ * identifiers, names, help strings and types. Values are 32-bit words in one static
+ * table. The same metric is recorded from thread code and from interrupt handlers (e.g.
+ * the async completion path), so counters and gauges are updated with an exclusive
+ * load/store loop (LDREX/STREX) on Cortex-M3 and above, and with interrupts masked for
+ * a few cycles on Cortex-M0/M0+; no update is lost. Reads and resets from the shell may
+ * run anywhere.
+ *
+ * Driver modules record through the ADT7320_METRIC_* macros, which compile to nothing
+ * unless ADT7320_METRICS_ENABLE is 1U in adt7320_config.h.
+ *
+ * ADT7320_Metrics_Shell() handles one command line received over a UART and writes the
+ * answer through an application-supplied function:
+ * - @c metrics        dumps every metric in Prometheus text format
+ * - @c reset          clears every metric
+ * - @c reset <name>   clears one metric (full name, e.g. adt7320_spi_errors_total)
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_METRICS_H
+#define ADT7320_METRICS_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/**
+ * @brief Metric registry: X(id, type, name, help).
+ *
+ * Names are exported with the "adt7320_" prefix. Latencies are in CPU cycles and are
+ * only recorded on cores with a DWT cycle counter.
+ */
+#define  ADT7320_METRICS_LIST(X)                                                                                \
+    X(SPI_TRANSACTIONS,   COUNTER, "spi_transactions_total",  "SPI transactions issued")                        \
+    X(SPI_ERRORS,         COUNTER, "spi_errors_total",        "SPI transactions that failed")                   \
+    X(SPI_BUSY,           COUNTER, "spi_busy_total",          "SPI transactions rejected as busy")              \
+    X(SPI_TIMEOUTS,       COUNTER, "spi_timeouts_total",      "SPI transactions that timed out")                \
+    X(SPI_LATENCY_MAX,    GAUGE,   "spi_latency_max_cycles",  "Longest SPI transaction, in cycles")             \
+    X(ASYNC_TIMEOUTS,     COUNTER, "async_timeouts_total",    "Async operations aborted (deadline or cancel)")  \
+    X(PREDICTOR_HITS,     COUNTER, "predictor_hits_total",    "Reads answered by the predictor")                \
+    X(DUALCORE_DEPTH_MAX, GAUGE,   "dualcore_depth_max",      "Deepest dual-core ring fill, in records")        \
+    X(EVENTLOG_DEPTH_MAX, GAUGE,   "eventlog_depth_max",      "Deepest event log fill, in records")             \
+    X(FRAMES_DEPTH_MAX,   GAUGE,   "frames_depth_max",        "Deepest sweep frame fill, in frames")            \
+    X(FRAMES_DROPPED,     COUNTER, "frames_dropped_total",    "Sweeps dropped with every frame taken")          \
+    X(SYNC_MISSED,        COUNTER, "sync_missed_total",       "Sync pulses without a sweep of their own")       \
+    X(SYNC_DEFERRED,      COUNTER, "sync_deferred_total",     "Sync pulses deferred behind a transfer")         \
+    X(BUSMODE_SWITCHES,   COUNTER, "busmode_switches_total",  "SPI mode switches")
+
+/**
+ * @brief Non-zero when the core provides the DWT cycle counter (Cortex-M3 and above).
+ *
+ * Shared by every module that times with DWT->CYCCNT; the counter only runs after
+ * ADT7320_DWT_Enable().
+ */
+#if defined (__CORTEX_M) && (__CORTEX_M >= 3U)
+    #define  ADT7320_HAS_DWT  (1U)
+#else
+    #define  ADT7320_HAS_DWT  (0U)
+#endif
+
+/** @brief Non-zero when the core has exclusive load/store (LDREX/STREX) */
+#if defined (__CORTEX_M) && (__CORTEX_M >= 3U)
+    #define  ADT7320_HAS_LDREX  (1U)
+#else
+    #define  ADT7320_HAS_LDREX  (0U)
+#endif
+
+/** @brief Expands a registry entry to its identifier */
+#define  ADT7320_METRIC_ID(id, type, name, help)  ADT7320_METRIC_##id,
+
+#if (ADT7320_METRICS_ENABLE == 1U)
+
+    /** @brief Current cycle count, or 0 on cores without DWT */
+    #if (ADT7320_HAS_DWT == 1U)
+        #define  ADT7320_METRIC_NOW()  (DWT->CYCCNT)
+    #else
+        #define  ADT7320_METRIC_NOW()  (0U)
+    #endif
+
+    /** @brief Increments a counter (safe from thread and interrupt context) */
+    #define  ADT7320_METRIC_INC(id)  ADT7320_Metrics_Inc(&ADT7320_Metrics_Value[(id)])
+
+    /** @brief Adds to a counter (safe from thread and interrupt context) */
+    #define  ADT7320_METRIC_ADD(id, value)  ADT7320_Metrics_Add(&ADT7320_Metrics_Value[(id)], (uint32_t)(value))
+
+    /** @brief Raises a gauge to a new maximum (safe from thread and interrupt context) */
+    #define  ADT7320_METRIC_MAX(id, value)  ADT7320_Metrics_Max(&ADT7320_Metrics_Value[(id)], (uint32_t)(value))
+
+    /** @brief Records a finished SPI transaction */
+    #define  ADT7320_METRIC_SPI(status, start)  ADT7320_Metrics_RecordSpi((status), (start))
+
+#else
+
+    #define  ADT7320_METRIC_NOW()               (0U)
+    #define  ADT7320_METRIC_INC(id)             ((void)0)
+    #define  ADT7320_METRIC_ADD(id, value)      ((void)(value))
+    #define  ADT7320_METRIC_MAX(id, value)      ((void)(value))
+    #define  ADT7320_METRIC_SPI(status, start)  ((void)(start))
+
+#endif  /* ADT7320_METRICS_ENABLE */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Metric identifiers.
+ */
+typedef enum
+{
+    ADT7320_METRICS_LIST(ADT7320_METRIC_ID)
+    ADT7320_METRIC_COUNT  /**< Number of metrics */
+} ADT7320_MetricIdTypeDef;
+
+/**
+ * @brief Output function of the shell (e.g. a wrapper of HAL_UART_Transmit()).
+ *
+ * @param pContext  Context given to ADT7320_Metrics_Shell().
+ * @param pText     Text to send (not null-terminated).
+ * @param len       Text length, in bytes.
+ */
+typedef void (*ADT7320_MetricsWriteTypeDef)(void *pContext, const char *pText, uint16_t len);
+
+
+/* ------------------------------------ Variables ------------------------------------ */
+
+/** @brief Metric values, indexed by ADT7320_MetricIdTypeDef */
+extern volatile uint32_t ADT7320_Metrics_Value[ADT7320_METRIC_COUNT];
+
+
+/* -------------------------------- Inline Functions -------------------------------- */
+
+/**
+ * @brief  Starts the DWT cycle counter (TRCENA, then CYCCNTENA); no-op without DWT.
+ */
+static inline void ADT7320_DWT_Enable(void)
+{
+#if (ADT7320_HAS_DWT == 1U)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+ * @brief  Atomically increments a metric value.
+ *
+ * An interrupt between LDREX and STREX clears the exclusive monitor, so the STREX
+ * fails and the increment is retried on the new value.
+ *
+ * @param[in,out] pValue  Metric value.
+ */
+static inline void ADT7320_Metrics_Inc(volatile uint32_t *pValue)
+{
+#if (ADT7320_HAS_LDREX == 1U)
+    uint32_t value = 0U;
+
+    do
+    {
+        value = __LDREXW(pValue) + 1U;
+    } while (__STREXW(value, pValue) != 0U);
+#else
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *pValue += 1U;
+    __set_PRIMASK(primask);
+#endif
+}
+
+/**
+ * @brief  Atomically adds to a metric value.
+ *
+ * @param[in,out] pValue  Metric value.
+ * @param[in]     value   Amount to add.
+ */
+static inline void ADT7320_Metrics_Add(volatile uint32_t *pValue, uint32_t value)
+{
+#if (ADT7320_HAS_LDREX == 1U)
+    uint32_t sum = 0U;
+
+    do
+    {
+        sum = __LDREXW(pValue) + value;
+    } while (__STREXW(sum, pValue) != 0U);
+#else
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *pValue += value;
+    __set_PRIMASK(primask);
+#endif
+}
+
+/**
+ * @brief  Atomically raises a metric value to a new maximum.
+ *
+ * @param[in,out] pValue  Metric value.
+ * @param[in]     value   Candidate maximum.
+ */
+static inline void ADT7320_Metrics_Max(volatile uint32_t *pValue, uint32_t value)
+{
+#if (ADT7320_HAS_LDREX == 1U)
+    uint8_t stored = 0U;
+
+    while (stored == 0U)
+    {
+        if (value <= __LDREXW(pValue))
+        {
+            __CLREX();
+            stored = 1U;
+        }
+        else
+        {
+            stored = (uint8_t)(__STREXW(value, pValue) == 0U);
+        }
+    }
+#else
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (value > *pValue)
+    {
+        *pValue = value;
+    }
+    __set_PRIMASK(primask);
+#endif
+}
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Clears every metric and starts the DWT cycle counter when available.
+ */
+void ADT7320_Metrics_Init(void);
+
+/**
+ * @brief  Records a finished SPI transaction (called through ADT7320_METRIC_SPI()).
+ *
+ * @param[in] status  Result of the transaction.
+ * @param[in] start   ADT7320_METRIC_NOW() taken before the transaction.
+ */
+void ADT7320_Metrics_RecordSpi(ADT7320_StatusTypeDef status, uint32_t start);
+
+/**
+ * @brief  Writes every metric in Prometheus text format.
+ *
+ * @param[in] write     Output function.
+ * @param[in] pContext  Context passed to write (may be NULL).
+ *
+ * @retval ADT7320_OK     Metrics written
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Metrics_Dump(ADT7320_MetricsWriteTypeDef write, void *pContext);
+
+/**
+ * @brief  Executes one shell command line.
+ *
+ * @param[in] pLine     Command line (null-terminated; trailing CR/LF and spaces are ignored).
+ * @param[in] write     Output function.
+ * @param[in] pContext  Context passed to write (may be NULL).
+ *
+ * @retval ADT7320_OK     Command executed
+ * @retval ADT7320_ERROR  Invalid parameters or unknown command / metric
+ */
+ADT7320_StatusTypeDef ADT7320_Metrics_Shell(const char *pLine, ADT7320_MetricsWriteTypeDef write, void *pContext);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_METRICS_H */
@@ -0,0 +1,312 @@
+/**
+ * @file    adt7320_modbus.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Modbus RTU slave register map serving the latest ADT7320 readings.
+ *
+ * @details
+ * The CRC uses a 16-entry nibble table: two lookups per byte, 32 bytes of flash.
+ * Conversion to 0.01 °C (raw * 100 / 128) is done once per update, not per request.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>            /**< memcpy() */
+#include "adt7320_modbus.h"   /**< Modbus slave interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+#define  ADT7320_MODBUS_FC_HOLDING  (0x03U)   ///< Read Holding Registers
+#define  ADT7320_MODBUS_FC_INPUT    (0x04U)   ///< Read Input Registers
+
+#define  ADT7320_MODBUS_EX_FUNCTION  (0x01U)  ///< Exception: illegal function
+#define  ADT7320_MODBUS_EX_ADDRESS   (0x02U)  ///< Exception: illegal data address
+#define  ADT7320_MODBUS_EX_VALUE     (0x03U)  ///< Exception: illegal data value
+
+#define  ADT7320_MODBUS_BROADCAST  (0U)       ///< Broadcast slave address
+
+/** @brief Length of a read request, CRC included */
+#define  ADT7320_MODBUS_READ_LEN  (8U)
+
+#if (ADT7320_MODBUS_MAX_SENSORS > 125U)
+    #error "ADT7320_MODBUS_MAX_SENSORS must not exceed 125 registers"
+#endif
+
+
+/* ------------------------------- Private Variables -------------------------------- */
+
+/** @brief CRC-16/MODBUS (reflected 0xA001) per nibble */
+static const uint16_t ADT7320_Modbus_CrcTable[16U] =
+{
+    0x0000U, 0xCC01U, 0xD801U, 0x1400U, 0xF001U, 0x3C00U, 0x2800U, 0xE401U,
+    0xA001U, 0x6C00U, 0x7800U, 0xB401U, 0x5000U, 0x9C01U, 0x8801U, 0x4400U
+};
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Computes the CRC-16/MODBUS of a buffer.
+ *
+ * @param[in] pData  Buffer.
+ * @param[in] len    Length, in bytes.
+ *
+ * @return CRC, to be sent low byte first.
+ */
+static uint16_t ADT7320_Modbus_Crc(const uint8_t *pData, uint16_t len)
+{
+    uint16_t crc = 0xFFFFU;
+
+    for (uint16_t i = 0U; i < len; i++)
+    {
+        crc = (uint16_t)((crc >> 4U) ^ ADT7320_Modbus_CrcTable[(crc ^ pData[i]) & 0x0FU]);
+        crc = (uint16_t)((crc >> 4U) ^ ADT7320_Modbus_CrcTable[(crc ^ ((uint16_t)pData[i] >> 4U)) & 0x0FU]);
+    }
+
+    return crc;
+}
+
+/**
+ * @brief  Appends the CRC to a frame.
+ *
+ * @param[in,out] pFrame  Frame buffer.
+ * @param[in]     len     Frame length without the CRC, in bytes.
+ *
+ * @return Frame length with the CRC, in bytes.
+ */
+static uint16_t ADT7320_Modbus_Seal(uint8_t *pFrame, uint16_t len)
+{
+    uint16_t crc = ADT7320_Modbus_Crc(pFrame, len);
+
+    pFrame[len]      = (uint8_t)(crc & 0xFFU);
+    pFrame[len + 1U] = (uint8_t)(crc >> 8U);
+
+    return (uint16_t)(len + 2U);
+}
+
+/**
+ * @brief  Stores a register value in big-endian order.
+ *
+ * @param[out] pReg   Register slot (2 bytes).
+ * @param[in]  value  Register value.
+ */
+static void ADT7320_Modbus_Put(uint8_t *pReg, uint16_t value)
+{
+    pReg[0U] = (uint8_t)(value >> 8U);
+    pReg[1U] = (uint8_t)(value & 0xFFU);
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes the slave; every register starts as ADT7320_MODBUS_INVALID.
+ *
+ * @param[out] pMb      Pointer to the slave state.
+ * @param[in]  address  Slave address (1 .. 247).
+ *
+ * @retval ADT7320_OK     Slave ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Init(ADT7320_ModbusTypeDef *pMb, uint8_t address)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pMb == NULL) || (address == ADT7320_MODBUS_BROADCAST) || (address > 247U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pMb->address    = address;
+        pMb->requests   = 0U;
+        pMb->crcErrors  = 0U;
+        pMb->exceptions = 0U;
+
+        for (uint8_t s = 0U; s < ADT7320_MODBUS_MAX_SENSORS; s++)
+        {
+            ADT7320_Modbus_Put(&pMb->input[2U * s], ADT7320_MODBUS_INVALID);
+            ADT7320_Modbus_Put(&pMb->holding[2U * s], ADT7320_MODBUS_INVALID);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Stores the latest reading of a sensor.
+ *
+ * @param[in,out] pMb     Pointer to the slave state.
+ * @param[in]     sensor  Sensor index (< ADT7320_MODBUS_MAX_SENSORS).
+ * @param[in]     raw     Raw ADT7320_TEMP code.
+ *
+ * @retval ADT7320_OK     Table updated
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Update(ADT7320_ModbusTypeDef *pMb, uint8_t sensor, int16_t raw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    int32_t centi = 0;
+
+    if ( (pMb == NULL) || (sensor >= ADT7320_MODBUS_MAX_SENSORS) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        /* raw * 100 / 128, rounded half away from zero */
+        centi = (int32_t)raw * 25;
+        centi = (centi >= 0) ? ((centi + 16) / 32) : ((centi - 16) / 32);
+
+        ADT7320_Modbus_Put(&pMb->input[2U * sensor], (uint16_t)raw);
+        ADT7320_Modbus_Put(&pMb->holding[2U * sensor], (uint16_t)(int16_t)centi);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Reads a sensor and stores the result; a failed read marks it invalid.
+ *
+ * @param[in,out] pMb      Pointer to the slave state.
+ * @param[in]     pConfig  Sensor to read.
+ * @param[in]     sensor   Sensor index (< ADT7320_MODBUS_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Table updated
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Read(ADT7320_ModbusTypeDef *pMb, const ADT7320_ConfigTypeDef *pConfig, uint8_t sensor)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t data = 0U;
+
+    if ( (pMb == NULL) || (pConfig == NULL) || (sensor >= ADT7320_MODBUS_MAX_SENSORS) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        status = ADT7320_ReadRegister(pConfig, ADT7320_TEMP, 2U, &data);
+
+        if (status == ADT7320_OK)
+        {
+            status = ADT7320_Modbus_Update(pMb, sensor, (int16_t)data);
+        }
+        else
+        {
+            ADT7320_Modbus_Put(&pMb->input[2U * sensor], ADT7320_MODBUS_INVALID);
+            ADT7320_Modbus_Put(&pMb->holding[2U * sensor], ADT7320_MODBUS_INVALID);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Handles one received RTU frame.
+ *
+ * Supports functions 0x03 and 0x04; other functions and out-of-range addresses get an
+ * exception response.
+ *
+ * @param[in,out] pMb        Pointer to the slave state.
+ * @param[in]     pRequest   Received frame, including the CRC.
+ * @param[in]     reqLen     Frame length, in bytes.
+ * @param[out]    pResponse  Response buffer of ADT7320_MODBUS_MAX_FRAME bytes.
+ * @param[out]    pRespLen   Response length, in bytes (0 when nothing must be sent).
+ *
+ * @retval ADT7320_OK     Frame handled
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Process(ADT7320_ModbusTypeDef *pMb, const uint8_t *pRequest, uint16_t reqLen,
+                                             uint8_t *pResponse, uint16_t *pRespLen)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    const uint8_t *pTable = NULL;
+    uint16_t start     = 0U;
+    uint16_t quantity  = 0U;
+    uint8_t  exception = 0U;
+
+    if ( (pMb == NULL) || (pRequest == NULL) || (pResponse == NULL) || (pRespLen == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        *pRespLen = 0U;
+
+        if ( (reqLen < 4U) || (reqLen > ADT7320_MODBUS_MAX_FRAME) || (pRequest[0U] != pMb->address) )
+        {
+            /* Not for this slave (broadcast reads are not answered) */
+        }
+        else if (ADT7320_Modbus_Crc(pRequest, reqLen) != 0U)
+        {
+            /* A frame followed by its own CRC has a CRC of zero */
+            pMb->crcErrors++;
+        }
+        else
+        {
+            pMb->requests++;
+
+            if (pRequest[1U] == ADT7320_MODBUS_FC_HOLDING)
+            {
+                pTable = pMb->holding;
+            }
+            else if (pRequest[1U] == ADT7320_MODBUS_FC_INPUT)
+            {
+                pTable = pMb->input;
+            }
+            else
+            {
+                exception = ADT7320_MODBUS_EX_FUNCTION;
+            }
+
+            if (pTable != NULL)
+            {
+                start    = (uint16_t)(((uint16_t)pRequest[2U] << 8U) | pRequest[3U]);
+                quantity = (reqLen == ADT7320_MODBUS_READ_LEN) ? (uint16_t)(((uint16_t)pRequest[4U] << 8U) | pRequest[5U]) : 0U;
+
+                if ( (quantity == 0U) || (quantity > 125U) )
+                {
+                    exception = ADT7320_MODBUS_EX_VALUE;
+                }
+                else if ((uint32_t)start + quantity > ADT7320_MODBUS_MAX_SENSORS)
+                {
+                    exception = ADT7320_MODBUS_EX_ADDRESS;
+                }
+                else
+                {
+                    pResponse[0U] = pMb->address;
+                    pResponse[1U] = pRequest[1U];
+                    pResponse[2U] = (uint8_t)(2U * quantity);
+                    (void)memcpy(&pResponse[3U], &pTable[2U * start], 2U * (size_t)quantity);
+
+                    *pRespLen = ADT7320_Modbus_Seal(pResponse, (uint16_t)(3U + (2U * quantity)));
+                }
+            }
+
+            if (exception != 0U)
+            {
+                pMb->exceptions++;
+
+                pResponse[0U] = pMb->address;
+                pResponse[1U] = (uint8_t)(pRequest[1U] | 0x80U);
+                pResponse[2U] = exception;
+
+                *pRespLen = ADT7320_Modbus_Seal(pResponse, 3U);
+            }
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_modbus.c */
@@ -0,0 +1,132 @@
+/**
+ * @file    adt7320_modbus.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Modbus RTU slave register map serving the latest ADT7320 readings.
+ *
+ * @details
+ * The application keeps a latest-value table up to date from its own sampling loop
+ * (ADT7320_Modbus_Update() or ADT7320_Modbus_Read()). Requests are answered from that
+ * table only, so no SPI transfer happens while a response is pending.
+ *
+ * Register map (sensor i at address i):
+ * - Input registers (function 0x04): raw ADT7320_TEMP code, 1/128 °C, signed.
+ * - Holding registers (function 0x03): temperature in 0.01 °C, signed.
+ *
+ * Both tables are stored already in Modbus byte order, so a response is a straight copy
+ * of the requested range. Registers of sensors never updated, or whose last read failed,
+ * hold ADT7320_MODBUS_INVALID.
+ *
+ * ADT7320_Modbus_Process() takes one complete frame (delimited by the application's
+ * UART idle-line / 3.5-character timeout) and builds the response frame. Requests with
+ * another slave address, the broadcast address or a bad CRC produce no response.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_MODBUS_H
+#define ADT7320_MODBUS_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Largest RTU frame, in bytes */
+#define  ADT7320_MODBUS_MAX_FRAME  (256U)
+
+/** @brief Register value of a sensor without a valid reading */
+#define  ADT7320_MODBUS_INVALID  (0x8000U)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Modbus slave state and latest-value table.
+ */
+typedef struct
+{
+    uint8_t  address;                                   /**< Slave address (1 .. 247) */
+    uint8_t  input[2U * ADT7320_MODBUS_MAX_SENSORS];    /**< Input registers, big-endian */
+    uint8_t  holding[2U * ADT7320_MODBUS_MAX_SENSORS];  /**< Holding registers, big-endian */
+    uint32_t requests;                                  /**< Frames addressed to this slave */
+    uint32_t crcErrors;                                 /**< Frames dropped on CRC mismatch */
+    uint32_t exceptions;                                /**< Exception responses sent */
+} ADT7320_ModbusTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes the slave; every register starts as ADT7320_MODBUS_INVALID.
+ *
+ * @param[out] pMb      Pointer to the slave state.
+ * @param[in]  address  Slave address (1 .. 247).
+ *
+ * @retval ADT7320_OK     Slave ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Init(ADT7320_ModbusTypeDef *pMb, uint8_t address);
+
+/**
+ * @brief  Stores the latest reading of a sensor.
+ *
+ * @param[in,out] pMb     Pointer to the slave state.
+ * @param[in]     sensor  Sensor index (< ADT7320_MODBUS_MAX_SENSORS).
+ * @param[in]     raw     Raw ADT7320_TEMP code.
+ *
+ * @retval ADT7320_OK     Table updated
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Update(ADT7320_ModbusTypeDef *pMb, uint8_t sensor, int16_t raw);
+
+/**
+ * @brief  Reads a sensor and stores the result; a failed read marks it invalid.
+ *
+ * @param[in,out] pMb      Pointer to the slave state.
+ * @param[in]     pConfig  Sensor to read.
+ * @param[in]     sensor   Sensor index (< ADT7320_MODBUS_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Table updated
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Read(ADT7320_ModbusTypeDef *pMb, const ADT7320_ConfigTypeDef *pConfig, uint8_t sensor);
+
+/**
+ * @brief  Handles one received RTU frame.
+ *
+ * Supports functions 0x03 and 0x04; other functions and out-of-range addresses get an
+ * exception response.
+ *
+ * @param[in,out] pMb        Pointer to the slave state.
+ * @param[in]     pRequest   Received frame, including the CRC.
+ * @param[in]     reqLen     Frame length, in bytes.
+ * @param[out]    pResponse  Response buffer of ADT7320_MODBUS_MAX_FRAME bytes.
+ * @param[out]    pRespLen   Response length, in bytes (0 when nothing must be sent).
+ *
+ * @retval ADT7320_OK     Frame handled
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Modbus_Process(ADT7320_ModbusTypeDef *pMb, const uint8_t *pRequest, uint16_t reqLen,
+                                             uint8_t *pResponse, uint16_t *pRespLen);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_MODBUS_H */
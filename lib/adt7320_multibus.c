@@ -0,0 +1,438 @@
+/**
+ * @file    adt7320_multibus.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Parallel sweep of ADT7320 sensors spread over several SPI buses.
+ *
+ * @details
+ * Each bus ("lane") walks its sensors from the completion callback of the previous
+ * read. A read that cannot start, fails or times out is recorded in the frame status
+ * and the lane moves on, so every lane always finishes. The last lane to finish
+ * publishes the frame; @c pending is decremented with interrupts masked because lanes
+ * finish from the interrupts of different SPIs.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_multibus.h"  /**< Multi-bus sweep interface */
+#include "adt7320_metrics.h"   /**< DWT cycle counter helpers */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Reads the 32-bit time source.
+ *
+ * @return Cycle count, or HAL tick on cores without DWT.
+ */
+static uint32_t ADT7320_MultiBus_Raw(void)
+{
+#if (ADT7320_HAS_DWT == 1U)
+    return DWT->CYCCNT;
+#else
+    return HAL_GetTick();
+#endif
+}
+
+/**
+ * @brief  Reads the time base of the measurements, extended to 64 bits.
+ *
+ * Called from thread and interrupt context, so the update runs with interrupts masked.
+ *
+ * @param[in,out] pMb  Pointer to the multi-bus state.
+ *
+ * @return Cycles (ms on cores without DWT) since ADT7320_MultiBus_Init().
+ */
+static uint64_t ADT7320_MultiBus_Now(ADT7320_MultiBusTypeDef *pMb)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t raw     = 0U;
+    uint32_t tick    = 0U;
+    uint64_t delta   = 0U;
+    uint64_t now     = 0U;
+#if (ADT7320_HAS_DWT == 1U)
+    uint64_t expected = 0U;
+#endif
+
+    __disable_irq();
+
+    raw   = ADT7320_MultiBus_Raw();
+    tick  = HAL_GetTick();
+    delta = (uint32_t)(raw - pMb->clockRaw);
+
+#if (ADT7320_HAS_DWT == 1U)
+    /* Whole counter periods elapsed since the last update, resolved with the ms tick */
+    expected = (uint64_t)(uint32_t)(tick - pMb->clockTick) * (SystemCoreClock / 1000U);
+
+    if (expected > delta)
+    {
+        delta += ((expected - delta + 0x80000000ULL) >> 32U) << 32U;
+    }
+#endif
+
+    pMb->clock    += delta;
+    pMb->clockRaw  = raw;
+    pMb->clockTick = tick;
+    now            = pMb->clock;
+
+    __set_PRIMASK(primask);
+
+    return now;
+}
+
+/**
+ * @brief  Clears the timing measurement.
+ *
+ * @param[in,out] pMb  Pointer to the multi-bus state.
+ */
+static void ADT7320_MultiBus_ResetStats(ADT7320_MultiBusTypeDef *pMb)
+{
+    for (uint8_t b = 0U; b < ADT7320_MULTIBUS_MAX_BUSES; b++)
+    {
+        pMb->lane[b].busyTime = 0U;
+    }
+
+    pMb->statsStart = ADT7320_MultiBus_Now(pMb);
+    pMb->sweeps     = 0U;
+    pMb->periodMin  = UINT64_MAX;
+    pMb->periodMax  = 0U;
+}
+
+/**
+ * @brief  Accounts for a finished lane and publishes the frame after the last one.
+ *
+ * @param[in,out] pMb    Pointer to the multi-bus state.
+ * @param[in,out] pLane  Lane that finished.
+ */
+static void ADT7320_MultiBus_LaneDone(ADT7320_MultiBusTypeDef *pMb, ADT7320_MultiBusLaneTypeDef *pLane)
+{
+    uint8_t  remaining = 0U;
+    uint32_t primask   = 0U;
+
+    pLane->busyTime += ADT7320_MultiBus_Now(pMb) - pMb->sweepStart;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    pMb->pending--;
+    remaining = pMb->pending;
+    __set_PRIMASK(primask);
+
+    if (remaining == 0U)
+    {
+        pMb->pFrame = NULL;
+        (void)ADT7320_Frames_Publish(pMb->pFrames);
+    }
+}
+
+/* Lanes chain their reads through this completion callback */
+static void ADT7320_MultiBus_ReadDone(void *pContext, ADT7320_StatusTypeDef status, uint16_t data);
+
+/**
+ * @brief  Starts the next read of a lane, or finishes the lane.
+ *
+ * @param[in,out] pLane  Lane to advance.
+ */
+static void ADT7320_MultiBus_Advance(ADT7320_MultiBusLaneTypeDef *pLane)
+{
+    ADT7320_MultiBusTypeDef *pMb = (ADT7320_MultiBusTypeDef *)pLane->pOwner;
+    ADT7320_StatusTypeDef status = ADT7320_ERROR;
+    uint8_t slot = 0U;
+
+    while ( (status != ADT7320_OK) && (pLane->next < pLane->count) )
+    {
+        status = ADT7320_Async_Read(&pLane->bus, &pLane->pSensors[pLane->next], ADT7320_TEMP, 2U, pMb->deadlineMs,
+                                    ADT7320_MultiBus_ReadDone, pLane);
+
+        if (status != ADT7320_OK)
+        {
+            slot = (uint8_t)(pLane->first + pLane->next);
+            pMb->pFrame->status[slot] = (uint8_t)status;
+            pMb->pFrame->raw[slot]    = 0;
+            pLane->next++;
+        }
+    }
+
+    if (status != ADT7320_OK)
+    {
+        ADT7320_MultiBus_LaneDone(pMb, pLane);
+    }
+}
+
+/**
+ * @brief  Stores a reading into the frame and continues the lane (async callback).
+ *
+ * @param[in] pContext  Lane of the read.
+ * @param[in] status    Outcome of the read.
+ * @param[in] data      Raw temperature code.
+ */
+static void ADT7320_MultiBus_ReadDone(void *pContext, ADT7320_StatusTypeDef status, uint16_t data)
+{
+    ADT7320_MultiBusLaneTypeDef *pLane = (ADT7320_MultiBusLaneTypeDef *)pContext;
+    ADT7320_MultiBusTypeDef *pMb = (ADT7320_MultiBusTypeDef *)pLane->pOwner;
+    uint8_t slot = (uint8_t)(pLane->first + pLane->next);
+
+    pMb->pFrame->status[slot] = (uint8_t)status;
+    pMb->pFrame->raw[slot]    = (int16_t)data;
+    pLane->next++;
+
+    ADT7320_MultiBus_Advance(pLane);
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes a multi-bus sweep and starts the DWT cycle counter when available.
+ *
+ * @param[out] pMb         Pointer to the multi-bus state.
+ * @param[in]  pFrames     Frame set receiving the sweeps (initialized).
+ * @param[in]  deadlineMs  Deadline of each read, in ms (0 = none).
+ *
+ * @retval ADT7320_OK     Multi-bus ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_Init(ADT7320_MultiBusTypeDef *pMb, ADT7320_FramesTypeDef *pFrames, uint32_t deadlineMs)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pMb == NULL) || (pFrames == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pMb->laneCount   = 0U;
+        pMb->sensorCount = 0U;
+        pMb->pending     = 0U;
+        pMb->pFrames     = pFrames;
+        pMb->pFrame      = NULL;
+        pMb->deadlineMs  = deadlineMs;
+        pMb->sweepStart  = 0U;
+
+        ADT7320_DWT_Enable();
+        pMb->clock     = 0U;
+        pMb->clockRaw  = ADT7320_MultiBus_Raw();
+        pMb->clockTick = HAL_GetTick();
+
+        ADT7320_MultiBus_ResetStats(pMb);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Adds an SPI bus and its sensors.
+ *
+ * @param[in,out] pMb       Pointer to the multi-bus state.
+ * @param[in]     SPIx      SPI handle of the bus (one per bus).
+ * @param[in]     mode      Transfer mechanism of the bus.
+ * @param[in]     pSensors  Sensors of the bus (all using SPIx).
+ * @param[in]     count     Number of sensors.
+ *
+ * @retval ADT7320_OK     Bus added
+ * @retval ADT7320_ERROR  Invalid parameters, too many buses or sensors, or a hardware NSS sensor that is not alone on SPIx
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_AddBus(ADT7320_MultiBusTypeDef *pMb, SPI_HandleTypeDef *SPIx, ADT7320_AsyncModeTypeDef mode,
+                                              const ADT7320_ConfigTypeDef *pSensors, uint8_t count)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_MultiBusLaneTypeDef *pLane = NULL;
+
+    if ( (pMb == NULL) || (pSensors == NULL) || (count == 0U) || (pMb->pending != 0U) ||
+         (pMb->laneCount >= ADT7320_MULTIBUS_MAX_BUSES) || (((uint32_t)pMb->sensorCount + count) > ADT7320_FRAMES_MAX_SENSORS) ||
+         (ADT7320_IsNssExclusive(pSensors, count) == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pLane  = &pMb->lane[pMb->laneCount];
+        status = ADT7320_Async_Init(&pLane->bus, SPIx, mode);
+
+        if (status == ADT7320_OK)
+        {
+            pLane->pSensors = pSensors;
+            pLane->count    = count;
+            pLane->first    = pMb->sensorCount;
+            pLane->next     = 0U;
+            pLane->busyTime = 0U;
+            pLane->pOwner   = pMb;
+
+            pMb->sensorCount = (uint8_t)(pMb->sensorCount + count);
+            pMb->laneCount++;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts a sweep on every bus.
+ *
+ * @param[in,out] pMb  Pointer to the multi-bus state.
+ *
+ * @retval ADT7320_OK     Sweep started; the frame is published when every bus is done
+ * @retval ADT7320_BUSY   Previous sweep still running, or no free frame
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_Start(ADT7320_MultiBusTypeDef *pMb)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint64_t now    = 0U;
+    uint64_t period = 0U;
+
+    if ( (pMb == NULL) || (pMb->laneCount == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (pMb->pending != 0U)
+    {
+        status = ADT7320_BUSY;
+    }
+    else
+    {
+        status = ADT7320_Frames_Begin(pMb->pFrames, &pMb->pFrame);
+
+        if (status == ADT7320_OK)
+        {
+            now = ADT7320_MultiBus_Now(pMb);
+
+            if (pMb->sweeps > 0U)
+            {
+                period = now - pMb->sweepStart;
+
+                if (period < pMb->periodMin)
+                {
+                    pMb->periodMin = period;
+                }
+                if (period > pMb->periodMax)
+                {
+                    pMb->periodMax = period;
+                }
+            }
+
+            pMb->sweepStart    = now;
+            pMb->sweeps++;
+            pMb->pFrame->tick  = HAL_GetTick();
+            pMb->pFrame->count = pMb->sensorCount;
+
+            /* Set before any lane starts: a lane may finish immediately */
+            pMb->pending = pMb->laneCount;
+
+            for (uint8_t b = 0U; b < pMb->laneCount; b++)
+            {
+                pMb->lane[b].next = 0U;
+                ADT7320_MultiBus_Advance(&pMb->lane[b]);
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Forwards a transfer completion (from HAL_SPI_TxRxCpltCallback()).
+ *
+ * @param[in,out] pMb   Pointer to the multi-bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback.
+ */
+void ADT7320_MultiBus_Complete(ADT7320_MultiBusTypeDef *pMb, const SPI_HandleTypeDef *hspi)
+{
+    if (pMb != NULL)
+    {
+        for (uint8_t b = 0U; b < pMb->laneCount; b++)
+        {
+            ADT7320_Async_Complete(&pMb->lane[b].bus, hspi);
+        }
+    }
+}
+
+/**
+ * @brief  Forwards an SPI error (from HAL_SPI_ErrorCallback()).
+ *
+ * @param[in,out] pMb   Pointer to the multi-bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback.
+ */
+void ADT7320_MultiBus_Error(ADT7320_MultiBusTypeDef *pMb, const SPI_HandleTypeDef *hspi)
+{
+    if (pMb != NULL)
+    {
+        for (uint8_t b = 0U; b < pMb->laneCount; b++)
+        {
+            ADT7320_Async_Error(&pMb->lane[b].bus, hspi);
+        }
+    }
+}
+
+/**
+ * @brief  Aborts reads whose deadline has expired, on every bus.
+ *
+ * @param[in,out] pMb  Pointer to the multi-bus state.
+ */
+void ADT7320_MultiBus_Poll(ADT7320_MultiBusTypeDef *pMb)
+{
+    if (pMb != NULL)
+    {
+        for (uint8_t b = 0U; b < pMb->laneCount; b++)
+        {
+            ADT7320_Async_Poll(&pMb->lane[b].bus);
+        }
+    }
+}
+
+/**
+ * @brief  Computes the timing report and optionally restarts the measurement.
+ *
+ * @param[in,out] pMb      Pointer to the multi-bus state.
+ * @param[out]    pReport  Report.
+ * @param[in]     reset    Non-zero to restart the measurement.
+ *
+ * @retval ADT7320_OK     Report returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_GetReport(ADT7320_MultiBusTypeDef *pMb, ADT7320_MultiBusReportTypeDef *pReport, uint8_t reset)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint64_t elapsed = 0U;
+
+    if ( (pMb == NULL) || (pReport == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        elapsed = ADT7320_MultiBus_Now(pMb) - pMb->statsStart;
+
+        pReport->sweeps    = pMb->sweeps;
+        pReport->periodMin = (pMb->sweeps > 1U) ? pMb->periodMin : 0U;
+        pReport->periodMax = pMb->periodMax;
+        pReport->jitter    = pReport->periodMax - pReport->periodMin;
+
+        for (uint8_t b = 0U; b < ADT7320_MULTIBUS_MAX_BUSES; b++)
+        {
+            pReport->utilisation[b] = 0U;
+
+            if ( (b < pMb->laneCount) && (elapsed > 0U) )
+            {
+                pReport->utilisation[b] = (uint16_t)((pMb->lane[b].busyTime * 1000U) / elapsed);
+            }
+        }
+
+        if (reset != 0U)
+        {
+            ADT7320_MultiBus_ResetStats(pMb);
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_multibus.c */
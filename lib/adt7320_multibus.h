@@ -0,0 +1,187 @@
+/**
+ * @file    adt7320_multibus.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Parallel sweep of ADT7320 sensors spread over several SPI buses.
+ *
+ * @details
+ * Sweeping buses one after the other makes the sweep as long as the sum of all buses.
+ * Here every bus runs its own chain of asynchronous reads (adt7320_async.h): the first
+ * read of each bus is started together, and each completion starts the next read of
+ * the same bus. The sweep therefore lasts as long as the slowest bus.
+ *
+ * All readings land in one frame of a frame set (adt7320_frames.h), in the order the
+ * buses were added, stamped with the tick at the start of the sweep. The frame is
+ * published when the last bus finishes.
+ *
+ * Each bus is one ADT7320_AsyncBusTypeDef inside the multi-bus object; the application
+ * forwards the HAL callbacks and polls the deadlines:
+ * @code
+ * void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) { ADT7320_MultiBus_Complete(&sweep, hspi); }
+ * void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)    { ADT7320_MultiBus_Error(&sweep, hspi); }
+ * @endcode
+ *
+ * The report gives the sweep period spread (jitter) and, per bus, the share of time the
+ * bus spent sweeping. Times are in CPU cycles on cores with the DWT cycle counter
+ * (started by ADT7320_MultiBus_Init()) and in ms (HAL_GetTick()) on Cortex-M0/M0+.
+ * The 32-bit counter is extended to 64 bits, with HAL_GetTick() resolving the wraps
+ * between two readings, so periods and utilisation stay right beyond the counter
+ * period (about 60 s at 72 MHz, 9 s at 480 MHz).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_MULTIBUS_H
+#define ADT7320_MULTIBUS_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"         /**< ADT7320 driver interface and configuration */
+#include "adt7320_async.h"   /**< Asynchronous register access */
+#include "adt7320_frames.h"  /**< Sweep frames */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief One SPI bus of the sweep.
+ */
+typedef struct
+{
+    ADT7320_AsyncBusTypeDef bus;           /**< Asynchronous bus state */
+    const ADT7320_ConfigTypeDef *pSensors; /**< Sensors of the bus */
+    uint8_t  count;                        /**< Number of sensors */
+    uint8_t  first;                        /**< Frame slot of the first sensor */
+    uint8_t  next;                         /**< Next sensor to read in the sweep */
+    uint64_t busyTime;                     /**< Time spent sweeping since the last report reset */
+    void    *pOwner;                       /**< Multi-bus object of the lane */
+} ADT7320_MultiBusLaneTypeDef;
+
+/**
+ * @brief Multi-bus sweep state.
+ */
+typedef struct
+{
+    ADT7320_MultiBusLaneTypeDef lane[ADT7320_MULTIBUS_MAX_BUSES];  /**< Buses */
+    uint8_t  laneCount;                                            /**< Buses added */
+    uint8_t  sensorCount;                                          /**< Sensors over all buses */
+    volatile uint8_t pending;                                      /**< Buses still sweeping */
+    ADT7320_FramesTypeDef *pFrames;                                /**< Frame set receiving the sweeps */
+    ADT7320_FrameTypeDef  *pFrame;                                 /**< Frame being filled */
+    uint32_t deadlineMs;                                           /**< Deadline of each read, in ms */
+    uint64_t clock;                                                /**< Extended time base */
+    uint32_t clockRaw;                                             /**< Counter value at the last time base update */
+    uint32_t clockTick;                                            /**< HAL tick at the last time base update */
+    uint64_t sweepStart;                                           /**< Time at the start of the current sweep */
+    uint64_t statsStart;                                           /**< Time at the last report reset */
+    uint32_t sweeps;                                               /**< Sweeps started since the last report reset */
+    uint64_t periodMin;                                            /**< Shortest start-to-start period */
+    uint64_t periodMax;                                            /**< Longest start-to-start period */
+} ADT7320_MultiBusTypeDef;
+
+/**
+ * @brief Timing summary computed by ADT7320_MultiBus_GetReport().
+ */
+typedef struct
+{
+    uint32_t sweeps;                                   /**< Sweeps started */
+    uint64_t periodMin;                                /**< Shortest sweep period */
+    uint64_t periodMax;                                /**< Longest sweep period */
+    uint64_t jitter;                                   /**< periodMax - periodMin */
+    uint16_t utilisation[ADT7320_MULTIBUS_MAX_BUSES];  /**< Share of time each bus was sweeping, in per mille */
+} ADT7320_MultiBusReportTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes a multi-bus sweep and starts the DWT cycle counter when available.
+ *
+ * @param[out] pMb         Pointer to the multi-bus state.
+ * @param[in]  pFrames     Frame set receiving the sweeps (initialized).
+ * @param[in]  deadlineMs  Deadline of each read, in ms (0 = none).
+ *
+ * @retval ADT7320_OK     Multi-bus ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_Init(ADT7320_MultiBusTypeDef *pMb, ADT7320_FramesTypeDef *pFrames, uint32_t deadlineMs);
+
+/**
+ * @brief  Adds an SPI bus and its sensors.
+ *
+ * @param[in,out] pMb       Pointer to the multi-bus state.
+ * @param[in]     SPIx      SPI handle of the bus (one per bus).
+ * @param[in]     mode      Transfer mechanism of the bus.
+ * @param[in]     pSensors  Sensors of the bus (all using SPIx).
+ * @param[in]     count     Number of sensors.
+ *
+ * @retval ADT7320_OK     Bus added
+ * @retval ADT7320_ERROR  Invalid parameters, too many buses or sensors
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_AddBus(ADT7320_MultiBusTypeDef *pMb, SPI_HandleTypeDef *SPIx, ADT7320_AsyncModeTypeDef mode,
+                                              const ADT7320_ConfigTypeDef *pSensors, uint8_t count);
+
+/**
+ * @brief  Starts a sweep on every bus.
+ *
+ * @param[in,out] pMb  Pointer to the multi-bus state.
+ *
+ * @retval ADT7320_OK     Sweep started; the frame is published when every bus is done
+ * @retval ADT7320_BUSY   Previous sweep still running, or no free frame
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_Start(ADT7320_MultiBusTypeDef *pMb);
+
+/**
+ * @brief  Forwards a transfer completion (from HAL_SPI_TxRxCpltCallback()).
+ *
+ * @param[in,out] pMb   Pointer to the multi-bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback.
+ */
+void ADT7320_MultiBus_Complete(ADT7320_MultiBusTypeDef *pMb, const SPI_HandleTypeDef *hspi);
+
+/**
+ * @brief  Forwards an SPI error (from HAL_SPI_ErrorCallback()).
+ *
+ * @param[in,out] pMb   Pointer to the multi-bus state.
+ * @param[in]     hspi  SPI handle given to the HAL callback.
+ */
+void ADT7320_MultiBus_Error(ADT7320_MultiBusTypeDef *pMb, const SPI_HandleTypeDef *hspi);
+
+/**
+ * @brief  Aborts reads whose deadline has expired, on every bus.
+ *
+ * @param[in,out] pMb  Pointer to the multi-bus state.
+ */
+void ADT7320_MultiBus_Poll(ADT7320_MultiBusTypeDef *pMb);
+
+/**
+ * @brief  Computes the timing report and optionally restarts the measurement.
+ *
+ * @param[in,out] pMb      Pointer to the multi-bus state.
+ * @param[out]    pReport  Report.
+ * @param[in]     reset    Non-zero to restart the measurement.
+ *
+ * @retval ADT7320_OK     Report returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_MultiBus_GetReport(ADT7320_MultiBusTypeDef *pMb, ADT7320_MultiBusReportTypeDef *pReport, uint8_t reset);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_MULTIBUS_H */
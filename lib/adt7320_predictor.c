@@ -0,0 +1,263 @@
+/**
+ * @file    adt7320_predictor.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Alpha-beta temperature predictor that reads the ADT7320 only when needed.
+ *
+ * @details
+ * Filter update for a reading z taken dt ms after the previous one:
+ * - prediction  p = level + slope * dt
+ * - residual    r = z - p
+ * - level       = p + alpha * r
+ * - slope       = slope + beta * r / dt
+ *
+ * The uncertainty is measNoise + growthPerSec * dt / 1000, saturated to 16 bits. The
+ * level saturates to the 16-bit raw code range and the slope to 32 bits, so a long
+ * extrapolation or a step reading stays in range instead of wrapping.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_predictor.h"  /**< Predictor interface */
+#include "adt7320_metrics.h"    /**< Metric recording hooks */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Level range of the 16-bit raw codes, in Q8 */
+#define  ADT7320_PREDICTOR_LEVEL_MIN  ((int64_t)INT16_MIN * 256)
+#define  ADT7320_PREDICTOR_LEVEL_MAX  ((int64_t)INT16_MAX * 256)
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Saturates a value to a range.
+ *
+ * @param[in] value  Value to saturate.
+ * @param[in] min    Lowest value.
+ * @param[in] max    Highest value.
+ *
+ * @return Saturated value.
+ */
+static int32_t ADT7320_Predictor_Saturate(int64_t value, int64_t min, int64_t max)
+{
+    return (int32_t)((value < min) ? min : ((value > max) ? max : value));
+}
+
+/**
+ * @brief  Extrapolated level at a given elapsed time.
+ *
+ * @param[in] pPred  Pointer to the predictor state.
+ * @param[in] dt     Elapsed time since the last reading, in ms.
+ *
+ * @return Level in raw code Q8, saturated to the 16-bit raw code range.
+ */
+static int32_t ADT7320_Predictor_Level(const ADT7320_PredictorTypeDef *pPred, uint32_t dt)
+{
+    return ADT7320_Predictor_Saturate((int64_t)pPred->level + (((int64_t)pPred->slope * (int64_t)dt) / 256),
+                                      ADT7320_PREDICTOR_LEVEL_MIN, ADT7320_PREDICTOR_LEVEL_MAX);
+}
+
+/**
+ * @brief  Uncertainty at a given elapsed time.
+ *
+ * @param[in] pPred  Pointer to the predictor state.
+ * @param[in] dt     Elapsed time since the last reading, in ms.
+ *
+ * @return Uncertainty in LSB, saturated to 0xFFFF.
+ */
+static uint16_t ADT7320_Predictor_Uncert(const ADT7320_PredictorTypeDef *pPred, uint32_t dt)
+{
+    uint32_t u = (uint32_t)pPred->param.measNoise + (uint32_t)(((uint64_t)pPred->param.growthPerSec * dt) / 1000U);
+
+    return (uint16_t)((u > 0xFFFFU) ? 0xFFFFU : u);
+}
+
+/**
+ * @brief  Rounds a Q8 level to a raw code.
+ *
+ * @param[in] level  Level in raw code Q8, within the 16-bit raw code range.
+ *
+ * @return Raw 16-bit temperature code.
+ */
+static int16_t ADT7320_Predictor_ToRaw(int32_t level)
+{
+    return (int16_t)((level >= 0) ? ((level + 128) / 256) : ((level - 128) / 256));
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes a predictor for one sensor.
+ *
+ * @param[out] pPred    Pointer to the predictor state.
+ * @param[in]  pConfig  Sensor used for real reads (may be NULL if only ADT7320_Predictor_Feed() is used).
+ * @param[in]  pParam   Tuning parameters.
+ *
+ * @retval ADT7320_OK     Predictor initialized
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Init(ADT7320_PredictorTypeDef *pPred, const ADT7320_ConfigTypeDef *pConfig,
+                                             const ADT7320_PredictorParamTypeDef *pParam)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pPred == NULL) || (pParam == NULL) || (pParam->alpha > 256U) || (pParam->beta > 256U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pPred->pConfig  = pConfig;
+        pPred->param    = *pParam;
+        pPred->level    = 0;
+        pPred->slope    = 0;
+        pPred->lastTick = 0U;
+        pPred->primed   = 0U;
+        pPred->reads    = 0U;
+        pPred->avoided  = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Feeds a fresh reading into the filter.
+ *
+ * @param[in,out] pPred  Pointer to the predictor state.
+ * @param[in]     raw    Raw 16-bit ADT7320_TEMP code.
+ * @param[in]     tick   Tick at which the reading was taken, in ms.
+ *
+ * @retval ADT7320_OK     Filter updated
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Feed(ADT7320_PredictorTypeDef *pPred, int16_t raw, uint32_t tick)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t dt       = 0U;
+    int32_t  predict  = 0;
+    int32_t  residual = 0;
+
+    if (pPred == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (pPred->primed == 0U)
+    {
+        pPred->level    = (int32_t)raw * 256;
+        pPred->slope    = 0;
+        pPred->lastTick = tick;
+        pPred->primed   = 1U;
+    }
+    else
+    {
+        dt       = tick - pPred->lastTick;
+        predict  = ADT7320_Predictor_Level(pPred, dt);
+        residual = ((int32_t)raw * 256) - predict;
+
+        pPred->level = predict + (int32_t)(((int64_t)residual * (int64_t)pPred->param.alpha) / 256);
+
+        if (dt > 0U)
+        {
+            pPred->slope = ADT7320_Predictor_Saturate((int64_t)pPred->slope + (((int64_t)residual * (int64_t)pPred->param.beta) / (int64_t)dt),
+                                                      INT32_MIN, INT32_MAX);
+        }
+
+        pPred->lastTick = tick;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Extrapolates the temperature at a given tick without any SPI access.
+ *
+ * @param[in]  pPred    Pointer to the predictor state.
+ * @param[in]  tick     Query tick, in ms.
+ * @param[out] pRaw     Estimated raw code.
+ * @param[out] pUncert  Estimate uncertainty in LSB (may be NULL).
+ *
+ * @retval ADT7320_OK     Estimate returned
+ * @retval ADT7320_ERROR  Invalid parameters or no reading fed yet
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Estimate(const ADT7320_PredictorTypeDef *pPred, uint32_t tick, int16_t *pRaw, uint16_t *pUncert)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t dt = 0U;
+
+    if ( (pPred == NULL) || (pRaw == NULL) || (pPred->primed == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        dt    = tick - pPred->lastTick;
+        *pRaw = ADT7320_Predictor_ToRaw(ADT7320_Predictor_Level(pPred, dt));
+
+        if (pUncert != NULL)
+        {
+            *pUncert = ADT7320_Predictor_Uncert(pPred, dt);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Returns the current temperature, reading the sensor only when the estimate is too uncertain.
+ *
+ * @param[in,out] pPred  Pointer to the predictor state.
+ * @param[out]    pRaw   Raw code (measured or estimated).
+ *
+ * @retval ADT7320_OK     Temperature returned
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Read(ADT7320_PredictorTypeDef *pPred, int16_t *pRaw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t tick = HAL_GetTick();
+    uint32_t dt   = 0U;
+    uint16_t data = 0U;
+
+    if ( (pPred == NULL) || (pRaw == NULL) || (pPred->pConfig == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        dt = tick - pPred->lastTick;
+
+        if ( (pPred->primed == 0U) ||
+             ( (ADT7320_Predictor_Uncert(pPred, dt) > pPred->param.threshold) && (dt >= pPred->param.minIntervalMs) ) )
+        {
+            status = ADT7320_ReadRegister(pPred->pConfig, ADT7320_TEMP, 2U, &data);
+
+            if (status == ADT7320_OK)
+            {
+                pPred->reads++;
+                (void) ADT7320_Predictor_Feed(pPred, (int16_t)data, tick);
+                *pRaw = (int16_t)data;
+            }
+        }
+        else
+        {
+            pPred->avoided++;
+            ADT7320_METRIC_INC(ADT7320_METRIC_PREDICTOR_HITS);
+            *pRaw = ADT7320_Predictor_ToRaw(ADT7320_Predictor_Level(pPred, dt));
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_predictor.c */
@@ -0,0 +1,132 @@
+/**
+ * @file    adt7320_predictor.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Alpha-beta temperature predictor that reads the ADT7320 only when needed.
+ *
+ * @details
+ * The ADT7320 produces a new sample roughly every ADT7320_CONVERSION_MS, while control
+ * loops often ask for a temperature much more frequently. This module keeps a per-sensor
+ * fixed-point alpha-beta filter (level and slope) and extrapolates the temperature at any
+ * tick without touching the SPI bus.
+ *
+ * Each estimate carries an uncertainty that grows linearly with the time since the last
+ * real reading. ADT7320_Predictor_Read() performs an SPI read only once the uncertainty
+ * exceeds the configured threshold, and counts the reads it avoided.
+ *
+ * Units:
+ * - Temperatures and uncertainties are raw ADT7320_TEMP codes (1/128 °C per LSB).
+ * - Gains alpha and beta are Q8 (256 = 1.0).
+ * - Ticks are milliseconds (HAL_GetTick()).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_PREDICTOR_H
+#define ADT7320_PREDICTOR_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Tuning parameters of the predictor.
+ */
+typedef struct
+{
+    uint16_t alpha;          /**< Level gain, Q8 (e.g. 128 = 0.5) */
+    uint16_t beta;           /**< Slope gain, Q8 (e.g. 26 = 0.1) */
+    uint16_t measNoise;      /**< Uncertainty right after a reading, in LSB */
+    uint16_t growthPerSec;   /**< Uncertainty growth, in LSB per second */
+    uint16_t threshold;      /**< Uncertainty above which a real read is issued, in LSB */
+    uint16_t minIntervalMs;  /**< Minimum time between real reads (ADT7320_CONVERSION_MS typical) */
+} ADT7320_PredictorParamTypeDef;
+
+/**
+ * @brief Predictor state of one sensor.
+ */
+typedef struct
+{
+    const ADT7320_ConfigTypeDef *pConfig;  /**< Sensor read when the estimate is too uncertain */
+    ADT7320_PredictorParamTypeDef param;   /**< Tuning parameters */
+    int32_t  level;                        /**< Filtered temperature, raw code in Q8 */
+    int32_t  slope;                        /**< Filtered slope, raw code per ms in Q16 */
+    uint32_t lastTick;                     /**< Tick of the last reading */
+    uint8_t  primed;                       /**< Non-zero once a first reading was fed */
+    uint32_t reads;                        /**< Number of real SPI reads */
+    uint32_t avoided;                      /**< Number of reads served from the estimate */
+} ADT7320_PredictorTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes a predictor for one sensor.
+ *
+ * @param[out] pPred    Pointer to the predictor state.
+ * @param[in]  pConfig  Sensor used for real reads (may be NULL if only ADT7320_Predictor_Feed() is used).
+ * @param[in]  pParam   Tuning parameters.
+ *
+ * @retval ADT7320_OK     Predictor initialized
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Init(ADT7320_PredictorTypeDef *pPred, const ADT7320_ConfigTypeDef *pConfig,
+                                             const ADT7320_PredictorParamTypeDef *pParam);
+
+/**
+ * @brief  Feeds a fresh reading into the filter.
+ *
+ * @param[in,out] pPred  Pointer to the predictor state.
+ * @param[in]     raw    Raw 16-bit ADT7320_TEMP code.
+ * @param[in]     tick   Tick at which the reading was taken, in ms.
+ *
+ * @retval ADT7320_OK     Filter updated
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Feed(ADT7320_PredictorTypeDef *pPred, int16_t raw, uint32_t tick);
+
+/**
+ * @brief  Extrapolates the temperature at a given tick without any SPI access.
+ *
+ * @param[in]  pPred    Pointer to the predictor state.
+ * @param[in]  tick     Query tick, in ms.
+ * @param[out] pRaw     Estimated raw code.
+ * @param[out] pUncert  Estimate uncertainty in LSB (may be NULL).
+ *
+ * @retval ADT7320_OK     Estimate returned
+ * @retval ADT7320_ERROR  Invalid parameters or no reading fed yet
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Estimate(const ADT7320_PredictorTypeDef *pPred, uint32_t tick, int16_t *pRaw, uint16_t *pUncert);
+
+/**
+ * @brief  Returns the current temperature, reading the sensor only when the estimate is too uncertain.
+ *
+ * @param[in,out] pPred  Pointer to the predictor state.
+ * @param[out]    pRaw   Raw code (measured or estimated).
+ *
+ * @retval ADT7320_OK     Temperature returned
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Predictor_Read(ADT7320_PredictorTypeDef *pPred, int16_t *pRaw);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_PREDICTOR_H */
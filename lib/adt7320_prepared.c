@@ -0,0 +1,168 @@
+/**
+ * @file    adt7320_prepared.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Prepared ADT7320 register transactions for repeated execution.
+ *
+ * @details
+ * The received data bytes are assembled MSB first, as in ADT7320_ReadRegister().
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_prepared.h"  /**< Prepared transactions interface */
+#include "adt7320_metrics.h"   /**< Metric recording hooks (no-ops unless ADT7320_METRICS_ENABLE) */
+#include "adt7320_trace.h"     /**< Bus-traffic trace hook (no-op unless ADT7320_TRACE_ENABLE) */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Fills the fields shared by reads and writes.
+ *
+ * @param[out] pPrep     Pointer to the prepared transaction.
+ * @param[in]  pConfig   Sensor configuration (validated by the caller).
+ * @param[in]  command   Command byte.
+ * @param[in]  dataSize  Number of data bytes.
+ */
+static void ADT7320_Prepared_Fill(ADT7320_PreparedTypeDef *pPrep, const ADT7320_ConfigTypeDef *pConfig, uint8_t command, uint8_t dataSize)
+{
+    pPrep->pConfig   = pConfig;
+    pPrep->SPIx      = pConfig->SPIx;
+    pPrep->csPort    = pConfig->csPort;
+    pPrep->csAssert  = ((uint32_t)pConfig->csPin << 16U);
+    pPrep->csRelease = (uint32_t)pConfig->csPin;
+    pPrep->length    = (uint16_t)(dataSize + 1U);
+    pPrep->tx[0U]    = command;
+    pPrep->tx[1U]    = 0U;
+    pPrep->tx[2U]    = 0U;
+    pPrep->rx[0U]    = 0U;
+    pPrep->rx[1U]    = 0U;
+    pPrep->rx[2U]    = 0U;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Prepares a register read.
+ *
+ * @param[out] pPrep     Pointer to the prepared transaction.
+ * @param[in]  pConfig   Sensor configuration (must outlive the prepared transaction).
+ * @param[in]  reg       Register address.
+ * @param[in]  dataSize  Number of bytes to read (1 or 2).
+ *
+ * @retval ADT7320_OK     Transaction prepared
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Prepared_Read(ADT7320_PreparedTypeDef *pPrep, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pPrep == NULL) || (ADT7320_IsValid(pConfig) == 0U) || (dataSize == 0U) || (dataSize > 2U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        ADT7320_Prepared_Fill(pPrep, pConfig, (ADT7320_READ | ((reg & 0x1FU) << 3U)), dataSize);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Prepares a register write.
+ *
+ * @param[out] pPrep     Pointer to the prepared transaction.
+ * @param[in]  pConfig   Sensor configuration (must outlive the prepared transaction).
+ * @param[in]  reg       Register address.
+ * @param[in]  dataSize  Number of bytes to write (1 or 2).
+ * @param[in]  data      Value to write.
+ *
+ * @retval ADT7320_OK     Transaction prepared
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Prepared_Write(ADT7320_PreparedTypeDef *pPrep, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize,
+                                             uint16_t data)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pPrep == NULL) || (ADT7320_IsValid(pConfig) == 0U) || (dataSize == 0U) || (dataSize > 2U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        ADT7320_Prepared_Fill(pPrep, pConfig, (ADT7320_WRITE | ((reg & 0x1FU) << 3U)), dataSize);
+
+        for (uint8_t i = 0U; i < dataSize; i++)
+        {
+            pPrep->tx[1U + i] = (uint8_t)(data >> (8U * (dataSize - 1U - i)));
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Runs a prepared transaction with the blocking HAL call.
+ *
+ * @param[in,out] pPrep  Pointer to the prepared transaction.
+ * @param[out]    pData  Register value read (may be NULL, e.g. for writes).
+ *
+ * @retval ADT7320_OK       Operation successful
+ * @retval ADT7320_ERROR    SPI communication failure or invalid parameters
+ * @retval ADT7320_BUSY     SPI peripheral is busy
+ * @retval ADT7320_TIMEOUT  SPI operation timed out
+ */
+ADT7320_StatusTypeDef ADT7320_Prepared_Execute(ADT7320_PreparedTypeDef *pPrep, uint16_t *pData)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t start = 0U;
+
+    if (pPrep == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        if (pPrep->csPort != NULL)
+        {
+            pPrep->csPort->BSRR = pPrep->csAssert;
+        }
+
+        ADT7320_TRACE_SPI(pPrep->tx, pPrep->length);
+        start  = ADT7320_METRIC_NOW();
+        status = (ADT7320_StatusTypeDef) HAL_SPI_TransmitReceive(pPrep->SPIx, pPrep->tx, pPrep->rx, pPrep->length, ADT7320_MAX_DELAY);
+        ADT7320_METRIC_SPI(status, start);
+
+        if (pPrep->csPort != NULL)
+        {
+            pPrep->csPort->BSRR = pPrep->csRelease;
+        }
+#if (ADT7320_HW_NSS == 1U)
+        else
+        {
+            __HAL_SPI_DISABLE(pPrep->SPIx);
+        }
+#endif
+
+        if (pData != NULL)
+        {
+            *pData = (pPrep->length == 3U) ? (uint16_t)(((uint16_t)pPrep->rx[1U] << 8U) | pPrep->rx[2U]) : pPrep->rx[1U];
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_prepared.c */
@@ -0,0 +1,115 @@
+/**
+ * @file    adt7320_prepared.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Prepared ADT7320 register transactions for repeated execution.
+ *
+ * @details
+ * ADT7320_ReadRegister() validates its parameters, builds the command byte and clears
+ * its buffer on every call. Loops that access the same register over and over can
+ * instead prepare the transaction once:
+ *
+ * - parameters are validated and the command/data bytes built at prepare time;
+ * - transmit and receive buffers are separate, so the command byte is never rebuilt;
+ * - the chip select is resolved to GPIO BSRR set/reset masks, written directly;
+ * - the SPI handle and transfer length are stored ready for the HAL call.
+ *
+ * ADT7320_Prepared_Execute() then runs the transaction with the blocking HAL call, and
+ * ADT7320_Async_Execute() (adt7320_async.h) starts it on an asynchronous bus.
+ *
+ * @code
+ * ADT7320_PreparedTypeDef readTemp;
+ * ADT7320_Prepared_Read(&readTemp, &adt7320, ADT7320_TEMP, 2U);
+ * while (1) { ADT7320_Prepared_Execute(&readTemp, &raw); ... }
+ * @endcode
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_PREPARED_H
+#define ADT7320_PREPARED_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Prepared transaction.
+ */
+typedef struct
+{
+    const ADT7320_ConfigTypeDef *pConfig;  /**< Sensor of the transaction */
+    SPI_HandleTypeDef *SPIx;               /**< SPI handle */
+    GPIO_TypeDef *csPort;                  /**< CS port (NULL for hardware NSS) */
+    uint32_t csAssert;                     /**< BSRR value driving CS low */
+    uint32_t csRelease;                    /**< BSRR value driving CS high */
+    uint16_t length;                       /**< Bytes per transfer (command + data) */
+    uint8_t  tx[3U];                       /**< Command and data bytes */
+    uint8_t  rx[3U];                       /**< Received bytes */
+} ADT7320_PreparedTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Prepares a register read.
+ *
+ * @param[out] pPrep     Pointer to the prepared transaction.
+ * @param[in]  pConfig   Sensor configuration (must outlive the prepared transaction).
+ * @param[in]  reg       Register address.
+ * @param[in]  dataSize  Number of bytes to read (1 or 2).
+ *
+ * @retval ADT7320_OK     Transaction prepared
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Prepared_Read(ADT7320_PreparedTypeDef *pPrep, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize);
+
+/**
+ * @brief  Prepares a register write.
+ *
+ * @param[out] pPrep     Pointer to the prepared transaction.
+ * @param[in]  pConfig   Sensor configuration (must outlive the prepared transaction).
+ * @param[in]  reg       Register address.
+ * @param[in]  dataSize  Number of bytes to write (1 or 2).
+ * @param[in]  data      Value to write.
+ *
+ * @retval ADT7320_OK     Transaction prepared
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Prepared_Write(ADT7320_PreparedTypeDef *pPrep, const ADT7320_ConfigTypeDef *pConfig, uint8_t reg, uint8_t dataSize,
+                                             uint16_t data);
+
+/**
+ * @brief  Runs a prepared transaction with the blocking HAL call.
+ *
+ * @param[in,out] pPrep  Pointer to the prepared transaction.
+ * @param[out]    pData  Register value read (may be NULL, e.g. for writes).
+ *
+ * @retval ADT7320_OK       Operation successful
+ * @retval ADT7320_ERROR    SPI communication failure or invalid parameters
+ * @retval ADT7320_BUSY     SPI peripheral is busy
+ * @retval ADT7320_TIMEOUT  SPI operation timed out
+ */
+ADT7320_StatusTypeDef ADT7320_Prepared_Execute(ADT7320_PreparedTypeDef *pPrep, uint16_t *pData);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_PREPARED_H */
@@ -0,0 +1,288 @@
+/**
+ * @file    adt7320_profile.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   On-target sweep profiler for arrays of ADT7320 sensors.
+ *
+ * @details
+ * Bucket layout: values 0..3 map to buckets 0..3. A value whose most significant bit is
+ * m (m >= 2) maps to bucket (m - 1) * 4 + s, where s is the two bits below the MSB.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_profile.h"  /**< Profiler interface */
+#include "adt7320_metrics.h"  /**< DWT cycle counter helpers */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Reads the cycle counter.
+ *
+ * @return Current cycle count (0 when no counter is available).
+ */
+static uint32_t ADT7320_Profile_Cycles(void)
+{
+#if (ADT7320_HAS_DWT == 1U)
+    return DWT->CYCCNT;
+#else
+    return 0U;
+#endif
+}
+
+/**
+ * @brief  Maps a latency to its histogram bucket.
+ *
+ * @param[in] value  Latency in cycles.
+ *
+ * @return Bucket index.
+ */
+static uint32_t ADT7320_Profile_Bucket(uint32_t value)
+{
+    uint32_t bucket = value;
+    uint32_t msb    = 31U;
+
+    if (value >= 4U)
+    {
+        while ((value & (1UL << msb)) == 0U)
+        {
+            msb--;
+        }
+        bucket = ((msb - 1U) * 4U) + ((value >> (msb - 2U)) & 3U);
+    }
+
+    return bucket;
+}
+
+/**
+ * @brief  Returns the largest latency that falls into a bucket.
+ *
+ * @param[in] bucket  Bucket index.
+ *
+ * @return Upper bound in cycles, saturated to 0xFFFFFFFF.
+ */
+static uint32_t ADT7320_Profile_BucketMax(uint32_t bucket)
+{
+    uint64_t upper = bucket;
+    uint32_t msb   = 0U;
+
+    if (bucket >= 4U)
+    {
+        msb   = (bucket / 4U) + 1U;
+        upper = (((uint64_t)(4U + (bucket % 4U)) + 1U) << (msb - 2U)) - 1U;
+    }
+
+    return (upper > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)upper;
+}
+
+/**
+ * @brief  Returns the latency below which a given share of samples falls.
+ *
+ * @param[in] pProf     Pointer to the profiler state.
+ * @param[in] permille  Requested percentile in 1/1000.
+ *
+ * @return Upper bound of the bucket holding the percentile, in cycles.
+ */
+static uint32_t ADT7320_Profile_Percentile(const ADT7320_ProfileTypeDef *pProf, uint32_t permille)
+{
+    uint64_t target = (((uint64_t)pProf->samples * permille) + 999U) / 1000U;
+    uint64_t seen   = 0U;
+    uint32_t result = 0U;
+    uint8_t  found  = 0U;
+
+    for (uint32_t b = 0U; (b < ADT7320_PROFILE_BUCKETS) && (found == 0U); b++)
+    {
+        seen += pProf->hist[b];
+        if ( (seen >= target) && (pProf->hist[b] != 0U) )
+        {
+            result = ADT7320_Profile_BucketMax(b);
+            found  = 1U;
+        }
+    }
+
+    return (result > pProf->maxCycles) ? pProf->maxCycles : result;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Clears the profiler and enables the DWT cycle counter.
+ *
+ * @param[out] pProf  Pointer to the profiler state.
+ *
+ * @retval ADT7320_OK     Profiler ready
+ * @retval ADT7320_ERROR  Invalid parameters or no cycle counter on this core
+ */
+ADT7320_StatusTypeDef ADT7320_Profile_Init(ADT7320_ProfileTypeDef *pProf)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pProf == NULL) || (ADT7320_HAS_DWT == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint32_t b = 0U; b < ADT7320_PROFILE_BUCKETS; b++)
+        {
+            pProf->hist[b] = 0U;
+        }
+        pProf->totalCycles = 0U;
+        pProf->maxCycles   = 0U;
+        pProf->samples     = 0U;
+        pProf->errors      = 0U;
+        pProf->sweeps      = 0U;
+        pProf->startTick   = 0U;
+        pProf->lastTick    = 0U;
+
+        ADT7320_DWT_Enable();
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Reads the temperature of every sensor once, timing each read.
+ *
+ * @param[in,out] pProf     Pointer to the profiler state.
+ * @param[in]     pSensors  Array of sensor configurations.
+ * @param[in]     count     Number of sensors.
+ * @param[out]    pRaw      Raw ADT7320_TEMP codes, one per sensor (may be NULL).
+ *
+ * @retval ADT7320_OK     All reads successful
+ * @retval ADT7320_ERROR  Invalid parameters or at least one read failed
+ */
+ADT7320_StatusTypeDef ADT7320_Profile_Sweep(ADT7320_ProfileTypeDef *pProf, const ADT7320_ConfigTypeDef *pSensors,
+                                            uint16_t count, int16_t *pRaw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_StatusTypeDef result = ADT7320_OK;
+    uint16_t data  = 0U;
+    uint32_t start = 0U;
+
+    if ( (pProf == NULL) || (pSensors == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        if (pProf->sweeps == 0U)
+        {
+            pProf->startTick = HAL_GetTick();
+        }
+
+        for (uint16_t i = 0U; i < count; i++)
+        {
+            start  = ADT7320_Profile_Cycles();
+            result = ADT7320_ReadRegister(&pSensors[i], ADT7320_TEMP, 2U, &data);
+            ADT7320_Profile_Record(pProf, ADT7320_Profile_Cycles() - start, result);
+
+            if (result != ADT7320_OK)
+            {
+                status = ADT7320_ERROR;
+            }
+
+            if (pRaw != NULL)
+            {
+                pRaw[i] = (int16_t)data;
+            }
+        }
+
+        ADT7320_Profile_EndSweep(pProf);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Records one read timed by the caller (e.g. started and completed through an async bus).
+ *
+ * @param[in,out] pProf   Pointer to the profiler state.
+ * @param[in]     cycles  Read latency, in cycles.
+ * @param[in]     status  Outcome of the read.
+ */
+void ADT7320_Profile_Record(ADT7320_ProfileTypeDef *pProf, uint32_t cycles, ADT7320_StatusTypeDef status)
+{
+    if (pProf != NULL)
+    {
+        if ( (pProf->sweeps == 0U) && (pProf->samples == 0U) )
+        {
+            pProf->startTick = HAL_GetTick();
+        }
+
+        if (status != ADT7320_OK)
+        {
+            pProf->errors++;
+        }
+
+        pProf->hist[ADT7320_Profile_Bucket(cycles)]++;
+        pProf->totalCycles += cycles;
+        pProf->samples++;
+        if (cycles > pProf->maxCycles)
+        {
+            pProf->maxCycles = cycles;
+        }
+    }
+}
+
+/**
+ * @brief  Counts one sweep whose reads were added with ADT7320_Profile_Record().
+ *
+ * @param[in,out] pProf  Pointer to the profiler state.
+ */
+void ADT7320_Profile_EndSweep(ADT7320_ProfileTypeDef *pProf)
+{
+    if (pProf != NULL)
+    {
+        pProf->sweeps++;
+        pProf->lastTick = HAL_GetTick();
+    }
+}
+
+/**
+ * @brief  Computes sweep rate, latency percentiles and cycles per sample.
+ *
+ * @param[in]  pProf    Pointer to the profiler state.
+ * @param[out] pReport  Summary.
+ *
+ * @retval ADT7320_OK     Report computed
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Profile_GetReport(const ADT7320_ProfileTypeDef *pProf, ADT7320_ProfileReportTypeDef *pReport)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint32_t elapsed = 0U;
+
+    if ( (pProf == NULL) || (pReport == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        elapsed = pProf->lastTick - pProf->startTick;
+
+        pReport->sweeps          = pProf->sweeps;
+        pReport->samples         = pProf->samples;
+        pReport->errors          = pProf->errors;
+        pReport->sweepsPerKSec   = (elapsed == 0U) ? 0U : (uint32_t)(((uint64_t)pProf->sweeps * 1000000U) / elapsed);
+        pReport->cyclesPerSample = (pProf->samples == 0U) ? 0U : (uint32_t)(pProf->totalCycles / pProf->samples);
+        pReport->p50             = ADT7320_Profile_Percentile(pProf, 500U);
+        pReport->p95             = ADT7320_Profile_Percentile(pProf, 950U);
+        pReport->p99             = ADT7320_Profile_Percentile(pProf, 990U);
+        pReport->max             = pProf->maxCycles;
+    }
+
+    return status;
+}
+
+
+/* adt7320_profile.c */
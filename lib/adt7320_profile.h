@@ -0,0 +1,147 @@
+/**
+ * @file    adt7320_profile.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   On-target sweep profiler for arrays of ADT7320 sensors.
+ *
+ * @details
+ * Reads an array of sensors in sweeps and measures every read with the DWT cycle counter.
+ * Latencies are binned in a log-linear histogram (4 sub-buckets per power of two, so each
+ * bucket spans at most 25 % of its value), which yields p50/p95/p99 in constant memory.
+ *
+ * The report gives the achieved sweep rate, latency percentiles and mean cycles per
+ * sample, so sensor count and bus layout can be scaled on real hardware and compared run
+ * to run. Reads done elsewhere (e.g. completed by an adt7320_async.h callback) are timed
+ * by the caller and added with ADT7320_Profile_Record() and ADT7320_Profile_EndSweep().
+ *
+ * cyclesPerSample is the mean latency of a read, from its start to its result. The
+ * blocking reads of ADT7320_Profile_Sweep() keep the CPU for that whole time, so there
+ * it is also the CPU cost per sample; an interrupt or DMA read costs the CPU only the
+ * start and the completion interrupt, a fraction of its latency.
+ *
+ * @note
+ * Requires a Cortex-M3 or higher core (DWT cycle counter). On Cortex-M0/M0+ parts
+ * (F0, G0, L0, U0) ADT7320_Profile_Init() returns ADT7320_ERROR.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_PROFILE_H
+#define ADT7320_PROFILE_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Number of latency histogram buckets (4 per power of two, 32 powers) */
+#define  ADT7320_PROFILE_BUCKETS  (128U)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Profiler state.
+ */
+typedef struct
+{
+    uint32_t hist[ADT7320_PROFILE_BUCKETS];  /**< Read latency histogram, in cycles */
+    uint64_t totalCycles;                    /**< Sum of read latencies */
+    uint32_t maxCycles;                      /**< Worst read latency */
+    uint32_t samples;                        /**< Number of reads */
+    uint32_t errors;                         /**< Number of failed reads */
+    uint32_t sweeps;                         /**< Number of completed sweeps */
+    uint32_t startTick;                      /**< HAL_GetTick() at the first sweep */
+    uint32_t lastTick;                       /**< HAL_GetTick() at the last sweep */
+} ADT7320_ProfileTypeDef;
+
+/**
+ * @brief Summary computed by ADT7320_Profile_GetReport().
+ */
+typedef struct
+{
+    uint32_t sweeps;           /**< Completed sweeps */
+    uint32_t samples;          /**< Sensor reads */
+    uint32_t errors;           /**< Failed reads */
+    uint32_t sweepsPerKSec;    /**< Achieved sweep rate, in sweeps per 1000 s */
+    uint32_t cyclesPerSample;  /**< Mean read latency, in cycles (blocking latency, not CPU time, for async reads) */
+    uint32_t p50;              /**< Median read latency, in cycles (bucket upper bound) */
+    uint32_t p95;              /**< 95th percentile read latency, in cycles */
+    uint32_t p99;              /**< 99th percentile read latency, in cycles */
+    uint32_t max;              /**< Worst read latency, in cycles */
+} ADT7320_ProfileReportTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Clears the profiler and enables the DWT cycle counter.
+ *
+ * @param[out] pProf  Pointer to the profiler state.
+ *
+ * @retval ADT7320_OK     Profiler ready
+ * @retval ADT7320_ERROR  Invalid parameters or no cycle counter on this core
+ */
+ADT7320_StatusTypeDef ADT7320_Profile_Init(ADT7320_ProfileTypeDef *pProf);
+
+/**
+ * @brief  Reads the temperature of every sensor once, timing each read.
+ *
+ * @param[in,out] pProf     Pointer to the profiler state.
+ * @param[in]     pSensors  Array of sensor configurations.
+ * @param[in]     count     Number of sensors.
+ * @param[out]    pRaw      Raw ADT7320_TEMP codes, one per sensor (may be NULL).
+ *
+ * @retval ADT7320_OK     All reads successful
+ * @retval ADT7320_ERROR  Invalid parameters or at least one read failed
+ */
+ADT7320_StatusTypeDef ADT7320_Profile_Sweep(ADT7320_ProfileTypeDef *pProf, const ADT7320_ConfigTypeDef *pSensors,
+                                            uint16_t count, int16_t *pRaw);
+
+/**
+ * @brief  Records one read timed by the caller (e.g. started and completed through an async bus).
+ *
+ * @param[in,out] pProf   Pointer to the profiler state.
+ * @param[in]     cycles  Read latency, in cycles.
+ * @param[in]     status  Outcome of the read.
+ */
+void ADT7320_Profile_Record(ADT7320_ProfileTypeDef *pProf, uint32_t cycles, ADT7320_StatusTypeDef status);
+
+/**
+ * @brief  Counts one sweep whose reads were added with ADT7320_Profile_Record().
+ *
+ * @param[in,out] pProf  Pointer to the profiler state.
+ */
+void ADT7320_Profile_EndSweep(ADT7320_ProfileTypeDef *pProf);
+
+/**
+ * @brief  Computes sweep rate, latency percentiles and cycles per sample.
+ *
+ * @param[in]  pProf    Pointer to the profiler state.
+ * @param[out] pReport  Summary.
+ *
+ * @retval ADT7320_OK     Report computed
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Profile_GetReport(const ADT7320_ProfileTypeDef *pProf, ADT7320_ProfileReportTypeDef *pReport);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_PROFILE_H */
@@ -0,0 +1,252 @@
+/**
+ * @file    adt7320_rollup.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Multi-resolution min/max/mean rollup of raw temperature samples.
+ *
+ * @details
+ * ADT7320_Rollup_Add() walks the tiers iteratively: a sample is merged into tier 0, and
+ * whenever merging closes a bucket, the closed bucket becomes the input of the next tier.
+ * At any time, tier k (closed + open) plus the open buckets of tiers 0 .. k-1 together hold
+ * every retained sample exactly once, which is what ADT7320_Rollup_Query() relies on.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_rollup.h"  /**< Rollup interface */
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+/** @brief Bucket period of each tier, in ms */
+static const uint32_t adt7320_rollupPeriod[ADT7320_ROLLUP_TIERS] = ADT7320_ROLLUP_PERIODS_MS;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Merges one bucket into another.
+ *
+ * @param[in,out] pDst  Destination bucket (must hold at least one sample).
+ * @param[in]     pSrc  Source bucket.
+ */
+static void ADT7320_Rollup_Merge(ADT7320_RollupBucketTypeDef *pDst, const ADT7320_RollupBucketTypeDef *pSrc)
+{
+    pDst->count += pSrc->count;
+    pDst->sum   += pSrc->sum;
+
+    if (pSrc->min < pDst->min)
+    {
+        pDst->min = pSrc->min;
+    }
+    if (pSrc->max > pDst->max)
+    {
+        pDst->max = pSrc->max;
+    }
+}
+
+/**
+ * @brief  Adds a bucket to a query result if it overlaps the range.
+ *
+ * @param[in,out] pAcc    Accumulator bucket.
+ * @param[in]     pB      Candidate bucket.
+ * @param[in]     period  Period of the candidate's tier, in ms.
+ * @param[in]     from    Start of the range, in ms.
+ * @param[in]     to      End of the range, in ms.
+ */
+static void ADT7320_Rollup_Collect(ADT7320_RollupBucketTypeDef *pAcc, const ADT7320_RollupBucketTypeDef *pB,
+                                   uint32_t period, uint32_t from, uint32_t to)
+{
+    if ( (pB->count != 0U) && (pB->start < to) && ((pB->start + period) > from) )
+    {
+        if (pAcc->count == 0U)
+        {
+            *pAcc = *pB;
+        }
+        else
+        {
+            ADT7320_Rollup_Merge(pAcc, pB);
+        }
+    }
+}
+
+/**
+ * @brief  Returns the oldest time a tier still holds.
+ *
+ * @param[in] pTier  Tier.
+ *
+ * @return Start of the oldest closed bucket, or 0 if the tier has not dropped any yet.
+ */
+static uint32_t ADT7320_Rollup_Horizon(const ADT7320_RollupTierTypeDef *pTier)
+{
+    /* When the ring is full, head is the oldest slot */
+    return (pTier->used < ADT7320_ROLLUP_DEPTH) ? 0U : pTier->ring[pTier->head].start;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Clears all tiers.
+ *
+ * @param[out] pRoll  Pointer to the rollup state.
+ *
+ * @retval ADT7320_OK     Rollup ready
+ * @retval ADT7320_ERROR  Invalid parameters or invalid ADT7320_ROLLUP_PERIODS_MS
+ */
+ADT7320_StatusTypeDef ADT7320_Rollup_Init(ADT7320_RollupTypeDef *pRoll)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pRoll == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint8_t t = 0U; t < ADT7320_ROLLUP_TIERS; t++)
+        {
+            if ( (adt7320_rollupPeriod[t] == 0U) ||
+                 ( (t > 0U) && ((adt7320_rollupPeriod[t] % adt7320_rollupPeriod[t - 1U]) != 0U) ) )
+            {
+                status = ADT7320_ERROR;
+            }
+
+            pRoll->tier[t].open.count = 0U;
+            pRoll->tier[t].head       = 0U;
+            pRoll->tier[t].used       = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Adds one sample. Ticks must be non-decreasing.
+ *
+ * @param[in,out] pRoll  Pointer to the rollup state.
+ * @param[in]     tick   Sample time, in ms.
+ * @param[in]     raw    Raw ADT7320_TEMP code.
+ */
+void ADT7320_Rollup_Add(ADT7320_RollupTypeDef *pRoll, uint32_t tick, int16_t raw)
+{
+    ADT7320_RollupBucketTypeDef carry  = { tick, 1U, raw, raw, raw };
+    ADT7320_RollupBucketTypeDef closed = { 0U, 0U, 0, 0, 0 };
+    ADT7320_RollupTierTypeDef  *pTier  = NULL;
+    uint8_t  more   = 1U;
+    uint32_t period = 0U;
+
+    for (uint8_t t = 0U; (t < ADT7320_ROLLUP_TIERS) && (more != 0U); t++)
+    {
+        pTier  = &pRoll->tier[t];
+        period = adt7320_rollupPeriod[t];
+        more   = 0U;
+
+        if ( (pTier->open.count != 0U) && ((carry.start - pTier->open.start) >= period) )
+        {
+            closed = pTier->open;
+            pTier->ring[pTier->head] = closed;
+            pTier->head = (uint16_t)((pTier->head + 1U) % ADT7320_ROLLUP_DEPTH);
+            if (pTier->used < ADT7320_ROLLUP_DEPTH)
+            {
+                pTier->used++;
+            }
+            pTier->open.count = 0U;
+            more = 1U;
+        }
+
+        if (pTier->open.count == 0U)
+        {
+            pTier->open       = carry;
+            pTier->open.start = carry.start - (carry.start % period);
+        }
+        else
+        {
+            ADT7320_Rollup_Merge(&pTier->open, &carry);
+        }
+
+        carry = closed;
+    }
+}
+
+/**
+ * @brief  Aggregates all samples whose bucket overlaps [from, to).
+ *
+ * Results are exact at bucket granularity of the tier that answered: the finest tier
+ * still holding @p from, else the coarsest one, with a partial result.
+ *
+ * @param[in]  pRoll    Pointer to the rollup state.
+ * @param[in]  from     Start of the range, in ms.
+ * @param[in]  to       End of the range, in ms.
+ * @param[out] pResult  Aggregate of the range.
+ *
+ * @retval ADT7320_OK     Result returned
+ * @retval ADT7320_ERROR  Invalid parameters or no sample in range
+ */
+ADT7320_StatusTypeDef ADT7320_Rollup_Query(const ADT7320_RollupTypeDef *pRoll, uint32_t from, uint32_t to,
+                                           ADT7320_RollupResultTypeDef *pResult)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_RollupBucketTypeDef acc = { 0U, 0U, 0, 0, 0 };
+    const ADT7320_RollupTierTypeDef *pTier = NULL;
+    uint8_t  k       = ADT7320_ROLLUP_TIERS - 1U;
+    uint32_t horizon = 0U;
+
+    if ( (pRoll == NULL) || (pResult == NULL) || (to <= from) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        /* Finest tier that still reaches back to from, else the coarsest one */
+        for (uint8_t t = ADT7320_ROLLUP_TIERS; t > 0U; t--)
+        {
+            if (ADT7320_Rollup_Horizon(&pRoll->tier[t - 1U]) <= from)
+            {
+                k = (uint8_t)(t - 1U);
+            }
+        }
+
+        horizon = ADT7320_Rollup_Horizon(&pRoll->tier[k]);
+
+        pTier = &pRoll->tier[k];
+        for (uint16_t i = 0U; i < pTier->used; i++)
+        {
+            ADT7320_Rollup_Collect(&acc, &pTier->ring[i], adt7320_rollupPeriod[k], from, to);
+        }
+
+        /* Open buckets of tier k and below are not merged upwards yet */
+        for (uint8_t t = 0U; t <= k; t++)
+        {
+            ADT7320_Rollup_Collect(&acc, &pRoll->tier[t].open, adt7320_rollupPeriod[t], from, to);
+        }
+
+        if (acc.count == 0U)
+        {
+            status = ADT7320_ERROR;
+        }
+        else
+        {
+            pResult->count      = acc.count;
+            pResult->min        = acc.min;
+            pResult->max        = acc.max;
+            pResult->mean       = (int16_t)((acc.sum >= 0) ? ((acc.sum + (int64_t)(acc.count / 2U)) / (int64_t)acc.count)
+                                                           : ((acc.sum - (int64_t)(acc.count / 2U)) / (int64_t)acc.count));
+            pResult->resolution = adt7320_rollupPeriod[k];
+            pResult->partial    = (uint8_t)(horizon > from);
+            pResult->covered    = (horizon > from) ? horizon : from;
+        }
+    }
+
+    return status;
+}
+
+
+/* adt7320_rollup.c */
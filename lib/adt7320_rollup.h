@@ -0,0 +1,134 @@
+/**
+ * @file    adt7320_rollup.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Multi-resolution min/max/mean rollup of raw temperature samples.
+ *
+ * @details
+ * Samples go into the open bucket of the finest tier. When a bucket's period elapses it is
+ * closed into that tier's ring and merged into the open bucket of the next coarser tier, so
+ * every sample is touched once and each coarser tier only sees one merge per finer bucket.
+ *
+ * Each tier keeps ADT7320_ROLLUP_DEPTH closed buckets, so it reaches back about
+ * ADT7320_ROLLUP_DEPTH periods. A range query is answered by the finest tier that still
+ * holds the start of the range, plus the open buckets of finer tiers that have not been
+ * merged upwards yet; older ranges fall back to coarser tiers. When even the coarsest
+ * tier has dropped the start of the range, the result covers what is left and says so.
+ *
+ * All values are raw ADT7320_TEMP codes and all storage is sized in @ref adt7320_config.h.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_ROLLUP_H
+#define ADT7320_ROLLUP_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Aggregate of the samples of one period.
+ */
+typedef struct
+{
+    uint32_t start;  /**< Tick (ms) at the start of the period */
+    uint32_t count;  /**< Number of samples */
+    int64_t  sum;    /**< Sum of raw codes */
+    int16_t  min;    /**< Lowest raw code */
+    int16_t  max;    /**< Highest raw code */
+} ADT7320_RollupBucketTypeDef;
+
+/**
+ * @brief One resolution tier.
+ */
+typedef struct
+{
+    ADT7320_RollupBucketTypeDef ring[ADT7320_ROLLUP_DEPTH];  /**< Closed buckets, oldest overwritten first */
+    ADT7320_RollupBucketTypeDef open;                        /**< Bucket being filled */
+    uint16_t head;                                           /**< Next ring slot to write */
+    uint16_t used;                                           /**< Number of valid ring slots */
+} ADT7320_RollupTierTypeDef;
+
+/**
+ * @brief Rollup state of one sensor.
+ */
+typedef struct
+{
+    ADT7320_RollupTierTypeDef tier[ADT7320_ROLLUP_TIERS];  /**< Tiers, finest first */
+} ADT7320_RollupTypeDef;
+
+/**
+ * @brief Result of a range query.
+ */
+typedef struct
+{
+    uint32_t count;       /**< Number of samples in the range */
+    int16_t  min;         /**< Lowest raw code */
+    int16_t  max;         /**< Highest raw code */
+    int16_t  mean;        /**< Mean raw code (rounded) */
+    uint32_t resolution;  /**< Period of the tier that answered, in ms */
+    uint32_t covered;     /**< Start of the part of the range the result covers, in ms */
+    uint8_t  partial;     /**< Non-zero if samples before covered were already dropped */
+} ADT7320_RollupResultTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Clears all tiers.
+ *
+ * @param[out] pRoll  Pointer to the rollup state.
+ *
+ * @retval ADT7320_OK     Rollup ready
+ * @retval ADT7320_ERROR  Invalid parameters or invalid ADT7320_ROLLUP_PERIODS_MS
+ */
+ADT7320_StatusTypeDef ADT7320_Rollup_Init(ADT7320_RollupTypeDef *pRoll);
+
+/**
+ * @brief  Adds one sample. Ticks must be non-decreasing.
+ *
+ * @param[in,out] pRoll  Pointer to the rollup state.
+ * @param[in]     tick   Sample time, in ms.
+ * @param[in]     raw    Raw ADT7320_TEMP code.
+ */
+void ADT7320_Rollup_Add(ADT7320_RollupTypeDef *pRoll, uint32_t tick, int16_t raw);
+
+/**
+ * @brief  Aggregates all samples whose bucket overlaps [from, to).
+ *
+ * Results are exact at bucket granularity of the tier that answered: the finest tier
+ * still holding @p from, else the coarsest one, with a partial result.
+ *
+ * @param[in]  pRoll    Pointer to the rollup state.
+ * @param[in]  from     Start of the range, in ms.
+ * @param[in]  to       End of the range, in ms.
+ * @param[out] pResult  Aggregate of the range.
+ *
+ * @retval ADT7320_OK     Result returned
+ * @retval ADT7320_ERROR  Invalid parameters or no sample in range
+ */
+ADT7320_StatusTypeDef ADT7320_Rollup_Query(const ADT7320_RollupTypeDef *pRoll, uint32_t from, uint32_t to,
+                                           ADT7320_RollupResultTypeDef *pResult);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_ROLLUP_H */
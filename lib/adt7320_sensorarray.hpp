@@ -0,0 +1,286 @@
+/**
+ * @file    adt7320_sensorarray.hpp
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   C++ fixed-size sensor array with precomputed chip-select words and batch operations.
+ *
+ * @details
+ * adt7320::SensorArray<N> holds N sensor configurations in std::array storage and never
+ * allocates. The sensor count, and with it every internal table, is fixed at compile
+ * time. GPIO port addresses are not constant expressions on STM32 (GPIOx is a cast of
+ * an address), so the constructor resolves each chip select once: every sensor gets its
+ * BSRR set/reset words, so CS toggling is one store.
+ *
+ * Batch operations:
+ *
+ * - read_all() reads the temperature register of every sensor, one 3-byte
+ *   transaction each, from a constant command buffer;
+ * - write_all() / configure_all() write the same register of every sensor, one write
+ *   per sensor. Several ADT7320 selected at once would all drive DOUT, which the part
+ *   does not support, so there is no multicast write.
+ *
+ * @code
+ * adt7320::SensorArray<4U> sensors({{ {&hspi1, GPIOA, GPIO_PIN_4}, {&hspi1, GPIOA, GPIO_PIN_5},
+ *                                     {&hspi1, GPIOB, GPIO_PIN_0}, {&hspi1, GPIOB, GPIO_PIN_1} }});
+ * std::array<int32_t, 4U> raw;
+ * sensors.configure_all(0x80U);
+ * sensors.read_all(raw);
+ * @endcode
+ *
+ * @note A sensor whose configuration fails ADT7320_IsValid() (e.g. no CS port without
+ *       ADT7320_HW_NSS) is never clocked: read_all() stores invalid for it.
+ * @note A hardware NSS sensor (csPort = nullptr) must be alone on its SPI. An array that
+ *       fails ADT7320_IsNssExclusive() never clocks the bus: read_all() and write_all()
+ *       return ADT7320_ERROR.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_SENSORARRAY_HPP
+#define ADT7320_SENSORARRAY_HPP
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <array>              /**< std::array storage */
+#include <cstddef>            /**< std::size_t */
+#include <cstdint>            /**< Fixed-width integer types */
+#if defined (__has_include)
+    #if __has_include(<span>)
+        #include <span>       /**< std::span overloads (C++20) */
+    #endif
+#endif
+#include "adt7320.h"          /**< ADT7320 driver interface and configuration */
+#include "adt7320_metrics.h"  /**< Metric recording hooks (no-ops unless ADT7320_METRICS_ENABLE) */
+#include "adt7320_trace.h"    /**< Bus-traffic trace hook (no-op unless ADT7320_TRACE_ENABLE) */
+
+
+namespace adt7320
+{
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Fixed-size array of ADT7320 sensors.
+ *
+ * @tparam N  Number of sensors.
+ */
+template <std::size_t N>
+class SensorArray
+{
+    static_assert(N > 0U, "SensorArray needs at least one sensor");
+
+public:
+
+    /** @brief Value stored by read_all() for a sensor whose read failed */
+    static constexpr int32_t invalid = INT32_MIN;
+
+    /**
+     * @brief  Builds the array and precomputes the chip-select words.
+     *
+     * @param[in] configs  Sensor configurations.
+     */
+    explicit SensorArray(const std::array<ADT7320_ConfigTypeDef, N> &configs) noexcept
+        : sensors(configs), csAssert{}, csRelease{},
+          exclusive(ADT7320_IsNssExclusive(configs.data(), static_cast<uint32_t>(N)) != 0U)
+    {
+        for (std::size_t s = 0U; s < N; s++)
+        {
+            csAssert[s]  = (static_cast<uint32_t>(sensors[s].csPin) << 16U);
+            csRelease[s] = static_cast<uint32_t>(sensors[s].csPin);
+        }
+    }
+
+    /** @brief Number of sensors */
+    static constexpr std::size_t size() noexcept { return N; }
+
+    /** @brief Configuration of one sensor, for the C API */
+    const ADT7320_ConfigTypeDef &operator[](std::size_t index) const noexcept { return sensors[index]; }
+
+    /** @brief Range-based iteration over the sensor configurations */
+    typename std::array<ADT7320_ConfigTypeDef, N>::const_iterator begin() const noexcept { return sensors.begin(); }
+    typename std::array<ADT7320_ConfigTypeDef, N>::const_iterator end() const noexcept { return sensors.end(); }
+
+    /**
+     * @brief  Reads the temperature of every sensor.
+     *
+     * @param[out] pRaw   Raw ADT7320_TEMP codes (1/128 °C), or invalid for failed reads.
+     * @param[in]  count  Number of entries in pRaw (must be N).
+     *
+     * @retval ADT7320_OK     All sensors read
+     * @retval ADT7320_ERROR  Invalid parameters, an invalid sensor configuration, a shared hardware NSS SPI
+     *                        or at least one read failed
+     */
+    ADT7320_StatusTypeDef read_all(int32_t *pRaw, std::size_t count) noexcept
+    {
+        static const uint8_t command[3U] = { static_cast<uint8_t>(ADT7320_READ | (ADT7320_TEMP << 3U)), ADT7320_DUMMY, ADT7320_DUMMY };
+        ADT7320_StatusTypeDef status = ADT7320_OK;
+        ADT7320_StatusTypeDef result = ADT7320_OK;
+        uint8_t  rx[3U] = {0U};
+        uint32_t start  = 0U;
+
+        if ( (pRaw == nullptr) || (count != N) )
+        {
+            status = ADT7320_ERROR;
+        }
+        else if (!exclusive)
+        {
+            /* NSS would select every device on the SPI at once */
+            for (std::size_t s = 0U; s < N; s++)
+            {
+                pRaw[s] = invalid;
+            }
+            status = ADT7320_ERROR;
+        }
+        else
+        {
+            for (std::size_t s = 0U; s < N; s++)
+            {
+                if (ADT7320_IsValid(&sensors[s]) == 0U)
+                {
+                    /* No chip select to drive: the bus is never clocked for this sensor */
+                    result = ADT7320_ERROR;
+                }
+                else
+                {
+                    assert_cs(s);
+                    ADT7320_TRACE_SPI(command, 3U);
+                    start  = ADT7320_METRIC_NOW();
+                    result = static_cast<ADT7320_StatusTypeDef>(HAL_SPI_TransmitReceive(sensors[s].SPIx, const_cast<uint8_t *>(command), rx, 3U,
+                                                                                        ADT7320_MAX_DELAY));
+                    ADT7320_METRIC_SPI(result, start);
+                    release_cs(s);
+                }
+
+                if (result == ADT7320_OK)
+                {
+                    pRaw[s] = static_cast<int16_t>((static_cast<uint16_t>(rx[1U]) << 8U) | rx[2U]);
+                }
+                else
+                {
+                    pRaw[s] = invalid;
+                    status  = ADT7320_ERROR;
+                }
+            }
+        }
+
+        return status;
+    }
+
+    /**
+     * @brief  Reads the temperature of every sensor.
+     *
+     * @param[out] raw  Raw ADT7320_TEMP codes, N entries.
+     *
+     * @retval ADT7320_OK     All sensors read
+     * @retval ADT7320_ERROR  At least one read failed
+     */
+    ADT7320_StatusTypeDef read_all(std::array<int32_t, N> &raw) noexcept
+    {
+        return read_all(raw.data(), N);
+    }
+
+#if defined (__cpp_lib_span)
+    /**
+     * @brief  Reads the temperature of every sensor.
+     *
+     * @param[out] raw  Raw ADT7320_TEMP codes (size must be N).
+     *
+     * @retval ADT7320_OK     All sensors read
+     * @retval ADT7320_ERROR  Wrong size or at least one read failed
+     */
+    ADT7320_StatusTypeDef read_all(std::span<int32_t> raw) noexcept
+    {
+        return read_all(raw.data(), raw.size());
+    }
+#endif  /* __cpp_lib_span */
+
+    /**
+     * @brief  Writes the same value to a register of every sensor, one write per sensor.
+     *
+     * @param[in] reg       Register address.
+     * @param[in] dataSize  Number of bytes to write (1 or 2).
+     * @param[in] data      Value to write.
+     *
+     * @retval ADT7320_OK     All sensors written
+     * @retval ADT7320_ERROR  Invalid parameters, a shared hardware NSS SPI or SPI failure
+     * @retval ADT7320_BUSY   SPI peripheral is busy
+     * @retval ADT7320_TIMEOUT  SPI operation timed out
+     */
+    ADT7320_StatusTypeDef write_all(uint8_t reg, uint8_t dataSize, uint16_t data) noexcept
+    {
+        ADT7320_StatusTypeDef status = ADT7320_OK;
+
+        if ( (dataSize == 0U) || (dataSize > 2U) || !exclusive )
+        {
+            status = ADT7320_ERROR;
+        }
+        else
+        {
+            for (std::size_t s = 0U; (s < N) && (status == ADT7320_OK); s++)
+            {
+                status = ADT7320_WriteRegister(&sensors[s], reg, dataSize, data);
+            }
+        }
+
+        return status;
+    }
+
+    /**
+     * @brief  Writes the configuration register of every sensor.
+     *
+     * @param[in] config  ADT7320_CONFIG value.
+     *
+     * @retval ADT7320_OK     All sensors configured
+     * @retval ADT7320_ERROR  SPI failure
+     * @retval ADT7320_BUSY   SPI peripheral is busy
+     * @retval ADT7320_TIMEOUT  SPI operation timed out
+     */
+    ADT7320_StatusTypeDef configure_all(uint8_t config) noexcept
+    {
+        return write_all(ADT7320_CONFIG, 1U, config);
+    }
+
+private:
+
+    /** @brief Asserts the chip select of one sensor */
+    void assert_cs(std::size_t s) const noexcept
+    {
+        if (sensors[s].csPort != nullptr)
+        {
+            sensors[s].csPort->BSRR = csAssert[s];
+        }
+        else
+        {
+            ADT7320_Select(&sensors[s]);
+        }
+    }
+
+    /** @brief Releases the chip select of one sensor */
+    void release_cs(std::size_t s) const noexcept
+    {
+        if (sensors[s].csPort != nullptr)
+        {
+            sensors[s].csPort->BSRR = csRelease[s];
+        }
+        else
+        {
+            ADT7320_Deselect(&sensors[s]);
+        }
+    }
+
+    std::array<ADT7320_ConfigTypeDef, N> sensors;  /**< Sensor configurations */
+    std::array<uint32_t, N> csAssert;              /**< BSRR word driving each CS low */
+    std::array<uint32_t, N> csRelease;             /**< BSRR word driving each CS high */
+    bool exclusive;                                /**< No hardware NSS SPI is shared */
+};
+
+}  /* namespace adt7320 */
+
+
+#endif  /* ADT7320_SENSORARRAY_HPP */
@@ -0,0 +1,374 @@
+/**
+ * @file    adt7320_sync.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Sweeps of ADT7320 sensors on several boards, aligned by a shared sync pulse.
+ *
+ * @details
+ * The trigger runs in interrupt context and the reads in the main loop, on the same
+ * SPI. ADT7320_Sync_Poll() raises @c polling before its first transfer; a trigger
+ * that sees it (or a HAL handle that is not ready) only counts the pulse in
+ * @c deferred and returns without touching a chip select. Poll runs the deferred
+ * trigger when it is done, and clears @c polling with interrupts masked only once no
+ * pulse is deferred, so a pulse arriving at any point of ADT7320_Sync_Poll() is never
+ * lost. While @c polling is set the pending sweep is only changed by Poll itself.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_sync.h"     /**< Sync mode interface */
+#include "adt7320_metrics.h"  /**< Metric recording hooks */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Checks that the HAL reports every SPI of the board ready.
+ *
+ * @param[in] pSync  Pointer to the sync state.
+ *
+ * @return Non-zero if no transfer is in progress.
+ */
+static uint8_t ADT7320_Sync_BusFree(const ADT7320_SyncTypeDef *pSync)
+{
+    uint8_t free = 1U;
+
+    for (uint8_t s = 0U; s < pSync->count; s++)
+    {
+        if (HAL_SPI_GetState(pSync->trigger[s].SPIx) != HAL_SPI_STATE_READY)
+        {
+            free = 0U;
+        }
+    }
+
+    return free;
+}
+
+/**
+ * @brief  Writes the one-shot configuration to each sensor and starts a new sweep.
+ *
+ * @param[in,out] pSync   Pointer to the sync state (SPI free).
+ * @param[in]     pulses  Pulses this trigger accounts for (more than 1 after deferred pulses).
+ */
+static void ADT7320_Sync_Start(ADT7320_SyncTypeDef *pSync, uint8_t pulses)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    for (uint8_t s = 0U; s < pSync->count; s++)
+    {
+        if (ADT7320_Prepared_Execute(&pSync->trigger[s], NULL) != ADT7320_OK)
+        {
+            status = ADT7320_ERROR;
+        }
+    }
+
+    if (pSync->pending != 0U)
+    {
+        pSync->missed++;
+        ADT7320_METRIC_INC(ADT7320_METRIC_SYNC_MISSED);
+    }
+
+    /* Deferred pulses beyond the first never got a sweep of their own */
+    pSync->missed   += (uint32_t)pulses - 1U;
+    pSync->pulses   += pulses;
+    pSync->sweepSeq  = pSync->next + ((uint32_t)pulses - 1U);
+    pSync->sweepTick = HAL_GetTick();
+    pSync->next      = pSync->sweepSeq + 1U;
+    pSync->checkTick = pSync->sweepTick;
+    pSync->ready     = 0U;
+    ADT7320_METRIC_ADD(ADT7320_METRIC_SYNC_MISSED, (uint32_t)pulses - 1U);
+
+    if (status == ADT7320_OK)
+    {
+        pSync->pending = 1U;
+    }
+    else
+    {
+        pSync->pending = 0U;
+        pSync->failed++;
+    }
+}
+
+/**
+ * @brief  Reads the RDY bit of the sensors not yet found ready, in order.
+ *
+ * RDY stays low until the temperature is read, so a sensor found ready is not read
+ * again.
+ *
+ * @param[in,out] pSync  Pointer to the sync state (polling, sweep pending).
+ *
+ * @return Non-zero once every sensor has finished its conversion.
+ */
+static uint8_t ADT7320_Sync_Ready(ADT7320_SyncTypeDef *pSync)
+{
+    uint8_t  waiting = 0U;
+    uint16_t data    = 0U;
+
+    while ( (waiting == 0U) && (pSync->ready < pSync->count) )
+    {
+        data = ADT7320_STATUS_NRDY;
+
+        if ( (ADT7320_Prepared_Execute(&pSync->state[pSync->ready], &data) != ADT7320_OK) || ((data & ADT7320_STATUS_NRDY) != 0U) )
+        {
+            waiting = 1U;
+        }
+        else
+        {
+            pSync->ready++;
+        }
+    }
+
+    return (uint8_t)(pSync->ready == pSync->count);
+}
+
+/**
+ * @brief  Runs the deferred triggers, then gives the SPI back to the trigger.
+ *
+ * @param[in,out] pSync  Pointer to the sync state (polling).
+ */
+static void ADT7320_Sync_Release(ADT7320_SyncTypeDef *pSync)
+{
+    uint8_t  pulses  = 0U;
+    uint32_t primask = 0U;
+
+    do
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+
+        pulses          = pSync->deferred;
+        pSync->deferred = 0U;
+
+        if (pulses == 0U)
+        {
+            pSync->polling = 0U;
+        }
+
+        __set_PRIMASK(primask);
+
+        if (pulses != 0U)
+        {
+            ADT7320_Sync_Start(pSync, pulses);
+        }
+    } while (pulses != 0U);
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Prepares the trigger and read transactions and puts the sensors in shutdown.
+ *
+ * @param[out] pSync     Pointer to the sync state.
+ * @param[in]  pFrames   Frame set receiving the sweeps (initialized).
+ * @param[in]  pSensors  Sensor configurations (must outlive the sync state).
+ * @param[in]  count     Number of sensors (<= ADT7320_FRAMES_MAX_SENSORS).
+ * @param[in]  config    ADT7320_CONFIG value; its operation mode bits are replaced.
+ *
+ * @retval ADT7320_OK     Sync mode ready, waiting for the first pulse
+ * @retval ADT7320_ERROR  Invalid parameters, a hardware NSS SPI shared by several sensors, or SPI failure
+ */
+ADT7320_StatusTypeDef ADT7320_Sync_Init(ADT7320_SyncTypeDef *pSync, ADT7320_FramesTypeDef *pFrames, const ADT7320_ConfigTypeDef *pSensors,
+                                        uint8_t count, uint8_t config)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint8_t oneShot  = (uint8_t)((config & (uint8_t)~ADT7320_SYNC_MODE_MASK) | ADT7320_SYNC_ONE_SHOT);
+    uint8_t shutdown = (uint8_t)((config & (uint8_t)~ADT7320_SYNC_MODE_MASK) | ADT7320_SYNC_SHUTDOWN);
+
+    if ( (pSync == NULL) || (pFrames == NULL) || (pSensors == NULL) || (count == 0U) || (count > ADT7320_FRAMES_MAX_SENSORS) ||
+         (ADT7320_IsNssExclusive(pSensors, count) == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pSync->count     = count;
+        pSync->pFrames   = pFrames;
+        pSync->pending   = 0U;
+        pSync->polling   = 0U;
+        pSync->deferred  = 0U;
+        pSync->ready     = 0U;
+        pSync->checkTick = 0U;
+        pSync->next      = 0U;
+        pSync->sweepSeq  = 0U;
+        pSync->sweepTick = 0U;
+        pSync->pulses    = 0U;
+        pSync->missed    = 0U;
+        pSync->failed    = 0U;
+        pSync->deferrals = 0U;
+        pSync->timeouts  = 0U;
+
+        for (uint8_t s = 0U; (s < count) && (status == ADT7320_OK); s++)
+        {
+            status = ADT7320_Prepared_Write(&pSync->trigger[s], &pSensors[s], ADT7320_CONFIG, 1U, oneShot);
+
+            if (status == ADT7320_OK)
+            {
+                status = ADT7320_Prepared_Read(&pSync->state[s], &pSensors[s], ADT7320_STATUS, 1U);
+            }
+
+            if (status == ADT7320_OK)
+            {
+                status = ADT7320_Prepared_Read(&pSync->read[s], &pSensors[s], ADT7320_TEMP, 2U);
+            }
+
+            if (status == ADT7320_OK)
+            {
+                status = ADT7320_WriteRegister(&pSensors[s], ADT7320_CONFIG, 1U, shutdown);
+            }
+        }
+
+        if (status != ADT7320_OK)
+        {
+            pSync->count = 0U;
+            status       = ADT7320_ERROR;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts a one-shot conversion on every sensor (from the sync edge interrupt).
+ *
+ * Deferred to ADT7320_Sync_Poll() if the SPI is in use.
+ *
+ * @param[in,out] pSync  Pointer to the sync state.
+ */
+void ADT7320_Sync_Trigger(ADT7320_SyncTypeDef *pSync)
+{
+    if ( (pSync != NULL) && (pSync->count != 0U) )
+    {
+        if ( (pSync->polling != 0U) || (ADT7320_Sync_BusFree(pSync) == 0U) )
+        {
+            /* A transfer is in progress: no chip select may move until it ends */
+            if (pSync->deferred < 0xFFU)
+            {
+                pSync->deferred++;
+            }
+            pSync->deferrals++;
+            ADT7320_METRIC_INC(ADT7320_METRIC_SYNC_DEFERRED);
+        }
+        else
+        {
+            ADT7320_Sync_Start(pSync, 1U);
+        }
+    }
+}
+
+/**
+ * @brief  Drives a sync pulse on the master board and triggers its own sensors.
+ *
+ * @param[in,out] pSync    Pointer to the sync state.
+ * @param[in]     pPort    GPIO port of the sync line (push-pull output, idle low).
+ * @param[in]     pin      GPIO pin of the sync line.
+ */
+void ADT7320_Sync_Pulse(ADT7320_SyncTypeDef *pSync, GPIO_TypeDef *pPort, uint16_t pin)
+{
+    if (pPort != NULL)
+    {
+        /* The other boards see the edge while the master triggers its own sensors */
+        pPort->BSRR = (uint32_t)pin;
+        ADT7320_Sync_Trigger(pSync);
+        pPort->BSRR = ((uint32_t)pin << 16U);
+    }
+}
+
+/**
+ * @brief  Reads and publishes the pending sweep once its conversions are done, then runs
+ *         a deferred trigger.
+ *
+ * @param[in,out] pSync  Pointer to the sync state.
+ *
+ * @retval ADT7320_OK     Sweep published (per-sensor failures and sensors that timed out are in the frame status)
+ * @retval ADT7320_BUSY   No sweep ready, or no free frame (sweep dropped)
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Sync_Poll(ADT7320_SyncTypeDef *pSync)
+{
+    ADT7320_StatusTypeDef status = ADT7320_BUSY;
+    ADT7320_FrameTypeDef *pFrame = NULL;
+    uint8_t  ready = 0U;
+    uint32_t now   = 0U;
+    uint16_t data  = 0U;
+
+    if (pSync == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pSync->polling = 1U;
+        now            = HAL_GetTick();
+
+        if ( (pSync->pending != 0U) && (now != pSync->checkTick) )
+        {
+            pSync->checkTick = now;
+            ready            = ADT7320_Sync_Ready(pSync);
+
+            if ( (ready == 0U) && ((now - pSync->sweepTick) >= ADT7320_SYNC_TIMEOUT_MS) )
+            {
+                pSync->timeouts++;
+                ready = 1U;
+            }
+        }
+
+        if (ready != 0U)
+        {
+            pSync->pending = 0U;
+            status         = ADT7320_Frames_Begin(pSync->pFrames, &pFrame);
+        }
+
+        if ( (ready != 0U) && (status == ADT7320_OK) )
+        {
+            pFrame->tick  = pSync->sweepTick;
+            pFrame->count = pSync->count;
+
+            for (uint8_t s = 0U; s < pSync->count; s++)
+            {
+                data = 0U;
+
+                if (s < pSync->ready)
+                {
+                    pFrame->status[s] = (uint8_t)ADT7320_Prepared_Execute(&pSync->read[s], &data);
+                }
+                else
+                {
+                    pFrame->status[s] = (uint8_t)ADT7320_TIMEOUT;
+                }
+
+                pFrame->raw[s] = (int16_t)data;
+            }
+
+            status = ADT7320_Frames_PublishSeq(pSync->pFrames, pSync->sweepSeq);
+        }
+
+        ADT7320_Sync_Release(pSync);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Sets the sequence number given to the next pulse.
+ *
+ * @param[in,out] pSync  Pointer to the sync state.
+ * @param[in]     next   Sequence number of the next pulse, as counted by the master.
+ */
+void ADT7320_Sync_Align(ADT7320_SyncTypeDef *pSync, uint32_t next)
+{
+    if (pSync != NULL)
+    {
+        pSync->next = next;
+    }
+}
+
+
+/* adt7320_sync.c */
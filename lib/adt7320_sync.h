@@ -0,0 +1,168 @@
+/**
+ * @file    adt7320_sync.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Sweeps of ADT7320 sensors on several boards, aligned by a shared sync pulse.
+ *
+ * @details
+ * Boards that sample on their own clocks drift apart. In sync mode the sensors stay in
+ * shutdown, and one sync line wired to every board starts all conversions together:
+ *
+ * - the master board drives the line with ADT7320_Sync_Pulse(), which also triggers
+ *   its own sensors;
+ * - every other board calls ADT7320_Sync_Trigger() on the rising edge, from
+ *   HAL_GPIO_EXTI_Callback() or from a timer input capture callback.
+ *
+ * A trigger writes the one-shot mode to the configuration register of each sensor in
+ * turn, which starts one conversion; the sensors of a board start within one 2-byte
+ * write of each other. The writes are prepared at init (adt7320_prepared.h), keeping
+ * the time from edge to conversion start short.
+ *
+ * A trigger never touches a chip select while the SPI is in use: a pulse that arrives
+ * while ADT7320_Sync_Poll() or another driver holds the SPI is deferred, and the
+ * trigger runs at the end of the current (or the next) ADT7320_Sync_Poll().
+ *
+ * ADT7320_Sync_Poll(), called from the main loop, checks the RDY bit of each sensor
+ * (at most once per tick) and reads the results once every conversion is done, or
+ * after ADT7320_SYNC_TIMEOUT_MS, marking the sensors still converting with
+ * ADT7320_TIMEOUT. The sweep is published in a frame (adt7320_frames.h) stamped with
+ * the tick of the trigger and the sequence number of the pulse.
+ *
+ * Each board counts pulses, so frames with the same sequence number come from the same
+ * pulse on every board. A board that starts late or misses pulses is put back in step
+ * with ADT7320_Sync_Align(), using the master's next sequence number sent on any link
+ * (e.g. adt7320_can.h).
+ *
+ * @code
+ * void HAL_GPIO_EXTI_Callback(uint16_t pin) { if (pin == SYNC_Pin) { ADT7320_Sync_Trigger(&sync); } }
+ * @endcode
+ *
+ * @note The pulse period must exceed ADT7320_CONVERSION_MS plus the read time. A pulse
+ *       that arrives while the previous sweep is still unread restarts the conversions
+ *       and the previous sweep is lost (counted in missed).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_SYNC_H
+#define ADT7320_SYNC_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"           /**< ADT7320 driver interface and configuration */
+#include "adt7320_frames.h"    /**< Sweep frames */
+#include "adt7320_prepared.h"  /**< Prepared register transactions */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief ADT7320_CONFIG operation mode field */
+#define  ADT7320_SYNC_MODE_MASK  (0x60U)  ///< Operation mode bits
+#define  ADT7320_SYNC_ONE_SHOT   (0x20U)  ///< One conversion, then shutdown
+#define  ADT7320_SYNC_SHUTDOWN   (0x60U)  ///< Shutdown
+
+/** @brief Longest wait for RDY after a trigger, in ms (ADT7320_CONVERSION_MS is typical, not maximum) */
+#define  ADT7320_SYNC_TIMEOUT_MS  (2U * ADT7320_CONVERSION_MS)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Sync mode state of one board.
+ */
+typedef struct
+{
+    ADT7320_PreparedTypeDef trigger[ADT7320_FRAMES_MAX_SENSORS];  /**< One-shot configuration write of each sensor */
+    ADT7320_PreparedTypeDef state[ADT7320_FRAMES_MAX_SENSORS];    /**< Status read (RDY) of each sensor */
+    ADT7320_PreparedTypeDef read[ADT7320_FRAMES_MAX_SENSORS];     /**< Temperature read of each sensor */
+    uint8_t  count;                                               /**< Number of sensors */
+    ADT7320_FramesTypeDef *pFrames;                               /**< Frame set receiving the sweeps */
+    volatile uint8_t  pending;                                    /**< Conversions started and not yet read */
+    volatile uint8_t  polling;                                    /**< Non-zero while ADT7320_Sync_Poll() owns the SPI */
+    volatile uint8_t  deferred;                                   /**< Pulses received while the SPI was in use */
+    uint8_t  ready;                                               /**< Sensors of the pending sweep found ready */
+    uint32_t checkTick;                                           /**< Tick of the last RDY check */
+    volatile uint32_t next;                                       /**< Sequence number of the next pulse */
+    volatile uint32_t sweepSeq;                                   /**< Sequence number of the pending sweep */
+    volatile uint32_t sweepTick;                                  /**< Tick of the pending sweep's trigger */
+    uint32_t pulses;                                              /**< Pulses received */
+    uint32_t missed;                                              /**< Sweeps restarted before they were read */
+    uint32_t failed;                                              /**< Triggers whose configuration write failed */
+    uint32_t deferrals;                                           /**< Pulses deferred because the SPI was in use */
+    uint32_t timeouts;                                            /**< Sweeps read with a sensor still converting */
+} ADT7320_SyncTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Prepares the trigger and read transactions and puts the sensors in shutdown.
+ *
+ * @param[out] pSync     Pointer to the sync state.
+ * @param[in]  pFrames   Frame set receiving the sweeps (initialized).
+ * @param[in]  pSensors  Sensor configurations (must outlive the sync state).
+ * @param[in]  count     Number of sensors (<= ADT7320_FRAMES_MAX_SENSORS).
+ * @param[in]  config    ADT7320_CONFIG value; its operation mode bits are replaced.
+ *
+ * @retval ADT7320_OK     Sync mode ready, waiting for the first pulse
+ * @retval ADT7320_ERROR  Invalid parameters or SPI failure
+ */
+ADT7320_StatusTypeDef ADT7320_Sync_Init(ADT7320_SyncTypeDef *pSync, ADT7320_FramesTypeDef *pFrames, const ADT7320_ConfigTypeDef *pSensors,
+                                        uint8_t count, uint8_t config);
+
+/**
+ * @brief  Starts a one-shot conversion on every sensor (from the sync edge interrupt).
+ *
+ * Deferred to ADT7320_Sync_Poll() if the SPI is in use.
+ *
+ * @param[in,out] pSync  Pointer to the sync state.
+ */
+void ADT7320_Sync_Trigger(ADT7320_SyncTypeDef *pSync);
+
+/**
+ * @brief  Drives a sync pulse on the master board and triggers its own sensors.
+ *
+ * @param[in,out] pSync    Pointer to the sync state.
+ * @param[in]     pPort    GPIO port of the sync line (push-pull output, idle low).
+ * @param[in]     pin      GPIO pin of the sync line.
+ */
+void ADT7320_Sync_Pulse(ADT7320_SyncTypeDef *pSync, GPIO_TypeDef *pPort, uint16_t pin);
+
+/**
+ * @brief  Reads and publishes the pending sweep once its conversions are done, then runs
+ *         a deferred trigger.
+ *
+ * @param[in,out] pSync  Pointer to the sync state.
+ *
+ * @retval ADT7320_OK     Sweep published (per-sensor failures and sensors that timed out are in the frame status)
+ * @retval ADT7320_BUSY   No sweep ready, or no free frame (sweep dropped)
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Sync_Poll(ADT7320_SyncTypeDef *pSync);
+
+/**
+ * @brief  Sets the sequence number given to the next pulse.
+ *
+ * @param[in,out] pSync  Pointer to the sync state.
+ * @param[in]     next   Sequence number of the next pulse, as counted by the master.
+ */
+void ADT7320_Sync_Align(ADT7320_SyncTypeDef *pSync, uint32_t next);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_SYNC_H */
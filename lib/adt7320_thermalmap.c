@@ -0,0 +1,390 @@
+/**
+ * @file    adt7320_thermalmap.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Interpolated 2D thermal map built from a grid of ADT7320 sensors.
+ *
+ * @details
+ * Weights are stored grouped by sensor (compressed-row layout: offset[s] .. offset[s + 1]),
+ * so ADT7320_Map_Update() walks exactly the cells a sensor contributes to and adjusts each
+ * of them by weight * (new - old). Since the weights of a cell sum to 16384, a cell always
+ * equals the exact Q14 weighted sum of its neighbours' raw codes.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_thermalmap.h"  /**< Thermal map interface */
+
+
+/* --------------------------------- Private Types ---------------------------------- */
+
+/**
+ * @brief Nearest sensors of one cell and their normalized weights.
+ */
+typedef struct
+{
+    uint8_t  count;                              /**< Number of valid neighbours */
+    uint8_t  sensor[ADT7320_MAP_NEIGHBOURS];     /**< Sensor indices, nearest first */
+    uint32_t dist2[ADT7320_MAP_NEIGHBOURS];      /**< Squared distances in cell units */
+    uint16_t weight[ADT7320_MAP_NEIGHBOURS];     /**< Q14 weights, summing to 16384 */
+} ADT7320_MapNeighbourTypeDef;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Finds the nearest sensors of a cell and computes their IDW weights.
+ *
+ * @param[in]  pSensors  Sensor positions.
+ * @param[in]  count     Number of sensors.
+ * @param[in]  x         Column of the cell.
+ * @param[in]  y         Row of the cell.
+ * @param[out] pNb       Neighbour set of the cell.
+ */
+static void ADT7320_Map_Neighbours(const ADT7320_MapSensorTypeDef *pSensors, uint8_t count,
+                                   uint16_t x, uint16_t y, ADT7320_MapNeighbourTypeDef *pNb)
+{
+    uint32_t inv[ADT7320_MAP_NEIGHBOURS] = {0U};
+    uint32_t invSum   = 0U;
+    uint32_t wSum     = 0U;
+    uint8_t  exact    = 0U;
+
+    pNb->count = 0U;
+
+    /* Insertion sort of the K nearest sensors */
+    for (uint8_t s = 0U; s < count; s++)
+    {
+        int32_t  dx = (int32_t)pSensors[s].x - (int32_t)x;
+        int32_t  dy = (int32_t)pSensors[s].y - (int32_t)y;
+        uint32_t d2 = (uint32_t)((dx * dx) + (dy * dy));
+        uint8_t  pos = pNb->count;
+
+        while ( (pos > 0U) && (pNb->dist2[pos - 1U] > d2) )
+        {
+            if (pos < ADT7320_MAP_NEIGHBOURS)
+            {
+                pNb->dist2[pos]  = pNb->dist2[pos - 1U];
+                pNb->sensor[pos] = pNb->sensor[pos - 1U];
+            }
+            pos--;
+        }
+
+        if (pos < ADT7320_MAP_NEIGHBOURS)
+        {
+            pNb->dist2[pos]  = d2;
+            pNb->sensor[pos] = s;
+            if (pNb->count < ADT7320_MAP_NEIGHBOURS)
+            {
+                pNb->count++;
+            }
+        }
+    }
+
+    /* A sensor sitting on the cell takes the whole weight */
+    if (pNb->dist2[0U] == 0U)
+    {
+        pNb->count     = 1U;
+        pNb->weight[0] = (uint16_t)ADT7320_MAP_WEIGHT_ONE;
+        exact          = 1U;
+    }
+
+    if (exact == 0U)
+    {
+        for (uint8_t k = 0U; k < pNb->count; k++)
+        {
+            inv[k]  = (1UL << 24U) / pNb->dist2[k];
+            invSum += inv[k];
+        }
+
+        for (uint8_t k = 0U; k < pNb->count; k++)
+        {
+            pNb->weight[k] = (uint16_t)(((uint64_t)inv[k] * ADT7320_MAP_WEIGHT_ONE) / invSum);
+            wSum += pNb->weight[k];
+        }
+
+        /* Give the rounding remainder to the nearest sensor so weights sum to exactly 16384 */
+        wSum = ADT7320_MAP_WEIGHT_ONE - wSum;
+        pNb->weight[0] = (uint16_t)(pNb->weight[0] + wSum);
+    }
+}
+
+/**
+ * @brief  Converts a cell accumulator back to a raw temperature code (rounded).
+ *
+ * @param[in] acc  Cell accumulator (raw code * 16384).
+ *
+ * @return Raw 16-bit temperature code.
+ */
+static int16_t ADT7320_Map_ToRaw(int32_t acc)
+{
+    int32_t half = (int32_t)(ADT7320_MAP_WEIGHT_ONE / 2U);
+
+    return (int16_t)((acc >= 0) ? ((acc + half) / (int32_t)ADT7320_MAP_WEIGHT_ONE)
+                                : ((acc - half) / (int32_t)ADT7320_MAP_WEIGHT_ONE));
+}
+
+/**
+ * @brief  Rescans all cells for the hottest one.
+ *
+ * @param[in,out] pMap  Pointer to the thermal map.
+ */
+static void ADT7320_Map_ScanHottest(ADT7320_MapTypeDef *pMap)
+{
+    uint16_t hot = 0U;
+
+    for (uint16_t c = 1U; c < ADT7320_MAP_CELLS; c++)
+    {
+        if (pMap->cell[c] > pMap->cell[hot])
+        {
+            hot = c;
+        }
+    }
+
+    pMap->hotCell  = hot;
+    pMap->hotDirty = 0U;
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Precomputes interpolation weights for the given sensor layout.
+ *
+ * All sensor readings start at raw code 0 (0 °C).
+ *
+ * @param[out] pMap      Pointer to the thermal map.
+ * @param[in]  pSensors  Array of sensor positions.
+ * @param[in]  count     Number of sensors (1 .. ADT7320_MAP_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Weights computed
+ * @retval ADT7320_ERROR  Invalid parameters or sensor outside the map
+ */
+ADT7320_StatusTypeDef ADT7320_Map_Init(ADT7320_MapTypeDef *pMap, const ADT7320_MapSensorTypeDef *pSensors, uint8_t count)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    ADT7320_MapNeighbourTypeDef nb;
+    uint16_t fill[ADT7320_MAP_MAX_SENSORS] = {0U};
+
+    if ( (pMap == NULL) || (pSensors == NULL) || (count == 0U) || (count > ADT7320_MAP_MAX_SENSORS) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint8_t s = 0U; s < count; s++)
+        {
+            if ( (pSensors[s].x >= ADT7320_MAP_WIDTH) || (pSensors[s].y >= ADT7320_MAP_HEIGHT) )
+            {
+                status = ADT7320_ERROR;
+            }
+        }
+    }
+
+    if (status == ADT7320_OK)
+    {
+        pMap->sensorCount = count;
+
+        for (uint8_t s = 0U; s <= ADT7320_MAP_MAX_SENSORS; s++)
+        {
+            pMap->offset[s] = 0U;
+        }
+
+        /* Pass 1: count the contributions of each sensor */
+        for (uint16_t c = 0U; c < ADT7320_MAP_CELLS; c++)
+        {
+            ADT7320_Map_Neighbours(pSensors, count, (uint16_t)(c % ADT7320_MAP_WIDTH), (uint16_t)(c / ADT7320_MAP_WIDTH), &nb);
+            for (uint8_t k = 0U; k < nb.count; k++)
+            {
+                pMap->offset[nb.sensor[k] + 1U]++;
+            }
+        }
+
+        for (uint8_t s = 0U; s < count; s++)
+        {
+            pMap->offset[s + 1U] += pMap->offset[s];
+            pMap->raw[s] = 0;
+        }
+
+        /* Pass 2: store the contributions grouped by sensor */
+        for (uint16_t c = 0U; c < ADT7320_MAP_CELLS; c++)
+        {
+            ADT7320_Map_Neighbours(pSensors, count, (uint16_t)(c % ADT7320_MAP_WIDTH), (uint16_t)(c / ADT7320_MAP_WIDTH), &nb);
+            for (uint8_t k = 0U; k < nb.count; k++)
+            {
+                uint16_t idx = (uint16_t)(pMap->offset[nb.sensor[k]] + fill[nb.sensor[k]]);
+
+                pMap->weight[idx].cell   = c;
+                pMap->weight[idx].weight = nb.weight[k];
+                fill[nb.sensor[k]]++;
+            }
+            pMap->cell[c] = 0;
+        }
+
+        pMap->hotCell  = 0U;
+        pMap->hotDirty = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Applies a new reading of one sensor, updating only the cells it affects.
+ *
+ * @param[in,out] pMap    Pointer to the thermal map.
+ * @param[in]     sensor  Sensor index as passed to ADT7320_Map_Init().
+ * @param[in]     raw     Raw 16-bit ADT7320_TEMP code.
+ *
+ * @retval ADT7320_OK     Map updated
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_Update(ADT7320_MapTypeDef *pMap, uint8_t sensor, int16_t raw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    int32_t delta = 0;
+
+    if ( (pMap == NULL) || (sensor >= pMap->sensorCount) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        delta = (int32_t)raw - (int32_t)pMap->raw[sensor];
+        pMap->raw[sensor] = raw;
+
+        if (delta != 0)
+        {
+            for (uint16_t i = pMap->offset[sensor]; i < pMap->offset[sensor + 1U]; i++)
+            {
+                uint16_t c = pMap->weight[i].cell;
+
+                pMap->cell[c] += delta * (int32_t)pMap->weight[i].weight;
+
+                if (pMap->cell[c] > pMap->cell[pMap->hotCell])
+                {
+                    pMap->hotCell = c;
+                }
+                else if ( (c == pMap->hotCell) && (delta < 0) )
+                {
+                    pMap->hotDirty = 1U;
+                }
+                else
+                {
+                    /* Cell stays below the current maximum */
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Recomputes every cell from the last reading of every sensor.
+ *
+ * Equivalent to applying all readings from scratch; useful as a reference for
+ * ADT7320_Map_Update() or after writing several readings directly.
+ *
+ * @param[in,out] pMap  Pointer to the thermal map.
+ *
+ * @retval ADT7320_OK     Map rebuilt
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_Rebuild(ADT7320_MapTypeDef *pMap)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pMap == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        for (uint16_t c = 0U; c < ADT7320_MAP_CELLS; c++)
+        {
+            pMap->cell[c] = 0;
+        }
+
+        for (uint8_t s = 0U; s < pMap->sensorCount; s++)
+        {
+            for (uint16_t i = pMap->offset[s]; i < pMap->offset[s + 1U]; i++)
+            {
+                pMap->cell[pMap->weight[i].cell] += (int32_t)pMap->raw[s] * (int32_t)pMap->weight[i].weight;
+            }
+        }
+
+        ADT7320_Map_ScanHottest(pMap);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Reads the interpolated value of one cell.
+ *
+ * @param[in]  pMap  Pointer to the thermal map.
+ * @param[in]  x     Column of the cell.
+ * @param[in]  y     Row of the cell.
+ * @param[out] pRaw  Interpolated raw code (1/128 °C per LSB).
+ *
+ * @retval ADT7320_OK     Value returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_GetCell(const ADT7320_MapTypeDef *pMap, uint16_t x, uint16_t y, int16_t *pRaw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pMap == NULL) || (pRaw == NULL) || (x >= ADT7320_MAP_WIDTH) || (y >= ADT7320_MAP_HEIGHT) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        *pRaw = ADT7320_Map_ToRaw(pMap->cell[(y * ADT7320_MAP_WIDTH) + x]);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Returns the hottest cell of the map.
+ *
+ * @param[in,out] pMap  Pointer to the thermal map.
+ * @param[out]    pX    Column of the hottest cell.
+ * @param[out]    pY    Row of the hottest cell.
+ * @param[out]    pRaw  Interpolated raw code of the hottest cell.
+ *
+ * @retval ADT7320_OK     Value returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_GetHottest(ADT7320_MapTypeDef *pMap, uint16_t *pX, uint16_t *pY, int16_t *pRaw)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pMap == NULL) || (pX == NULL) || (pY == NULL) || (pRaw == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        if (pMap->hotDirty != 0U)
+        {
+            ADT7320_Map_ScanHottest(pMap);
+        }
+
+        *pX   = (uint16_t)(pMap->hotCell % ADT7320_MAP_WIDTH);
+        *pY   = (uint16_t)(pMap->hotCell / ADT7320_MAP_WIDTH);
+        *pRaw = ADT7320_Map_ToRaw(pMap->cell[pMap->hotCell]);
+    }
+
+    return status;
+}
+
+
+/* adt7320_thermalmap.c */
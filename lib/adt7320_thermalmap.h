@@ -0,0 +1,163 @@
+/**
+ * @file    adt7320_thermalmap.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Interpolated 2D thermal map built from a grid of ADT7320 sensors.
+ *
+ * @details
+ * The map is a fixed WIDTH x HEIGHT grid of cells. Each cell is an inverse-distance
+ * weighted (IDW, power 2) blend of its nearest ADT7320_MAP_NEIGHBOURS sensors.
+ *
+ * Weights are computed once by ADT7320_Map_Init() and stored per sensor, so a new
+ * reading only touches the cells that sensor contributes to. All arithmetic is integer:
+ * weights are Q14 and sum to exactly 16384 per cell, and cells hold the weighted sum of
+ * raw 16-bit ADT7320_TEMP codes (1/128 °C per LSB), so incremental updates never drift.
+ *
+ * The hottest cell is tracked on every update. A full rescan only happens when the
+ * current hottest cell cools down, which keeps ADT7320_Map_GetHottest() O(1) amortised.
+ *
+ * @note
+ * Map dimensions and limits are selected in @ref adt7320_config.h.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_THERMALMAP_H
+#define ADT7320_THERMALMAP_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Total number of cells in the thermal map */
+#define  ADT7320_MAP_CELLS  (ADT7320_MAP_WIDTH * ADT7320_MAP_HEIGHT)
+
+/** @brief Sum of the Q14 weights of one cell */
+#define  ADT7320_MAP_WEIGHT_ONE  (16384U)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Position of one sensor on the map, in cell units.
+ */
+typedef struct
+{
+    uint16_t x;  /**< Column of the sensor (0 .. ADT7320_MAP_WIDTH - 1) */
+    uint16_t y;  /**< Row of the sensor (0 .. ADT7320_MAP_HEIGHT - 1) */
+} ADT7320_MapSensorTypeDef;
+
+/**
+ * @brief One contribution of a sensor to a cell.
+ */
+typedef struct
+{
+    uint16_t cell;    /**< Linear cell index (y * WIDTH + x) */
+    uint16_t weight;  /**< Q14 interpolation weight */
+} ADT7320_MapWeightTypeDef;
+
+/**
+ * @brief Thermal map state.
+ *
+ * Allocate statically; all storage is sized at compile time.
+ */
+typedef struct
+{
+    int32_t  cell[ADT7320_MAP_CELLS];                                   /**< Weighted raw sums (raw code * 16384) */
+    ADT7320_MapWeightTypeDef weight[ADT7320_MAP_CELLS * ADT7320_MAP_NEIGHBOURS];  /**< Contributions grouped by sensor */
+    uint16_t offset[ADT7320_MAP_MAX_SENSORS + 1U];                      /**< First weight entry of each sensor */
+    int16_t  raw[ADT7320_MAP_MAX_SENSORS];                              /**< Last raw code applied per sensor */
+    uint8_t  sensorCount;                                               /**< Number of sensors placed on the map */
+    uint16_t hotCell;                                                   /**< Index of the hottest cell */
+    uint8_t  hotDirty;                                                  /**< Non-zero if hotCell must be rescanned */
+} ADT7320_MapTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Precomputes interpolation weights for the given sensor layout.
+ *
+ * All sensor readings start at raw code 0 (0 °C).
+ *
+ * @param[out] pMap      Pointer to the thermal map.
+ * @param[in]  pSensors  Array of sensor positions.
+ * @param[in]  count     Number of sensors (1 .. ADT7320_MAP_MAX_SENSORS).
+ *
+ * @retval ADT7320_OK     Weights computed
+ * @retval ADT7320_ERROR  Invalid parameters or sensor outside the map
+ */
+ADT7320_StatusTypeDef ADT7320_Map_Init(ADT7320_MapTypeDef *pMap, const ADT7320_MapSensorTypeDef *pSensors, uint8_t count);
+
+/**
+ * @brief  Applies a new reading of one sensor, updating only the cells it affects.
+ *
+ * @param[in,out] pMap    Pointer to the thermal map.
+ * @param[in]     sensor  Sensor index as passed to ADT7320_Map_Init().
+ * @param[in]     raw     Raw 16-bit ADT7320_TEMP code.
+ *
+ * @retval ADT7320_OK     Map updated
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_Update(ADT7320_MapTypeDef *pMap, uint8_t sensor, int16_t raw);
+
+/**
+ * @brief  Recomputes every cell from the last reading of every sensor.
+ *
+ * Equivalent to applying all readings from scratch; useful as a reference for
+ * ADT7320_Map_Update() or after writing several readings directly.
+ *
+ * @param[in,out] pMap  Pointer to the thermal map.
+ *
+ * @retval ADT7320_OK     Map rebuilt
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_Rebuild(ADT7320_MapTypeDef *pMap);
+
+/**
+ * @brief  Reads the interpolated value of one cell.
+ *
+ * @param[in]  pMap  Pointer to the thermal map.
+ * @param[in]  x     Column of the cell.
+ * @param[in]  y     Row of the cell.
+ * @param[out] pRaw  Interpolated raw code (1/128 °C per LSB).
+ *
+ * @retval ADT7320_OK     Value returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_GetCell(const ADT7320_MapTypeDef *pMap, uint16_t x, uint16_t y, int16_t *pRaw);
+
+/**
+ * @brief  Returns the hottest cell of the map.
+ *
+ * @param[in,out] pMap  Pointer to the thermal map.
+ * @param[out]    pX    Column of the hottest cell.
+ * @param[out]    pY    Row of the hottest cell.
+ * @param[out]    pRaw  Interpolated raw code of the hottest cell.
+ *
+ * @retval ADT7320_OK     Value returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Map_GetHottest(ADT7320_MapTypeDef *pMap, uint16_t *pX, uint16_t *pY, int16_t *pRaw);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_THERMALMAP_H */
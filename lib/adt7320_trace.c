@@ -0,0 +1,166 @@
+/**
+ * @file    adt7320_trace.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   SPI bus-traffic trace and regression guard for the ADT7320 driver.
+ *
+ * @details
+ * Counters keep running when the stream buffer is full, so the budget check stays
+ * meaningful for long scenarios; only the golden comparison then fails.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>          /**< memcmp() */
+#include "adt7320_trace.h"  /**< Trace interface */
+
+
+/* ------------------------------- Private Variables -------------------------------- */
+
+/** @brief Trace being recorded (NULL when stopped) */
+static ADT7320_TraceTypeDef *ADT7320_Trace_Active = NULL;
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Clears a trace and makes it the active one.
+ *
+ * @param[out] pTrace  Pointer to the trace.
+ *
+ * @retval ADT7320_OK     Recording started
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trace_Start(ADT7320_TraceTypeDef *pTrace)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pTrace == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pTrace->transactions = 0U;
+        pTrace->bytes        = 0U;
+        pTrace->length       = 0U;
+        pTrace->overflow     = 0U;
+
+        ADT7320_Trace_Active = pTrace;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Stops recording.
+ */
+void ADT7320_Trace_Stop(void)
+{
+    ADT7320_Trace_Active = NULL;
+}
+
+/**
+ * @brief  Records one transaction into the active trace (called through ADT7320_TRACE_SPI()).
+ *
+ * @param[in] pTx  Bytes transmitted under one CS cycle.
+ * @param[in] len  Number of bytes.
+ */
+void ADT7320_Trace_Record(const uint8_t *pTx, uint16_t len)
+{
+    ADT7320_TraceTypeDef *pTrace = ADT7320_Trace_Active;
+
+    if (pTrace != NULL)
+    {
+        pTrace->transactions++;
+        pTrace->bytes += len;
+
+        if ( (len > 0xFFU) || (((uint32_t)pTrace->length + 1U + len) > ADT7320_TRACE_SIZE) )
+        {
+            pTrace->overflow = 1U;
+        }
+        else if (pTrace->overflow == 0U)
+        {
+            pTrace->stream[pTrace->length] = (uint8_t)len;
+            (void)memcpy(&pTrace->stream[pTrace->length + 1U], pTx, len);
+            pTrace->length = (uint16_t)(pTrace->length + 1U + len);
+        }
+        else
+        {
+            /* Stream already truncated */
+        }
+    }
+}
+
+/**
+ * @brief  Checks a recorded scenario against its budget and golden stream.
+ *
+ * @param[in] pTrace   Pointer to the trace.
+ * @param[in] pBudget  Expected traffic.
+ *
+ * @retval ADT7320_OK     Traffic within budget and identical to the golden stream
+ * @retval ADT7320_ERROR  Invalid parameters, budget exceeded, stream overflow or mismatch
+ */
+ADT7320_StatusTypeDef ADT7320_Trace_Check(const ADT7320_TraceTypeDef *pTrace, const ADT7320_TraceBudgetTypeDef *pBudget)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pTrace == NULL) || (pBudget == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if ( (pTrace->transactions > pBudget->maxTransactions) || (pTrace->bytes > pBudget->maxBytes) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else if (pBudget->pGolden != NULL)
+    {
+        if ( (pTrace->overflow != 0U) || (pTrace->length != pBudget->goldenLength) ||
+             (memcmp(pTrace->stream, pBudget->pGolden, pTrace->length) != 0) )
+        {
+            status = ADT7320_ERROR;
+        }
+    }
+    else
+    {
+        /* Budget only */
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Computes the bus cost per sample of a scenario.
+ *
+ * @param[in]  pTrace           Pointer to the trace.
+ * @param[in]  samples          Samples produced by the scenario.
+ * @param[out] pBytesPerSample  Bytes per sample, Q8.
+ *
+ * @retval ADT7320_OK     Cost returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trace_BytesPerSample(const ADT7320_TraceTypeDef *pTrace, uint32_t samples, uint32_t *pBytesPerSample)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pTrace == NULL) || (pBytesPerSample == NULL) || (samples == 0U) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        *pBytesPerSample = (uint32_t)(((uint64_t)pTrace->bytes << 8U) / samples);
+    }
+
+    return status;
+}
+
+
+/* adt7320_trace.c */
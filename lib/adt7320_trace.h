@@ -0,0 +1,133 @@
+/**
+ * @file    adt7320_trace.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   SPI bus-traffic trace and regression guard for the ADT7320 driver.
+ *
+ * @details
+ * Performance regressions in this driver show up as extra bytes or extra chip-select
+ * cycles on the bus. With ADT7320_TRACE_ENABLE set, every transaction issued by the
+ * core driver (one CS cycle) is recorded into the active trace:
+ *
+ * - transaction and byte counters;
+ * - the exact transmitted byte stream, as [length][bytes...] per transaction.
+ *
+ * A scenario (init, configure, N temperature reads, alarm handling...) is run between
+ * ADT7320_Trace_Start() and ADT7320_Trace_Stop(). ADT7320_Trace_Check() then fails when
+ * the scenario used more transactions or bytes than its budget, or when its stream
+ * differs from a stored golden trace. The same check runs on target or against a fake
+ * HAL on a host.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_TRACE_H
+#define ADT7320_TRACE_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#if (ADT7320_TRACE_ENABLE == 1U)
+    /** @brief Records one transaction (called by the core driver before each transfer) */
+    #define  ADT7320_TRACE_SPI(pTx, len)  ADT7320_Trace_Record((pTx), (len))
+#else
+    #define  ADT7320_TRACE_SPI(pTx, len)  ((void)0)
+#endif  /* ADT7320_TRACE_ENABLE */
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Recorded traffic of one scenario.
+ */
+typedef struct
+{
+    uint32_t transactions;                /**< CS cycles */
+    uint32_t bytes;                       /**< Bytes clocked on the bus */
+    uint16_t length;                      /**< Bytes of stream in use */
+    uint8_t  overflow;                    /**< Non-zero if the stream did not fit */
+    uint8_t  stream[ADT7320_TRACE_SIZE];  /**< [length][bytes...] per transaction */
+} ADT7320_TraceTypeDef;
+
+/**
+ * @brief Expected traffic of one scenario.
+ */
+typedef struct
+{
+    uint32_t       maxTransactions;  /**< Allowed CS cycles */
+    uint32_t       maxBytes;         /**< Allowed bytes */
+    const uint8_t *pGolden;          /**< Golden stream (may be NULL to check the budget only) */
+    uint16_t       goldenLength;     /**< Golden stream length, in bytes */
+} ADT7320_TraceBudgetTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Clears a trace and makes it the active one.
+ *
+ * @param[out] pTrace  Pointer to the trace.
+ *
+ * @retval ADT7320_OK     Recording started
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trace_Start(ADT7320_TraceTypeDef *pTrace);
+
+/**
+ * @brief  Stops recording.
+ */
+void ADT7320_Trace_Stop(void);
+
+/**
+ * @brief  Records one transaction into the active trace (called through ADT7320_TRACE_SPI()).
+ *
+ * @param[in] pTx  Bytes transmitted under one CS cycle.
+ * @param[in] len  Number of bytes.
+ */
+void ADT7320_Trace_Record(const uint8_t *pTx, uint16_t len);
+
+/**
+ * @brief  Checks a recorded scenario against its budget and golden stream.
+ *
+ * @param[in] pTrace   Pointer to the trace.
+ * @param[in] pBudget  Expected traffic.
+ *
+ * @retval ADT7320_OK     Traffic within budget and identical to the golden stream
+ * @retval ADT7320_ERROR  Invalid parameters, budget exceeded, stream overflow or mismatch
+ */
+ADT7320_StatusTypeDef ADT7320_Trace_Check(const ADT7320_TraceTypeDef *pTrace, const ADT7320_TraceBudgetTypeDef *pBudget);
+
+/**
+ * @brief  Computes the bus cost per sample of a scenario.
+ *
+ * @param[in]  pTrace           Pointer to the trace.
+ * @param[in]  samples          Samples produced by the scenario.
+ * @param[out] pBytesPerSample  Bytes per sample, Q8.
+ *
+ * @retval ADT7320_OK     Cost returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trace_BytesPerSample(const ADT7320_TraceTypeDef *pTrace, uint32_t samples, uint32_t *pBytesPerSample);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_TRACE_H */
@@ -0,0 +1,304 @@
+/**
+ * @file    adt7320_trend.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Time-to-threshold prediction against the ADT7320 TCRIT/THIGH limits.
+ *
+ * @details
+ * With u the sample time in 16 ms units since the oldest sample, y the raw code in Q4
+ * and N the window length:
+ * - Sxx = N * sum(u²) - sum(u)²
+ * - Sxy = N * sum(u * y) - sum(u) * sum(y)
+ * - fitted value at the newest sample: yfit = mean(y) + (Sxy / N) * (N * u_last - sum(u)) / Sxx
+ * - time to limit L, in units: (L - yfit) * Sxx / Sxy
+ *
+ * With N <= 32 and u <= 65535 every intermediate product fits in a signed 64-bit integer.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "adt7320_trend.h"  /**< Trend predictor interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Time unit of the fit, in ms */
+#define  ADT7320_TREND_UNIT_MS  (16U)
+
+/** @brief Largest window span, in fit units */
+#define  ADT7320_TREND_MAX_SPAN  (65535UL)
+
+/** @brief Power-on value of the TCRIT register (147 °C) */
+#define  ADT7320_TREND_TCRIT_DEFAULT  (0x4980)
+
+/** @brief Power-on value of the THIGH register (64 °C) */
+#define  ADT7320_TREND_THIGH_DEFAULT  (0x2000)
+
+#if ( (ADT7320_TREND_WINDOW < 2U) || (ADT7320_TREND_WINDOW > 32U) )
+    #error "ADT7320_TREND_WINDOW must be between 2 and 32"
+#endif
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Fits the window and updates the predicted time to every limit.
+ *
+ * @param[in,out] pTrend  Pointer to the predictor state.
+ */
+static void ADT7320_Trend_Fit(ADT7320_TrendTypeDef *pTrend)
+{
+    int64_t  n     = (int64_t)pTrend->used;
+    uint8_t  first = (uint8_t)((pTrend->head + ADT7320_TREND_WINDOW - pTrend->used) % ADT7320_TREND_WINDOW);
+    uint8_t  idx   = 0U;
+    uint32_t t0    = pTrend->tick[first];
+    int64_t  u     = 0;
+    int64_t  y     = 0;
+    int64_t  su    = 0;
+    int64_t  sy    = 0;
+    int64_t  suu   = 0;
+    int64_t  suy   = 0;
+    int64_t  sxx   = 0;
+    int64_t  sxy   = 0;
+    int64_t  yfit  = 0;
+    int64_t  gap   = 0;
+    int64_t  ttl   = 0;
+
+    for (uint8_t i = 0U; i < pTrend->used; i++)
+    {
+        idx  = (uint8_t)((first + i) % ADT7320_TREND_WINDOW);
+        u    = (int64_t)((pTrend->tick[idx] - t0) / ADT7320_TREND_UNIT_MS);
+        y    = (int64_t)pTrend->raw[idx] * 16;
+        su  += u;
+        sy  += y;
+        suu += u * u;
+        suy += u * y;
+    }
+
+    sxx = (n * suu) - (su * su);
+    sxy = (n * suy) - (su * sy);
+
+    for (uint8_t l = 0U; l < (uint8_t)ADT7320_TREND_LIMITS; l++)
+    {
+        pTrend->ttl[l] = ADT7320_TREND_NEVER;
+    }
+
+    if (sxx > 0)
+    {
+        /* u still holds the newest sample */
+        yfit = (sy / n) + (((sxy / n) * ((n * u) - su)) / sxx);
+
+        for (uint8_t l = 0U; l < (uint8_t)ADT7320_TREND_LIMITS; l++)
+        {
+            gap = ((int64_t)pTrend->limit[l] * 16) - yfit;
+
+            if (gap <= 0)
+            {
+                pTrend->ttl[l] = 0U;
+            }
+            else if (sxy > 0)
+            {
+                ttl = ((gap * sxx) / sxy) * (int64_t)ADT7320_TREND_UNIT_MS;
+                pTrend->ttl[l] = (ttl >= (int64_t)ADT7320_TREND_NEVER) ? (ADT7320_TREND_NEVER - 1U) : (uint32_t)ttl;
+            }
+            else
+            {
+                /* Flat or cooling: the limit is not approached */
+            }
+        }
+    }
+}
+
+
+/* ------------------------------------ Functions ----------------------------------- */
+
+/**
+ * @brief  Initializes a predictor.
+ *
+ * Limits default to the power-on values (TCRIT 147 °C, THIGH 64 °C) until
+ * ADT7320_Trend_LoadLimits() or ADT7320_Trend_SetLimits() is called.
+ *
+ * @param[out] pTrend     Pointer to the predictor state.
+ * @param[in]  horizonMs  Warning horizon, in ms.
+ * @param[in]  callback   Early-warning callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Predictor ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_Init(ADT7320_TrendTypeDef *pTrend, uint32_t horizonMs, ADT7320_TrendCallbackTypeDef callback)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pTrend == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pTrend->head      = 0U;
+        pTrend->used      = 0U;
+        pTrend->horizonMs = horizonMs;
+        pTrend->callback  = callback;
+        pTrend->limit[ADT7320_TREND_TCRIT] = (int16_t)ADT7320_TREND_TCRIT_DEFAULT;
+        pTrend->limit[ADT7320_TREND_THIGH] = (int16_t)ADT7320_TREND_THIGH_DEFAULT;
+
+        for (uint8_t l = 0U; l < (uint8_t)ADT7320_TREND_LIMITS; l++)
+        {
+            pTrend->ttl[l]    = ADT7320_TREND_NEVER;
+            pTrend->warned[l] = 0U;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Reads the TCRIT and THIGH registers once and caches them.
+ *
+ * @param[in,out] pTrend   Pointer to the predictor state.
+ * @param[in]     pConfig  Sensor to read the limits from.
+ *
+ * @retval ADT7320_OK     Limits cached
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_LoadLimits(ADT7320_TrendTypeDef *pTrend, const ADT7320_ConfigTypeDef *pConfig)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+    uint16_t tcrit = 0U;
+    uint16_t thigh = 0U;
+
+    if ( (pTrend == NULL) || (pConfig == NULL) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        status = ADT7320_ReadRegister(pConfig, ADT7320_TCRIT, 2U, &tcrit);
+
+        if (status == ADT7320_OK)
+        {
+            status = ADT7320_ReadRegister(pConfig, ADT7320_THIGH, 2U, &thigh);
+        }
+
+        if (status == ADT7320_OK)
+        {
+            status = ADT7320_Trend_SetLimits(pTrend, (int16_t)tcrit, (int16_t)thigh);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Sets the cached limits directly (e.g. right after writing them to the sensor).
+ *
+ * @param[in,out] pTrend  Pointer to the predictor state.
+ * @param[in]     tcrit   TCRIT value (raw code).
+ * @param[in]     thigh   THIGH value (raw code).
+ *
+ * @retval ADT7320_OK     Limits cached
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_SetLimits(ADT7320_TrendTypeDef *pTrend, int16_t tcrit, int16_t thigh)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if (pTrend == NULL)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        pTrend->limit[ADT7320_TREND_TCRIT]  = tcrit;
+        pTrend->limit[ADT7320_TREND_THIGH]  = thigh;
+        pTrend->warned[ADT7320_TREND_TCRIT] = 0U;
+        pTrend->warned[ADT7320_TREND_THIGH] = 0U;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Adds one sample, refits the trend and raises warnings if needed.
+ *
+ * @param[in,out] pTrend  Pointer to the predictor state.
+ * @param[in]     tick    Sample time, in ms (non-decreasing).
+ * @param[in]     raw     Raw ADT7320_TEMP code.
+ */
+void ADT7320_Trend_Add(ADT7320_TrendTypeDef *pTrend, uint32_t tick, int16_t raw)
+{
+    uint8_t first = 0U;
+
+    pTrend->tick[pTrend->head] = tick;
+    pTrend->raw[pTrend->head]  = raw;
+    pTrend->head = (uint8_t)((pTrend->head + 1U) % ADT7320_TREND_WINDOW);
+    if (pTrend->used < ADT7320_TREND_WINDOW)
+    {
+        pTrend->used++;
+    }
+
+    /* Keep the window span within the range of the fit */
+    first = (uint8_t)((pTrend->head + ADT7320_TREND_WINDOW - pTrend->used) % ADT7320_TREND_WINDOW);
+    while ( (pTrend->used > 1U) && (((tick - pTrend->tick[first]) / ADT7320_TREND_UNIT_MS) > ADT7320_TREND_MAX_SPAN) )
+    {
+        pTrend->used--;
+        first = (uint8_t)((first + 1U) % ADT7320_TREND_WINDOW);
+    }
+
+    if (pTrend->used >= 2U)
+    {
+        ADT7320_Trend_Fit(pTrend);
+
+        for (uint8_t l = 0U; l < (uint8_t)ADT7320_TREND_LIMITS; l++)
+        {
+            if (pTrend->ttl[l] <= pTrend->horizonMs)
+            {
+                if ( (pTrend->warned[l] == 0U) && (pTrend->callback != NULL) )
+                {
+                    pTrend->callback((ADT7320_TrendLimitTypeDef)l, pTrend->ttl[l]);
+                }
+                pTrend->warned[l] = 1U;
+            }
+            else
+            {
+                pTrend->warned[l] = 0U;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Returns the last predicted time to a limit.
+ *
+ * @param[in]  pTrend  Pointer to the predictor state.
+ * @param[in]  limit   Limit of interest.
+ * @param[out] pTtlMs  Time to the limit in ms, 0 if crossed, ADT7320_TREND_NEVER if not approaching.
+ *
+ * @retval ADT7320_OK     Prediction returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_GetTimeTo(const ADT7320_TrendTypeDef *pTrend, ADT7320_TrendLimitTypeDef limit, uint32_t *pTtlMs)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ( (pTrend == NULL) || (pTtlMs == NULL) || (limit >= ADT7320_TREND_LIMITS) )
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        *pTtlMs = pTrend->ttl[limit];
+    }
+
+    return status;
+}
+
+
+/* adt7320_trend.c */
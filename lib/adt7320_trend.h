@@ -0,0 +1,153 @@
+/**
+ * @file    adt7320_trend.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Time-to-threshold prediction against the ADT7320 TCRIT/THIGH limits.
+ *
+ * @details
+ * The CT pin fires only once TCRIT is reached. This module fits a least-squares line
+ * over the last ADT7320_TREND_WINDOW raw samples and estimates how long it will take to
+ * reach each programmed limit, so the application can start a graceful shutdown early.
+ *
+ * Limits are read once from the ADT7320_TCRIT and ADT7320_THIGH registers by
+ * ADT7320_Trend_LoadLimits() (or set with ADT7320_Trend_SetLimits()) and cached; no SPI
+ * access happens per sample. When the predicted time to a limit drops below the
+ * configured horizon, the early-warning callback is raised once, and re-armed when the
+ * prediction leaves the horizon again.
+ *
+ * All arithmetic is 64-bit integer; the fit runs in 16 ms time units with temperatures
+ * in raw code Q4.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef ADT7320_TREND_H
+#define ADT7320_TREND_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "adt7320.h"  /**< ADT7320 driver interface and configuration */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Returned time-to-limit when the limit is not being approached */
+#define  ADT7320_TREND_NEVER  (0xFFFFFFFFUL)
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Limits watched by the predictor.
+ */
+typedef enum
+{
+    ADT7320_TREND_TCRIT = 0U,  /**< Critical limit (ADT7320_TCRIT) */
+    ADT7320_TREND_THIGH = 1U,  /**< High limit (ADT7320_THIGH) */
+    ADT7320_TREND_LIMITS = 2U  /**< Number of watched limits */
+} ADT7320_TrendLimitTypeDef;
+
+/**
+ * @brief Early-warning callback.
+ *
+ * @param limit  Limit about to be crossed.
+ * @param ttlMs  Predicted time until the crossing, in ms (0 if already crossed).
+ */
+typedef void (*ADT7320_TrendCallbackTypeDef)(ADT7320_TrendLimitTypeDef limit, uint32_t ttlMs);
+
+/**
+ * @brief Predictor state of one sensor.
+ */
+typedef struct
+{
+    uint32_t tick[ADT7320_TREND_WINDOW];    /**< Sample ticks, in ms */
+    int16_t  raw[ADT7320_TREND_WINDOW];     /**< Raw sample codes */
+    uint8_t  head;                          /**< Slot of the next sample */
+    uint8_t  used;                          /**< Valid samples in the window */
+    int16_t  limit[ADT7320_TREND_LIMITS];   /**< Cached limit registers (raw code) */
+    uint32_t ttl[ADT7320_TREND_LIMITS];     /**< Last predicted time to each limit, in ms */
+    uint8_t  warned[ADT7320_TREND_LIMITS];  /**< Non-zero once the warning was raised */
+    uint32_t horizonMs;                     /**< Warning horizon, in ms */
+    ADT7320_TrendCallbackTypeDef callback;  /**< Early-warning callback (may be NULL) */
+} ADT7320_TrendTypeDef;
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/**
+ * @brief  Initializes a predictor.
+ *
+ * Limits default to the power-on values (TCRIT 147 °C, THIGH 64 °C) until
+ * ADT7320_Trend_LoadLimits() or ADT7320_Trend_SetLimits() is called.
+ *
+ * @param[out] pTrend     Pointer to the predictor state.
+ * @param[in]  horizonMs  Warning horizon, in ms.
+ * @param[in]  callback   Early-warning callback (may be NULL).
+ *
+ * @retval ADT7320_OK     Predictor ready
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_Init(ADT7320_TrendTypeDef *pTrend, uint32_t horizonMs, ADT7320_TrendCallbackTypeDef callback);
+
+/**
+ * @brief  Reads the TCRIT and THIGH registers once and caches them.
+ *
+ * @param[in,out] pTrend   Pointer to the predictor state.
+ * @param[in]     pConfig  Sensor to read the limits from.
+ *
+ * @retval ADT7320_OK     Limits cached
+ * @retval ADT7320_ERROR  Invalid parameters or SPI communication failure
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_LoadLimits(ADT7320_TrendTypeDef *pTrend, const ADT7320_ConfigTypeDef *pConfig);
+
+/**
+ * @brief  Sets the cached limits directly (e.g. right after writing them to the sensor).
+ *
+ * @param[in,out] pTrend  Pointer to the predictor state.
+ * @param[in]     tcrit   TCRIT value (raw code).
+ * @param[in]     thigh   THIGH value (raw code).
+ *
+ * @retval ADT7320_OK     Limits cached
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_SetLimits(ADT7320_TrendTypeDef *pTrend, int16_t tcrit, int16_t thigh);
+
+/**
+ * @brief  Adds one sample, refits the trend and raises warnings if needed.
+ *
+ * @param[in,out] pTrend  Pointer to the predictor state.
+ * @param[in]     tick    Sample time, in ms (non-decreasing).
+ * @param[in]     raw     Raw ADT7320_TEMP code.
+ */
+void ADT7320_Trend_Add(ADT7320_TrendTypeDef *pTrend, uint32_t tick, int16_t raw);
+
+/**
+ * @brief  Returns the last predicted time to a limit.
+ *
+ * @param[in]  pTrend  Pointer to the predictor state.
+ * @param[in]  limit   Limit of interest.
+ * @param[out] pTtlMs  Time to the limit in ms, 0 if crossed, ADT7320_TREND_NEVER if not approaching.
+ *
+ * @retval ADT7320_OK     Prediction returned
+ * @retval ADT7320_ERROR  Invalid parameters
+ */
+ADT7320_StatusTypeDef ADT7320_Trend_GetTimeTo(const ADT7320_TrendTypeDef *pTrend, ADT7320_TrendLimitTypeDef limit, uint32_t *pTtlMs);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* ADT7320_TREND_H */
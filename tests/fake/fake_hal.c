@@ -0,0 +1,1111 @@
+/**
+ * @file    fake_hal.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Host fake of the STM32 HAL subset used by the ADT7320 driver, with simulated sensors.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>    /**< memset(), memcpy() */
+#include "fake_hal.h"  /**< Fake HAL interface */
+
+
+/* --------------------------------- Private Defines -------------------------------- */
+
+/** @brief Cycles per millisecond and per microsecond */
+#define  FAKE_CYCLES_PER_MS  ((uint64_t)SystemCoreClock / 1000U)
+#define  FAKE_CYCLES_PER_US  ((uint64_t)SystemCoreClock / 1000000U)
+
+/** @brief Cycles consumed by one HAL_GetTick() call, so polling loops make progress */
+#define  FAKE_TICK_READ_CYCLES  (20U)
+
+/** @brief ADT7320 registers */
+#define  FAKE_REG_STATUS  (0U)
+#define  FAKE_REG_CONFIG  (1U)
+#define  FAKE_REG_TEMP    (2U)
+#define  FAKE_REG_ID      (3U)
+#define  FAKE_REG_TCRIT   (4U)
+#define  FAKE_REG_THYST   (5U)
+#define  FAKE_REG_THIGH   (6U)
+#define  FAKE_REG_TLOW    (7U)
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief Tracked GPIO port */
+typedef struct
+{
+    GPIO_TypeDef *port;  /**< Port */
+    uint32_t odr;        /**< Output level seen by the sensors */
+} Fake_PortTypeDef;
+
+/** @brief IT/DMA transfer waiting for Fake_SPI_Finish() */
+typedef struct
+{
+    SPI_HandleTypeDef *hspi;
+    uint8_t  *pTx;
+    uint8_t  *pRx;
+    uint16_t size;
+    uint64_t due;        /**< Cycle at which the peripheral has clocked the last byte */
+} Fake_PendingTypeDef;
+
+
+/* ------------------------------------ Variables ----------------------------------- */
+
+uint32_t SystemCoreClock = FAKE_CORE_HZ;
+volatile uint32_t Fake_Primask = 0U;
+CoreDebug_Type Fake_CoreDebug;
+volatile uint64_t Fake_Cycles = 0U;
+Fake_SensorTypeDef Fake_Sensor[FAKE_MAX_SENSORS];
+uint32_t Fake_SensorCount = 0U;
+uint32_t Fake_CsFalling   = 0U;
+uint32_t Fake_CsRising    = 0U;
+uint32_t Fake_Contention  = 0U;
+uint32_t Fake_Unselected  = 0U;
+uint32_t Fake_SpiCalls    = 0U;
+uint32_t Fake_SpiBytes    = 0U;
+uint32_t Fake_SpiAborts   = 0U;
+uint32_t Fake_GpioWrites  = 0U;
+uint32_t Fake_DCacheCleans      = 0U;
+uint32_t Fake_DCacheInvalidates = 0U;
+uint64_t Fake_IdleCycles = 0U;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static DWT_Type Fake_DwtRegs;
+static uint32_t Fake_DwtShadow = 0U;
+static uint32_t Fake_DwtOffset = 0U;
+static Fake_PortTypeDef Fake_Port[FAKE_MAX_PORTS];
+static uint32_t Fake_PortCount = 0U;
+static Fake_PendingTypeDef Fake_Pending[FAKE_MAX_SPI];
+static Fake_TransactionTypeDef Fake_Observer = NULL;
+static uint8_t  Fake_Stream[FAKE_STREAM_SIZE];
+static uint16_t Fake_StreamLength = 0U;
+static uint8_t  Fake_StreamOpen   = 0U;
+static HAL_StatusTypeDef Fake_FailStatus = HAL_OK;
+static uint32_t Fake_FailCalls = 0U;
+static uint32_t Fake_HsemActive = 0U;
+static uint32_t Fake_HsemCount  = 0U;
+static __thread volatile uint32_t *Fake_ExclusiveAddr = NULL;
+static __thread uint32_t Fake_ExclusiveValue = 0U;
+static Fake_IsrTypeDef Fake_ExclusiveIsr = NULL;
+static Fake_IsrTypeDef Fake_TransferIsr  = NULL;
+static Fake_IsrTypeDef Fake_TickIsr      = NULL;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Size of a register, in bytes.
+ */
+static uint8_t Fake_RegSize(uint8_t reg)
+{
+    return ( (reg == FAKE_REG_TEMP) || (reg == FAKE_REG_TCRIT) || (reg == FAKE_REG_THIGH) || (reg == FAKE_REG_TLOW) ) ? 2U : 1U;
+}
+
+/**
+ * @brief  Reads a register as a 16-bit value (8-bit registers in the low byte).
+ */
+static int32_t Fake_Reg16(const Fake_SensorTypeDef *pS, uint8_t reg)
+{
+    return (int16_t)(((uint16_t)pS->reg[reg][0U] << 8U) | pS->reg[reg][1U]);
+}
+
+/**
+ * @brief  Power-on / serial reset register values.
+ */
+static void Fake_SensorReset(Fake_SensorTypeDef *pS)
+{
+    memset(pS->reg, 0, sizeof(pS->reg));
+    pS->reg[FAKE_REG_STATUS][0U] = 0x80U;
+    pS->reg[FAKE_REG_ID][0U]     = 0xC3U;
+    pS->reg[FAKE_REG_TCRIT][0U]  = 0x49U;
+    pS->reg[FAKE_REG_TCRIT][1U]  = 0x80U;
+    pS->reg[FAKE_REG_THYST][0U]  = 0x05U;
+    pS->reg[FAKE_REG_THIGH][0U]  = 0x20U;
+    pS->reg[FAKE_REG_TLOW][0U]   = 0x05U;
+    pS->phase         = 0U;
+    pS->ones          = 0U;
+    pS->converting    = 0U;
+    pS->lastConvStart = Fake_Cycles;
+    pS->convEnd       = Fake_Cycles + ((uint64_t)pS->conversionUs * FAKE_CYCLES_PER_US);
+}
+
+/**
+ * @brief  Ends a conversion: latches the temperature, clears RDY, updates the alarm flags.
+ */
+static void Fake_SensorConvert(Fake_SensorTypeDef *pS)
+{
+    uint8_t status = 0U;
+
+    pS->reg[FAKE_REG_TEMP][0U] = (uint8_t)((uint16_t)pS->raw >> 8U);
+    pS->reg[FAKE_REG_TEMP][1U] = (uint8_t)pS->raw;
+    pS->conversions++;
+
+    if (pS->raw >= Fake_Reg16(pS, FAKE_REG_TCRIT)) { status |= 0x40U; }
+    if (pS->raw >  Fake_Reg16(pS, FAKE_REG_THIGH)) { status |= 0x20U; }
+    if (pS->raw <  Fake_Reg16(pS, FAKE_REG_TLOW))  { status |= 0x10U; }
+
+    pS->reg[FAKE_REG_STATUS][0U] = status;
+}
+
+/**
+ * @brief  Brings the conversion state of a sensor up to the current time.
+ */
+static void Fake_SensorUpdate(Fake_SensorTypeDef *pS)
+{
+    uint8_t  mode   = (uint8_t)((pS->reg[FAKE_REG_CONFIG][0U] >> 5U) & 3U);
+    uint64_t period = (uint64_t)pS->conversionUs * FAKE_CYCLES_PER_US;
+
+    if ( (mode == 0U) || (mode == 2U) )
+    {
+        if (mode == 2U)
+        {
+            period = 1000U * FAKE_CYCLES_PER_MS;
+        }
+
+        while (Fake_Cycles >= pS->convEnd)
+        {
+            pS->lastConvStart = pS->convEnd - ((uint64_t)pS->conversionUs * FAKE_CYCLES_PER_US);
+            Fake_SensorConvert(pS);
+            pS->convEnd += period;
+        }
+    }
+    else if ( (mode == 1U) && (pS->converting != 0U) && (Fake_Cycles >= pS->convEnd) )
+    {
+        pS->converting = 0U;
+        Fake_SensorConvert(pS);
+    }
+    else
+    {
+        /* Shutdown, or one-shot still converting */
+    }
+}
+
+/**
+ * @brief  Applies a configuration write.
+ */
+static void Fake_SensorConfigure(Fake_SensorTypeDef *pS, uint8_t config)
+{
+    uint8_t mode = (uint8_t)((config >> 5U) & 3U);
+
+    pS->reg[FAKE_REG_CONFIG][0U] = config;
+
+    if (mode == 1U)
+    {
+        pS->converting    = 1U;
+        pS->lastConvStart = Fake_Cycles;
+        pS->convEnd       = Fake_Cycles + ((uint64_t)pS->conversionUs * FAKE_CYCLES_PER_US);
+        pS->reg[FAKE_REG_STATUS][0U] |= 0x80U;
+    }
+    else if (mode != 3U)
+    {
+        pS->lastConvStart = Fake_Cycles;
+        pS->convEnd       = Fake_Cycles + ((uint64_t)pS->conversionUs * FAKE_CYCLES_PER_US);
+    }
+    else
+    {
+        pS->converting = 0U;
+    }
+}
+
+/**
+ * @brief  Clocks one byte through a selected sensor.
+ *
+ * @return Byte driven on DOUT.
+ */
+static uint8_t Fake_SensorByte(Fake_SensorTypeDef *pS, uint8_t tx)
+{
+    uint8_t rx = 0xFFU;
+
+    if ( (pS->hspi->Init.CLKPolarity != SPI_POLARITY_HIGH) || (pS->hspi->Init.CLKPhase != SPI_PHASE_2EDGE) )
+    {
+        pS->modeErrors++;
+        pS->phase = 0U;
+    }
+    else if (pS->phase == 0U)
+    {
+        if (tx == 0xFFU)
+        {
+            pS->ones++;
+
+            if (pS->ones >= 4U)
+            {
+                Fake_SensorReset(pS);
+            }
+        }
+        else
+        {
+            pS->ones    = 0U;
+            pS->current = (uint8_t)((tx >> 3U) & 7U);
+            pS->read    = (uint8_t)((tx & 0x40U) != 0U);
+            pS->index   = 0U;
+            pS->phase   = Fake_RegSize(pS->current);
+            pS->commands++;
+            Fake_SensorUpdate(pS);
+        }
+    }
+    else
+    {
+        if (pS->read != 0U)
+        {
+            rx = pS->reg[pS->current][pS->index];
+        }
+        else if ( (pS->current != FAKE_REG_STATUS) && (pS->current != FAKE_REG_TEMP) && (pS->current != FAKE_REG_ID) )
+        {
+            pS->reg[pS->current][pS->index] = tx;
+        }
+        else
+        {
+            /* Read-only register */
+        }
+
+        pS->index++;
+        pS->phase--;
+
+        if (pS->phase == 0U)
+        {
+            if ( (pS->read != 0U) && (pS->current == FAKE_REG_TEMP) )
+            {
+                pS->reg[FAKE_REG_STATUS][0U] |= 0x80U;
+            }
+            else if ( (pS->read == 0U) && (pS->current == FAKE_REG_CONFIG) )
+            {
+                Fake_SensorConfigure(pS, pS->reg[FAKE_REG_CONFIG][0U]);
+            }
+            else
+            {
+                /* Nothing else has side effects */
+            }
+        }
+    }
+
+    return rx;
+}
+
+/**
+ * @brief  Finds or adds a tracked port.
+ */
+static Fake_PortTypeDef *Fake_FindPort(GPIO_TypeDef *port)
+{
+    Fake_PortTypeDef *pPort = NULL;
+
+    for (uint32_t i = 0U; (i < Fake_PortCount) && (pPort == NULL); i++)
+    {
+        if (Fake_Port[i].port == port)
+        {
+            pPort = &Fake_Port[i];
+        }
+    }
+
+    if ( (pPort == NULL) && (Fake_PortCount < FAKE_MAX_PORTS) )
+    {
+        pPort       = &Fake_Port[Fake_PortCount++];
+        pPort->port = port;
+        pPort->odr  = port->ODR;
+    }
+
+    return pPort;
+}
+
+/**
+ * @brief  Counts the sensors whose CS is low.
+ */
+static uint32_t Fake_Selected(void)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t i = 0U; i < Fake_SensorCount; i++)
+    {
+        count += Fake_Sensor[i].selected;
+    }
+
+    return count;
+}
+
+/**
+ * @brief  Opens the stream on the first selected sensor and reports it once none is left.
+ */
+static void Fake_UpdateStream(void)
+{
+    if ( (Fake_StreamOpen == 0U) && (Fake_Selected() != 0U) )
+    {
+        Fake_StreamOpen   = 1U;
+        Fake_StreamLength = 0U;
+    }
+    else if ( (Fake_StreamOpen != 0U) && (Fake_Selected() == 0U) )
+    {
+        Fake_StreamOpen = 0U;
+
+        if (Fake_Observer != NULL)
+        {
+            Fake_Observer(Fake_Stream, Fake_StreamLength);
+        }
+    }
+    else
+    {
+        /* Transaction continues */
+    }
+}
+
+/**
+ * @brief  Sets a new output level on a port and reports chip-select edges.
+ */
+static void Fake_Apply(Fake_PortTypeDef *pPort, uint32_t odr)
+{
+    uint32_t falling = pPort->odr & ~odr;
+    uint32_t rising  = odr & ~pPort->odr;
+
+    pPort->odr       = odr;
+    pPort->port->ODR = odr;
+
+    for (uint32_t i = 0U; i < Fake_SensorCount; i++)
+    {
+        Fake_SensorTypeDef *pS = &Fake_Sensor[i];
+
+        if (pS->port == pPort->port)
+        {
+            if ((falling & pS->pin) != 0U)
+            {
+                pS->selected = 1U;
+                pS->phase    = 0U;
+                Fake_CsFalling++;
+            }
+            else if ((rising & pS->pin) != 0U)
+            {
+                pS->selected = 0U;
+                pS->phase    = 0U;
+                Fake_CsRising++;
+            }
+            else
+            {
+                /* Unchanged */
+            }
+        }
+    }
+
+    Fake_UpdateStream();
+}
+
+/**
+ * @brief  Selects the hardware NSS sensors (no CS port) of every SPI that is enabled.
+ */
+static void Fake_Nss(void)
+{
+    for (uint32_t i = 0U; i < Fake_SensorCount; i++)
+    {
+        Fake_SensorTypeDef *pS = &Fake_Sensor[i];
+        uint8_t enabled = 0U;
+
+        if (pS->port == NULL)
+        {
+            enabled = ((pS->hspi->Instance->CR1 & SPI_CR1_SPE) != 0U) ? 1U : 0U;
+
+            if ( (enabled != 0U) && (pS->selected == 0U) )
+            {
+                pS->selected = 1U;
+                pS->phase    = 0U;
+                Fake_CsFalling++;
+            }
+            else if ( (enabled == 0U) && (pS->selected != 0U) )
+            {
+                pS->selected = 0U;
+                pS->phase    = 0U;
+                Fake_CsRising++;
+            }
+            else
+            {
+                /* Unchanged */
+            }
+        }
+    }
+
+    Fake_UpdateStream();
+}
+
+/**
+ * @brief  Latches pending BSRR stores into the output level of every tracked port, then NSS.
+ */
+static void Fake_Latch(void)
+{
+    for (uint32_t i = 0U; i < Fake_PortCount; i++)
+    {
+        Fake_PortTypeDef *pPort = &Fake_Port[i];
+        uint32_t bsrr = pPort->port->BSRR;
+
+        if (bsrr != 0U)
+        {
+            pPort->port->BSRR = 0U;
+            Fake_Apply(pPort, (pPort->odr & ~(bsrr >> 16U)) | (bsrr & 0xFFFFU));
+            Fake_GpioWrites++;
+        }
+    }
+
+    Fake_Nss();
+}
+
+/**
+ * @brief  Exchanges bytes with the sensors selected on a bus.
+ */
+static void Fake_Exchange(SPI_HandleTypeDef *hspi, const uint8_t *pTx, uint8_t *pRx, uint16_t size)
+{
+    uint32_t selected = 0U;
+    uint32_t reading  = 0U;
+    uint8_t  rx       = 0U;
+    uint8_t  tx       = 0U;
+
+    Fake_Latch();
+    Fake_SpiCalls++;
+
+    for (uint16_t b = 0U; b < size; b++)
+    {
+        tx       = (pTx != NULL) ? pTx[b] : 0xFFU;
+        rx       = 0xFFU;
+        selected = 0U;
+        reading  = 0U;
+
+        for (uint32_t i = 0U; i < Fake_SensorCount; i++)
+        {
+            Fake_SensorTypeDef *pS = &Fake_Sensor[i];
+
+            if ( (pS->hspi == hspi) && (pS->selected != 0U) )
+            {
+                selected++;
+                reading += ( (pS->phase != 0U) && (pS->read != 0U) ) ? 1U : 0U;
+                rx &= Fake_SensorByte(pS, tx);
+            }
+        }
+
+        if ( (selected > 1U) && (reading != 0U) )
+        {
+            Fake_Contention++;
+        }
+
+        if (pRx != NULL)
+        {
+            pRx[b] = rx;
+        }
+
+        if ( (Fake_StreamOpen != 0U) && (Fake_StreamLength < FAKE_STREAM_SIZE) )
+        {
+            Fake_Stream[Fake_StreamLength++] = tx;
+        }
+    }
+
+    if (selected == 0U)
+    {
+        Fake_Unselected++;
+    }
+
+    Fake_SpiBytes += size;
+    Fake_Cycles   += FAKE_SPI_CALL_CYCLES + ((uint64_t)size * FAKE_SPI_CYCLES_PER_BYTE);
+}
+
+/**
+ * @brief  Consumes an injected failure, if any.
+ */
+static HAL_StatusTypeDef Fake_TakeFailure(void)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+
+    if (Fake_FailCalls > 0U)
+    {
+        Fake_FailCalls--;
+        status = Fake_FailStatus;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Runs a blocking transfer.
+ */
+static HAL_StatusTypeDef Fake_Blocking(SPI_HandleTypeDef *hspi, uint8_t *pTx, uint8_t *pRx, uint16_t size)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+
+    Fake_IsrTypeDef isr = Fake_TransferIsr;
+
+    if (hspi->State != HAL_SPI_STATE_READY)
+    {
+        status = HAL_BUSY;
+    }
+    else
+    {
+        status = Fake_TakeFailure();
+
+        if (status == HAL_OK)
+        {
+            /* Busy for the whole transfer, as the HAL keeps the handle; the HAL enables the SPI */
+            hspi->State = HAL_SPI_STATE_BUSY_TX_RX;
+            __HAL_SPI_ENABLE(hspi);
+
+            if (isr != NULL)
+            {
+                Fake_TransferIsr = NULL;
+                Fake_Latch();
+                isr();
+            }
+
+            Fake_Exchange(hspi, pTx, pRx, size);
+            hspi->State = HAL_SPI_STATE_READY;
+        }
+        else
+        {
+            Fake_Cycles += FAKE_SPI_CALL_CYCLES;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Starts an IT/DMA transfer.
+ */
+static HAL_StatusTypeDef Fake_Start(SPI_HandleTypeDef *hspi, uint8_t *pTx, uint8_t *pRx, uint16_t size)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+    Fake_PendingTypeDef *pSlot = NULL;
+
+    Fake_Latch();
+
+    if (hspi->State != HAL_SPI_STATE_READY)
+    {
+        status = HAL_BUSY;
+    }
+    else
+    {
+        status = Fake_TakeFailure();
+
+        for (uint32_t i = 0U; (i < FAKE_MAX_SPI) && (pSlot == NULL); i++)
+        {
+            if (Fake_Pending[i].hspi == NULL)
+            {
+                pSlot = &Fake_Pending[i];
+            }
+        }
+
+        if ( (status == HAL_OK) && (pSlot != NULL) )
+        {
+            pSlot->hspi = hspi;
+            pSlot->pTx  = pTx;
+            pSlot->pRx  = pRx;
+            pSlot->size = size;
+            pSlot->due  = Fake_Cycles + FAKE_SPI_CALL_CYCLES + ((uint64_t)size * FAKE_SPI_CYCLES_PER_BYTE);
+            hspi->State = HAL_SPI_STATE_BUSY_TX_RX;
+            __HAL_SPI_ENABLE(hspi);
+            Fake_Nss();
+        }
+        else if (status == HAL_OK)
+        {
+            status = HAL_ERROR;
+        }
+        else
+        {
+            /* Injected failure */
+        }
+    }
+
+    Fake_Cycles += FAKE_SPI_CALL_CYCLES;
+
+    return status;
+}
+
+/**
+ * @brief  Finds the pending transfer of a bus.
+ */
+static Fake_PendingTypeDef *Fake_FindPending(const SPI_HandleTypeDef *hspi)
+{
+    Fake_PendingTypeDef *pSlot = NULL;
+
+    for (uint32_t i = 0U; (i < FAKE_MAX_SPI) && (pSlot == NULL); i++)
+    {
+        if (Fake_Pending[i].hspi == hspi)
+        {
+            pSlot = &Fake_Pending[i];
+        }
+    }
+
+    return pSlot;
+}
+
+
+/* ------------------------------------ Core ---------------------------------------- */
+
+/**
+ * @brief  DWT registers; CYCCNT follows the simulated clock once enabled.
+ */
+DWT_Type *Fake_Dwt(void)
+{
+    if ( ((Fake_CoreDebug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk) != 0U) && ((Fake_DwtRegs.CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U) )
+    {
+        if (Fake_DwtRegs.CYCCNT != Fake_DwtShadow)
+        {
+            /* Written by the code under test */
+            Fake_DwtOffset = Fake_DwtRegs.CYCCNT - (uint32_t)Fake_Cycles;
+        }
+
+        Fake_Cycles        += FAKE_DWT_READ_CYCLES;
+        Fake_DwtShadow      = (uint32_t)Fake_Cycles + Fake_DwtOffset;
+        Fake_DwtRegs.CYCCNT = Fake_DwtShadow;
+    }
+
+    return &Fake_DwtRegs;
+}
+
+/**
+ * @brief  Exclusive load: reserves the address for the calling thread.
+ *
+ * An interrupt armed with Fake_InterruptExclusive() runs right after the load, and
+ * its exception return clears the reservation as on the core.
+ */
+uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    Fake_IsrTypeDef isr = Fake_ExclusiveIsr;
+    uint32_t value      = __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+
+    Fake_ExclusiveAddr  = addr;
+    Fake_ExclusiveValue = value;
+
+    if (isr != NULL)
+    {
+        Fake_ExclusiveIsr = NULL;
+        isr();
+        Fake_ExclusiveAddr = NULL;
+    }
+
+    return value;
+}
+
+/**
+ * @brief  Exclusive store: succeeds (returns 0) only if nobody wrote the address since
+ *         the matching __LDREXW() of this thread.
+ */
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    uint32_t failed   = 1U;
+    uint32_t expected = Fake_ExclusiveValue;
+
+    if ( (addr == Fake_ExclusiveAddr) &&
+         __atomic_compare_exchange_n(addr, &expected, value, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) )
+    {
+        failed = 0U;
+    }
+
+    Fake_ExclusiveAddr = NULL;
+
+    return failed;
+}
+
+/**
+ * @brief  Clears the reservation of the calling thread.
+ */
+void __CLREX(void)
+{
+    Fake_ExclusiveAddr = NULL;
+}
+
+
+/* ------------------------------------- HAL ---------------------------------------- */
+
+uint32_t HAL_GetTick(void)
+{
+    Fake_IsrTypeDef isr = Fake_TickIsr;
+
+    Fake_Latch();
+
+    if (isr != NULL)
+    {
+        Fake_TickIsr = NULL;
+        isr();
+    }
+
+    Fake_Cycles += FAKE_TICK_READ_CYCLES;
+
+    return (uint32_t)(Fake_Cycles / FAKE_CYCLES_PER_MS);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    Fake_Cycles += ((uint64_t)Delay + 1U) * FAKE_CYCLES_PER_MS;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    Fake_PortTypeDef *pPort = NULL;
+
+    Fake_Latch();
+    Fake_GpioWrites++;
+    pPort = Fake_FindPort(GPIOx);
+
+    if (pPort != NULL)
+    {
+        Fake_Apply(pPort, (PinState == GPIO_PIN_SET) ? (pPort->odr | GPIO_Pin) : (pPort->odr & ~(uint32_t)GPIO_Pin));
+    }
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+    hspi->State = HAL_SPI_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)Timeout;
+
+    return Fake_Blocking(hspi, pData, NULL, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint32_t Timeout)
+{
+    (void)Timeout;
+
+    return Fake_Blocking(hspi, pTxData, pRxData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size)
+{
+    return Fake_Start(hspi, pTxData, pRxData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size)
+{
+    return Fake_Start(hspi, pTxData, pRxData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
+{
+    Fake_PendingTypeDef *pSlot = Fake_FindPending(hspi);
+
+    if (pSlot != NULL)
+    {
+        pSlot->hspi = NULL;
+    }
+
+    hspi->State = HAL_SPI_STATE_READY;
+    Fake_SpiAborts++;
+
+    return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(const SPI_HandleTypeDef *hspi)
+{
+    return hspi->State;
+}
+
+__attribute__((weak)) void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    (void)hspi;
+}
+
+__attribute__((weak)) void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    (void)hspi;
+}
+
+HAL_StatusTypeDef HAL_HSEM_FastTake(uint32_t SemID)
+{
+    (void)SemID;
+
+    return HAL_OK;
+}
+
+void HAL_HSEM_Release(uint32_t SemID, uint32_t ProcessID)
+{
+    uint32_t mask = __HAL_HSEM_SEMID_TO_MASK(SemID);
+
+    (void)ProcessID;
+
+    if ((__atomic_load_n(&Fake_HsemActive, __ATOMIC_SEQ_CST) & mask) != 0U)
+    {
+        __atomic_fetch_add(&Fake_HsemCount, 1U, __ATOMIC_SEQ_CST);
+        HAL_HSEM_FreeCallback(mask);
+    }
+}
+
+void HAL_HSEM_ActivateNotification(uint32_t SemMask)
+{
+    __atomic_fetch_or(&Fake_HsemActive, SemMask, __ATOMIC_SEQ_CST);
+}
+
+__attribute__((weak)) void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+    (void)SemMask;
+}
+
+void SCB_InvalidateDCache_by_Addr(void *addr, int32_t dsize)
+{
+    (void)addr;
+    (void)dsize;
+    Fake_DCacheInvalidates++;
+    __sync_synchronize();
+}
+
+void SCB_CleanDCache_by_Addr(void *addr, int32_t dsize)
+{
+    (void)addr;
+    (void)dsize;
+    Fake_DCacheCleans++;
+    __sync_synchronize();
+}
+
+
+/* --------------------------------- Fake Control ----------------------------------- */
+
+/**
+ * @brief  Clears the clock, sensors, ports, pending transfers and counters.
+ */
+void Fake_Reset(void)
+{
+    SystemCoreClock = FAKE_CORE_HZ;
+    Fake_Primask    = 0U;
+    Fake_Cycles     = 0U;
+    memset(&Fake_CoreDebug, 0, sizeof(Fake_CoreDebug));
+    memset(&Fake_DwtRegs, 0, sizeof(Fake_DwtRegs));
+    Fake_DwtShadow    = 0U;
+    Fake_DwtOffset    = 0U;
+    memset(Fake_Sensor, 0, sizeof(Fake_Sensor));
+    Fake_SensorCount  = 0U;
+    memset(Fake_Port, 0, sizeof(Fake_Port));
+    Fake_PortCount    = 0U;
+    memset(Fake_Pending, 0, sizeof(Fake_Pending));
+    Fake_Observer     = NULL;
+    Fake_StreamLength = 0U;
+    Fake_StreamOpen   = 0U;
+    Fake_CsFalling    = 0U;
+    Fake_CsRising     = 0U;
+    Fake_Contention   = 0U;
+    Fake_Unselected   = 0U;
+    Fake_SpiCalls     = 0U;
+    Fake_SpiBytes     = 0U;
+    Fake_SpiAborts    = 0U;
+    Fake_GpioWrites   = 0U;
+    Fake_DCacheCleans      = 0U;
+    Fake_DCacheInvalidates = 0U;
+    Fake_IdleCycles        = 0U;
+    Fake_FailStatus   = HAL_OK;
+    Fake_FailCalls    = 0U;
+    Fake_HsemActive   = 0U;
+    Fake_HsemCount    = 0U;
+    Fake_ExclusiveIsr = NULL;
+    Fake_TransferIsr  = NULL;
+    Fake_TickIsr      = NULL;
+}
+
+void Fake_AdvanceUs(uint32_t us)
+{
+    Fake_Cycles += (uint64_t)us * FAKE_CYCLES_PER_US;
+}
+
+void Fake_AdvanceMs(uint32_t ms)
+{
+    Fake_Cycles += (uint64_t)ms * FAKE_CYCLES_PER_MS;
+}
+
+/**
+ * @brief  Prepares an SPI handle in mode 3, ready.
+ */
+void Fake_SPI_Init(SPI_HandleTypeDef *hspi, SPI_TypeDef *instance)
+{
+    memset(instance, 0, sizeof(*instance));
+    memset(hspi, 0, sizeof(*hspi));
+    hspi->Instance               = instance;
+    hspi->Init.CLKPolarity       = SPI_POLARITY_HIGH;
+    hspi->Init.CLKPhase          = SPI_PHASE_2EDGE;
+    hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
+    hspi->State                  = HAL_SPI_STATE_READY;
+#if defined (_STM32H7) || defined (_STM32U5)
+    instance->CFG2 = SPI_CFG2_CPOL | SPI_CFG2_CPHA;
+    instance->CFG1 = SPI_BAUDRATEPRESCALER_8;
+#else
+    instance->CR1  = SPI_CR1_CPOL | SPI_CR1_CPHA | SPI_BAUDRATEPRESCALER_8;
+#endif
+}
+
+/**
+ * @brief  Attaches a simulated ADT7320 (CS idle high, or hardware NSS if @p port is NULL) and returns its index.
+ */
+int Fake_AddSensor(SPI_HandleTypeDef *hspi, GPIO_TypeDef *port, uint16_t pin, int16_t raw)
+{
+    int index = -1;
+    Fake_PortTypeDef *pPort = NULL;
+
+    if (Fake_SensorCount < FAKE_MAX_SENSORS)
+    {
+        index = (int)Fake_SensorCount++;
+        Fake_Sensor[index].hspi = hspi;
+        Fake_Sensor[index].port = port;
+        Fake_Sensor[index].pin  = pin;
+        Fake_Sensor[index].raw  = raw;
+        Fake_Sensor[index].conversionUs = FAKE_CONVERSION_US;
+        Fake_SensorReset(&Fake_Sensor[index]);
+
+        if (port != NULL)
+        {
+            pPort = Fake_FindPort(port);
+            pPort->odr |= pin;
+            port->ODR   = pPort->odr;
+        }
+    }
+
+    return index;
+}
+
+void Fake_SetTemp(int sensor, int16_t raw)
+{
+    Fake_Sensor[sensor].raw = raw;
+}
+
+/**
+ * @brief  Latches pending BSRR stores (ends a CS cycle driven through BSRR).
+ */
+void Fake_Sync(void)
+{
+    Fake_Latch();
+}
+
+void Fake_SetObserver(Fake_TransactionTypeDef observer)
+{
+    Fake_Observer = observer;
+}
+
+/**
+ * @brief  Runs @p isr once, during the next blocking transfer (CS low, handle busy).
+ */
+void Fake_InterruptTransfer(Fake_IsrTypeDef isr)
+{
+    Fake_TransferIsr = isr;
+}
+
+/**
+ * @brief  Runs @p isr once, inside the next HAL_GetTick() call (a SysTick interrupt
+ *         landing just before the tick is read).
+ */
+void Fake_InterruptTick(Fake_IsrTypeDef isr)
+{
+    Fake_TickIsr = isr;
+}
+
+/**
+ * @brief  Sets the conversion time of a sensor (FAKE_CONVERSION_US by default).
+ */
+void Fake_SetConversionUs(int sensor, uint32_t us)
+{
+    Fake_Sensor[sensor].conversionUs = us;
+}
+
+/**
+ * @brief  Runs @p isr once, inside the next exclusive load/store sequence.
+ */
+void Fake_InterruptExclusive(Fake_IsrTypeDef isr)
+{
+    Fake_ExclusiveIsr = isr;
+}
+
+/**
+ * @brief  Makes the next @p calls SPI calls return @p status without transferring.
+ */
+void Fake_SPI_FailNext(HAL_StatusTypeDef status, uint32_t calls)
+{
+    Fake_FailStatus = status;
+    Fake_FailCalls  = calls;
+}
+
+uint8_t Fake_SPI_Pending(const SPI_HandleTypeDef *hspi)
+{
+    return (uint8_t)(Fake_FindPending(hspi) != NULL);
+}
+
+/**
+ * @brief  Completes the pending IT/DMA transfer of a bus and calls HAL_SPI_TxRxCpltCallback().
+ */
+void Fake_SPI_Finish(SPI_HandleTypeDef *hspi)
+{
+    Fake_PendingTypeDef *pSlot = Fake_FindPending(hspi);
+
+    if (pSlot != NULL)
+    {
+        Fake_Exchange(hspi, pSlot->pTx, pSlot->pRx, pSlot->size);
+        pSlot->hspi = NULL;
+        hspi->State = HAL_SPI_STATE_READY;
+        HAL_SPI_TxRxCpltCallback(hspi);
+    }
+}
+
+/**
+ * @brief  Lets every bus run in parallel until the earliest pending IT/DMA transfer ends,
+ *         then completes it.
+ *
+ * The CPU idles until then (counted in Fake_IdleCycles); only the completion interrupt
+ * is charged to it, since the peripheral clocked the bytes on its own.
+ *
+ * @return 0 if no transfer was pending.
+ */
+uint8_t Fake_SPI_FinishNext(void)
+{
+    Fake_PendingTypeDef *pSlot = NULL;
+    SPI_HandleTypeDef *hspi = NULL;
+    uint64_t now = 0U;
+
+    for (uint32_t i = 0U; i < FAKE_MAX_SPI; i++)
+    {
+        if ( (Fake_Pending[i].hspi != NULL) && ((pSlot == NULL) || (Fake_Pending[i].due < pSlot->due)) )
+        {
+            pSlot = &Fake_Pending[i];
+        }
+    }
+
+    if (pSlot != NULL)
+    {
+        if (pSlot->due > Fake_Cycles)
+        {
+            Fake_IdleCycles += pSlot->due - Fake_Cycles;
+            Fake_Cycles      = pSlot->due;
+        }
+
+        hspi = pSlot->hspi;
+        now  = Fake_Cycles;
+        Fake_Exchange(hspi, pSlot->pTx, pSlot->pRx, pSlot->size);
+        Fake_Cycles = now + FAKE_SPI_CALL_CYCLES;
+        pSlot->hspi = NULL;
+        hspi->State = HAL_SPI_STATE_READY;
+        HAL_SPI_TxRxCpltCallback(hspi);
+    }
+
+    return (uint8_t)(pSlot != NULL);
+}
+
+/**
+ * @brief  Fails the pending IT/DMA transfer of a bus and calls HAL_SPI_ErrorCallback().
+ */
+void Fake_SPI_Fail(SPI_HandleTypeDef *hspi)
+{
+    Fake_PendingTypeDef *pSlot = Fake_FindPending(hspi);
+
+    if (pSlot != NULL)
+    {
+        pSlot->hspi     = NULL;
+        hspi->State     = HAL_SPI_STATE_READY;
+        hspi->ErrorCode = 1U;
+        HAL_SPI_ErrorCallback(hspi);
+    }
+}
+
+uint32_t Fake_HSEM_Notifications(void)
+{
+    return __atomic_load_n(&Fake_HsemCount, __ATOMIC_SEQ_CST);
+}
+
+
+/* fake_hal.c */
@@ -0,0 +1,309 @@
+/**
+ * @file    fake_hal.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Host fake of the STM32 HAL subset used by the ADT7320 driver, with simulated sensors.
+ *
+ * @details
+ * Replaces the HAL, CMSIS core registers and the sensors themselves so the library
+ * builds and runs unchanged on a host:
+ *
+ * - one simulated clock in CPU cycles drives HAL_GetTick(), DWT->CYCCNT (only counting
+ *   once TRCENA and CYCCNTENA are set, as on silicon) and the sensor conversions;
+ * - every SPI byte costs FAKE_SPI_CYCLES_PER_BYTE and every HAL call
+ *   FAKE_SPI_CALL_CYCLES, so timings and benchmarks are deterministic;
+ * - GPIO chip selects are tracked through HAL_GPIO_WritePin() immediately and through
+ *   BSRR stores at the next fake call (a store cannot be trapped in C). Code that
+ *   drives CS with BSRR must use one fake port per sensor;
+ * - each simulated ADT7320 decodes the command stream while its CS is low: register
+ *   file, 32-ones serial reset, continuous / one-shot / shutdown modes, RDY, alarm
+ *   flags, and garbage when the SPI is not in mode 3;
+ * - every CS cycle (falling to rising edge) is reported with its transmitted bytes to
+ *   an optional observer, e.g. ADT7320_Trace_Record();
+ * - IT/DMA transfers stay pending until Fake_SPI_Finish() or Fake_SPI_Fail(), which
+ *   call the weak HAL_SPI_TxRxCpltCallback() / HAL_SPI_ErrorCallback(), so stalls are
+ *   simulated by never finishing. Fake_SPI_FinishNext() instead runs the buses in
+ *   parallel and completes the earliest transfer, for discrete-event simulations of
+ *   several buses.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef FAKE_HAL_H
+#define FAKE_HAL_H
+
+
+#ifdef __cplusplus
+    extern "C" {
+#endif  /* __cplusplus */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <stdint.h>  /**< Fixed-width integer types */
+#include <stddef.h>  /**< NULL */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Simulated core clock and bus costs */
+#define  FAKE_CORE_HZ              (72000000UL)  ///< SystemCoreClock
+#define  FAKE_SPI_CYCLES_PER_BYTE  (64U)         ///< 9 MHz SCK at 72 MHz
+#define  FAKE_SPI_CALL_CYCLES      (300U)        ///< HAL call and CS handling overhead
+#define  FAKE_DWT_READ_CYCLES      (4U)          ///< Cycles elapsed per DWT->CYCCNT access
+
+/** @brief Fake limits */
+#define  FAKE_MAX_SENSORS  (512U)
+#define  FAKE_MAX_PORTS    (64U)
+#define  FAKE_MAX_SPI      (16U)
+#define  FAKE_STREAM_SIZE  (256U)
+
+/** @brief Typical ADT7320 conversion time, in microseconds */
+#define  FAKE_CONVERSION_US  (240000UL)
+
+/** @brief Core */
+#define  __CORTEX_M  (3U)
+#define  __ALIGNED(x)  __attribute__((aligned(x)))
+#define  __DMB()  __sync_synchronize()
+#define  __DSB()  __sync_synchronize()
+#define  __get_PRIMASK()    (Fake_Primask)
+#define  __set_PRIMASK(x)   (Fake_Primask = (x))
+#define  __disable_irq()    (Fake_Primask = 1U)
+#define  __enable_irq()     (Fake_Primask = 0U)
+
+/** @brief Cortex-M7 series: data cache present */
+#if defined (_STM32F7) || defined (_STM32H7)
+    #define  __DCACHE_PRESENT  (1U)
+#endif
+
+#define  DWT        (Fake_Dwt())
+#define  CoreDebug  (&Fake_CoreDebug)
+#define  CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24U)
+#define  DWT_CTRL_CYCCNTENA_Msk      (1UL)
+
+/** @brief GPIO */
+#define  GPIO_PIN_0   ((uint16_t)0x0001)
+#define  GPIO_PIN_1   ((uint16_t)0x0002)
+#define  GPIO_PIN_2   ((uint16_t)0x0004)
+#define  GPIO_PIN_3   ((uint16_t)0x0008)
+#define  GPIO_PIN_4   ((uint16_t)0x0010)
+#define  GPIO_PIN_5   ((uint16_t)0x0020)
+#define  GPIO_PIN_6   ((uint16_t)0x0040)
+#define  GPIO_PIN_7   ((uint16_t)0x0080)
+
+/** @brief SPI */
+#define  SPI_CR1_CPHA   (1UL << 0U)
+#define  SPI_CR1_CPOL   (1UL << 1U)
+#define  SPI_CR1_BR     (7UL << 3U)
+#define  SPI_CR1_SPE    (1UL << 6U)
+#define  SPI_CFG1_MBR   (7UL << 28U)
+#define  SPI_CFG2_CPHA  (1UL << 24U)
+#define  SPI_CFG2_CPOL  (1UL << 25U)
+
+#if defined (_STM32H7) || defined (_STM32U5)
+    #define  SPI_POLARITY_HIGH         SPI_CFG2_CPOL
+    #define  SPI_PHASE_2EDGE           SPI_CFG2_CPHA
+    #define  SPI_BAUDRATEPRESCALER_2   (0UL << 28U)
+    #define  SPI_BAUDRATEPRESCALER_8   (2UL << 28U)
+    #define  SPI_BAUDRATEPRESCALER_16  (3UL << 28U)
+#else
+    #define  SPI_POLARITY_HIGH         SPI_CR1_CPOL
+    #define  SPI_PHASE_2EDGE           SPI_CR1_CPHA
+    #define  SPI_BAUDRATEPRESCALER_2   (0UL << 3U)
+    #define  SPI_BAUDRATEPRESCALER_8   (2UL << 3U)
+    #define  SPI_BAUDRATEPRESCALER_16  (3UL << 3U)
+#endif
+#define  SPI_POLARITY_LOW  (0UL)
+#define  SPI_PHASE_1EDGE   (0UL)
+
+#define  __HAL_SPI_DISABLE(h)  ((h)->Instance->CR1 &= ~SPI_CR1_SPE)
+#define  __HAL_SPI_ENABLE(h)   ((h)->Instance->CR1 |= SPI_CR1_SPE)
+
+/** @brief Hardware semaphores and cache (STM32H7) */
+#define  __HAL_HSEM_SEMID_TO_MASK(id)  (1UL << (id))
+
+
+/* -------------------------------------- Types -------------------------------------- */
+
+typedef enum
+{
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+    volatile uint32_t IDR;
+    volatile uint32_t ODR;
+    volatile uint32_t BSRR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t CR1;
+    volatile uint32_t CR2;
+    volatile uint32_t CFG1;
+    volatile uint32_t CFG2;
+} SPI_TypeDef;
+
+typedef struct
+{
+    uint32_t CLKPolarity;
+    uint32_t CLKPhase;
+    uint32_t BaudRatePrescaler;
+} SPI_InitTypeDef;
+
+typedef enum
+{
+    HAL_SPI_STATE_RESET      = 0x00U,
+    HAL_SPI_STATE_READY      = 0x01U,
+    HAL_SPI_STATE_BUSY_TX_RX = 0x05U
+} HAL_SPI_StateTypeDef;
+
+typedef struct
+{
+    SPI_TypeDef *Instance;
+    SPI_InitTypeDef Init;
+    volatile HAL_SPI_StateTypeDef State;
+    volatile uint32_t ErrorCode;
+} SPI_HandleTypeDef;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+/**
+ * @brief Observer of completed CS cycles.
+ *
+ * @param pTx  Bytes transmitted while CS was low.
+ * @param len  Number of bytes.
+ */
+typedef void (*Fake_TransactionTypeDef)(const uint8_t *pTx, uint16_t len);
+
+/**
+ * @brief Simulated interrupt handler.
+ */
+typedef void (*Fake_IsrTypeDef)(void);
+
+/**
+ * @brief State of one simulated ADT7320.
+ */
+typedef struct
+{
+    SPI_HandleTypeDef *hspi;      /**< Bus of the sensor */
+    GPIO_TypeDef *port;           /**< CS port */
+    uint16_t pin;                 /**< CS pin */
+    int16_t  raw;                 /**< Temperature the next conversion will measure */
+    uint8_t  reg[8U][2U];         /**< Register file, MSB first */
+    uint8_t  phase;               /**< 0: expecting a command, else data bytes left */
+    uint8_t  current;             /**< Register of the command in progress */
+    uint8_t  read;                /**< Non-zero if the command in progress is a read */
+    uint8_t  index;               /**< Data byte index of the command in progress */
+    uint8_t  ones;                /**< Consecutive 0xFF bytes (reset detection) */
+    uint8_t  selected;            /**< CS low */
+    uint8_t  converting;          /**< One-shot conversion in progress */
+    uint32_t conversionUs;        /**< Conversion time, in microseconds */
+    uint64_t convEnd;             /**< Cycle at which the conversion in progress ends */
+    uint64_t lastConvStart;       /**< Cycle at which the last conversion started */
+    uint32_t conversions;         /**< Conversions completed */
+    uint32_t commands;            /**< Commands decoded */
+    uint32_t modeErrors;          /**< Bytes clocked in a mode other than 3 */
+} Fake_SensorTypeDef;
+
+
+/* ------------------------------------ Variables ------------------------------------ */
+
+extern uint32_t SystemCoreClock;
+extern volatile uint32_t Fake_Primask;
+extern CoreDebug_Type Fake_CoreDebug;
+extern volatile uint64_t Fake_Cycles;
+extern Fake_SensorTypeDef Fake_Sensor[FAKE_MAX_SENSORS];
+extern uint32_t Fake_SensorCount;
+extern uint32_t Fake_CsFalling;       /**< CS falling edges seen */
+extern uint32_t Fake_CsRising;        /**< CS rising edges seen */
+extern uint32_t Fake_Contention;      /**< Read bytes clocked with several sensors selected */
+extern uint32_t Fake_Unselected;      /**< Transfers with no sensor selected */
+extern uint32_t Fake_SpiCalls;        /**< HAL SPI transfer calls */
+extern uint32_t Fake_SpiBytes;        /**< Bytes clocked */
+extern uint32_t Fake_SpiAborts;       /**< HAL_SPI_Abort() calls */
+extern uint32_t Fake_GpioWrites;      /**< GPIO writes: HAL_GPIO_WritePin() calls and latched BSRR stores */
+extern uint32_t Fake_DCacheCleans;       /**< SCB_CleanDCache_by_Addr() calls */
+extern uint32_t Fake_DCacheInvalidates;  /**< SCB_InvalidateDCache_by_Addr() calls */
+extern uint64_t Fake_IdleCycles;         /**< Cycles the CPU waited in Fake_SPI_FinishNext() */
+
+
+/* ------------------------------------ Prototype ------------------------------------ */
+
+/* Core */
+DWT_Type *Fake_Dwt(void);
+uint32_t __LDREXW(volatile uint32_t *addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+void __CLREX(void);
+
+/* HAL */
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi);
+HAL_SPI_StateTypeDef HAL_SPI_GetState(const SPI_HandleTypeDef *hspi);
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_HSEM_FastTake(uint32_t SemID);
+void HAL_HSEM_Release(uint32_t SemID, uint32_t ProcessID);
+void HAL_HSEM_ActivateNotification(uint32_t SemMask);
+void HAL_HSEM_FreeCallback(uint32_t SemMask);
+void SCB_InvalidateDCache_by_Addr(void *addr, int32_t dsize);
+void SCB_CleanDCache_by_Addr(void *addr, int32_t dsize);
+
+/* Fake control */
+void Fake_Reset(void);
+void Fake_AdvanceUs(uint32_t us);
+void Fake_AdvanceMs(uint32_t ms);
+void Fake_SPI_Init(SPI_HandleTypeDef *hspi, SPI_TypeDef *instance);
+int  Fake_AddSensor(SPI_HandleTypeDef *hspi, GPIO_TypeDef *port, uint16_t pin, int16_t raw);
+void Fake_SetTemp(int sensor, int16_t raw);
+void Fake_Sync(void);
+void Fake_SetObserver(Fake_TransactionTypeDef observer);
+void Fake_InterruptExclusive(Fake_IsrTypeDef isr);
+void Fake_InterruptTransfer(Fake_IsrTypeDef isr);
+void Fake_InterruptTick(Fake_IsrTypeDef isr);
+void Fake_SetConversionUs(int sensor, uint32_t us);
+void Fake_SPI_FailNext(HAL_StatusTypeDef status, uint32_t calls);
+uint8_t Fake_SPI_Pending(const SPI_HandleTypeDef *hspi);
+void Fake_SPI_Finish(SPI_HandleTypeDef *hspi);
+void Fake_SPI_Fail(SPI_HandleTypeDef *hspi);
+uint8_t Fake_SPI_FinishNext(void);
+uint32_t Fake_HSEM_Notifications(void);
+
+
+#ifdef __cplusplus
+    }
+#endif  /* __cplusplus */
+
+
+#endif  /* FAKE_HAL_H */
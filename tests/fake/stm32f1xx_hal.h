@@ -0,0 +1,20 @@
+/**
+ * @file    stm32f1xx_hal.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Host stand-in for the STM32F1 HAL header (see fake_hal.h).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef STM32F1XX_HAL_H
+#define STM32F1XX_HAL_H
+
+#include "fake_hal.h"  /**< Fake HAL */
+
+#endif  /* STM32F1XX_HAL_H */
@@ -0,0 +1,20 @@
+/**
+ * @file    stm32h7xx_hal.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Host stand-in for the STM32H7 HAL header (see fake_hal.h).
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef STM32H7XX_HAL_H
+#define STM32H7XX_HAL_H
+
+#include "fake_hal.h"  /**< Fake HAL */
+
+#endif  /* STM32H7XX_HAL_H */
@@ -0,0 +1,84 @@
+/**
+ * @file    trace_golden.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Golden bus-traffic streams and budgets of the core driver scenarios.
+ *
+ * @details
+ * Streams use the ADT7320_TraceTypeDef layout, [length][bytes...] per CS cycle, as
+ * seen on the wire by the fake HAL. A change that adds a transaction or a byte to a
+ * scenario must update its stream and budget here, in the same commit.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef TRACE_GOLDEN_H
+#define TRACE_GOLDEN_H
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <stdint.h>  /**< Fixed-width integer types */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Temperature reads of the N-reads scenario */
+#define  GOLDEN_READS  (8U)
+
+
+/* ------------------------------------ Variables ------------------------------------ */
+
+/** @brief Init: 32-ones serial reset */
+static const uint8_t Golden_Init[] =
+{
+    4U, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+};
+
+/** @brief Configure: 16-bit mode, then TCRIT = 80 C, THIGH = 50 C, TLOW = 20 C */
+static const uint8_t Golden_Configure[] =
+{
+    2U, 0x08U, 0x80U,
+    3U, 0x20U, 0x28U, 0x00U,
+    3U, 0x30U, 0x19U, 0x00U,
+    3U, 0x38U, 0x0AU, 0x00U
+};
+
+/** @brief N reads: GOLDEN_READS temperature reads */
+static const uint8_t Golden_Reads[] =
+{
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U
+};
+
+/** @brief Alarm handling: status read, temperature read, THIGH raised to 60 C */
+static const uint8_t Golden_Alarm[] =
+{
+    2U, 0x40U, 0x00U,
+    3U, 0x50U, 0x00U, 0x00U,
+    3U, 0x30U, 0x1EU, 0x00U
+};
+
+/** @brief Budgets: transactions and bytes allowed per scenario */
+#define  GOLDEN_INIT_TRANSACTIONS       (1U)
+#define  GOLDEN_INIT_BYTES              (4U)
+#define  GOLDEN_CONFIGURE_TRANSACTIONS  (4U)
+#define  GOLDEN_CONFIGURE_BYTES         (11U)
+#define  GOLDEN_READS_TRANSACTIONS      (GOLDEN_READS)
+#define  GOLDEN_READS_BYTES             (3U * GOLDEN_READS)
+#define  GOLDEN_ALARM_TRANSACTIONS      (3U)
+#define  GOLDEN_ALARM_BYTES             (8U)
+
+
+#endif  /* TRACE_GOLDEN_H */
@@ -0,0 +1,356 @@
+/**
+ * @file    test_anomaly.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Anomaly detector evaluation over labelled logs: detection latency and false positives.
+ *
+ * @details
+ * A log is one sample per line, "raw label", where label is 0 for normal samples and
+ * the anomaly class (1 step, 2 noise burst, 3 ramp) inside an anomaly. Alarms starting
+ * inside a labelled run, or within TEST_SETTLE samples after it while the baseline
+ * re-converges, count as detections; any other alarm is a false positive. Latency is
+ * counted in samples from the first labelled sample, per class.
+ *
+ * Without arguments the test builds a deterministic log (slow drift, near-Gaussian
+ * noise, injected anomalies of each class), checks the detector against it and prints
+ * the report for two thresholds. The variance tracks a steady lag as well as noise, so
+ * a ramp is only flagged while its slope builds up, or when it ends. With a file
+ * argument the test only prints the report for that recording:
+ *
+ *     test_anomaly recorded.log
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <stdlib.h>            /**< malloc(), free() */
+#include <string.h>            /**< memset() */
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_anomaly.h"   /**< Anomaly detector interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SAMPLES   (200000U)
+#define  TEST_EVENTS    (60U)
+#define  TEST_CLASSES   (4U)       /**< Label values: 0 normal, 1 .. 3 anomaly classes */
+#define  TEST_SETTLE    (256U)     /**< Samples after an anomaly still credited to it */
+#define  TEST_SIGMA     (2)        /**< Noise sigma, in LSB */
+#define  TEST_LENGTH    (200U)     /**< Samples per injected anomaly */
+
+#define  TEST_STEP      (1U)
+#define  TEST_BURST     (2U)
+#define  TEST_RAMP      (3U)
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief One log sample */
+typedef struct
+{
+    int16_t raw;
+    uint8_t label;
+} Test_SampleTypeDef;
+
+/** @brief Evaluation report, per anomaly class */
+typedef struct
+{
+    uint32_t anomalies[TEST_CLASSES];    /**< Labelled runs */
+    uint32_t detected[TEST_CLASSES];     /**< Runs with an alarm inside or right after them */
+    uint32_t latencyMax[TEST_CLASSES];   /**< Worst latency, in samples */
+    uint64_t latencySum[TEST_CLASSES];
+    uint32_t falseAlarms;                /**< Alarms outside every run */
+    uint32_t normal;                     /**< Samples outside every run */
+} Test_ReportTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static Test_SampleTypeDef *pLog = NULL;
+static uint32_t logLength = 0U;
+static uint32_t seed = 2026U;
+static uint8_t started = 0U;
+
+static const char *const className[TEST_CLASSES] = { "normal", "step", "burst", "ramp" };
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Deterministic pseudo-random number (LCG).
+ */
+static uint32_t Test_Rand(void)
+{
+    seed = (seed * 1103515245U) + 12345U;
+
+    return (seed >> 8U) & 0xFFFFU;
+}
+
+/**
+ * @brief  Near-Gaussian noise (sum of 12 uniforms), in LSB.
+ */
+static int32_t Test_Noise(int32_t sigma)
+{
+    int32_t sum = 0;
+
+    for (uint32_t i = 0U; i < 12U; i++)
+    {
+        sum += (int32_t)Test_Rand();
+    }
+
+    return ((sum - (6 * 65536)) * sigma) / 65536;
+}
+
+/**
+ * @brief  Builds the synthetic log: a triangular drift of 0.5 °C, and every
+ *         TEST_SAMPLES / TEST_EVENTS samples a step, noise burst or ramp in turn.
+ */
+static void Test_Generate(void)
+{
+    uint32_t period = TEST_SAMPLES / TEST_EVENTS;
+
+    for (uint32_t i = 0U; i < TEST_SAMPLES; i++)
+    {
+        uint32_t phase = i % period;
+        uint32_t kind  = 1U + ((i / period) % 3U);
+        int32_t  drift = (int32_t)((i / 1000U) % 128U);
+        int32_t  raw   = (25 * 128) + ((drift < 64) ? drift : (128 - drift)) + Test_Noise(TEST_SIGMA);
+        uint8_t  label = 0U;
+
+        if ( (i >= period) && (phase >= (period / 2U)) && (phase < ((period / 2U) + TEST_LENGTH)) )
+        {
+            uint32_t t = phase - (period / 2U);
+
+            label = (uint8_t)kind;
+            if (kind == TEST_STEP)
+            {
+                raw += 20 * TEST_SIGMA;
+            }
+            else if (kind == TEST_BURST)
+            {
+                raw += Test_Noise(8 * TEST_SIGMA);
+            }
+            else
+            {
+                raw += (int32_t)(t / 2U);
+            }
+        }
+
+        pLog[i].raw   = (int16_t)raw;
+        pLog[i].label = label;
+    }
+
+    logLength = TEST_SAMPLES;
+}
+
+/**
+ * @brief  Reads a "raw label" log file.
+ */
+static uint8_t Test_Load(const char *pPath)
+{
+    FILE *pFile = fopen(pPath, "r");
+    int   raw   = 0;
+    int   label = 0;
+
+    logLength = 0U;
+
+    if (pFile != NULL)
+    {
+        while ( (logLength < TEST_SAMPLES) && (fscanf(pFile, "%d %d", &raw, &label) == 2) )
+        {
+            pLog[logLength].raw   = (int16_t)raw;
+            pLog[logLength].label = ( (label > 0) && (label < (int)TEST_CLASSES) ) ? (uint8_t)label : ((label != 0) ? 1U : 0U);
+            logLength++;
+        }
+        (void)fclose(pFile);
+    }
+
+    return (logLength > 0U) ? 1U : 0U;
+}
+
+/**
+ * @brief  Anomaly callback: flags the start of an alarm.
+ */
+static void Test_Event(uint8_t sensor, ADT7320_AnomalyEventTypeDef event, int16_t raw, int32_t z)
+{
+    (void)sensor;
+    (void)raw;
+    (void)z;
+
+    if (event == ADT7320_ANOMALY_START)
+    {
+        started = 1U;
+    }
+}
+
+/**
+ * @brief  Runs the detector over the log and scores its alarms.
+ */
+static void Test_Evaluate(const ADT7320_AnomalyParamTypeDef *pParam, Test_ReportTypeDef *pReport)
+{
+    ADT7320_AnomalyTypeDef det;
+    uint32_t runStart = 0U;
+    uint32_t runEnd   = 0U;        /**< One past the credit window of the current run */
+    uint8_t  runClass = 0U;
+    uint8_t  credited = 0U;
+
+    (void)ADT7320_Anomaly_Init(&det, 0U, pParam, Test_Event);
+    memset(pReport, 0, sizeof(*pReport));
+
+    for (uint32_t i = 0U; i < logLength; i++)
+    {
+        if ( (pLog[i].label != 0U) && ((i == 0U) || (pLog[i - 1U].label != pLog[i].label)) )
+        {
+            runStart = i;
+            runClass = pLog[i].label;
+            credited = 0U;
+            pReport->anomalies[runClass]++;
+        }
+        if (pLog[i].label != 0U)
+        {
+            runEnd = i + 1U + TEST_SETTLE;
+        }
+        else if (i >= runEnd)
+        {
+            runClass = 0U;
+            pReport->normal++;
+        }
+        else
+        {
+            /* Settling after a run */
+        }
+
+        started = 0U;
+        (void)ADT7320_Anomaly_Process(&det, pLog[i].raw);
+
+        if (started != 0U)
+        {
+            if (runClass == 0U)
+            {
+                pReport->falseAlarms++;
+            }
+            else if (credited == 0U)
+            {
+                credited = 1U;
+                pReport->detected[runClass]++;
+                pReport->latencySum[runClass] += i - runStart;
+                if ((i - runStart) > pReport->latencyMax[runClass])
+                {
+                    pReport->latencyMax[runClass] = i - runStart;
+                }
+            }
+            else
+            {
+                /* Further alarms of the same run */
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Prints the report of one threshold.
+ */
+static void Test_Print(const char *pName, const ADT7320_AnomalyParamTypeDef *pParam, const Test_ReportTypeDef *pReport)
+{
+    printf("anomaly %s z>=%u.%02u shift %u: %u false alarms (%.2f per 10k normal samples)\n",
+           pName, (unsigned)(pParam->zEnter / 256U), (unsigned)(((pParam->zEnter % 256U) * 100U) / 256U), (unsigned)pParam->shift,
+           (unsigned)pReport->falseAlarms,
+           (pReport->normal > 0U) ? (((double)pReport->falseAlarms * 1e4) / (double)pReport->normal) : 0.0);
+
+    for (uint32_t c = 1U; c < TEST_CLASSES; c++)
+    {
+        if (pReport->anomalies[c] > 0U)
+        {
+            printf("  %-6s %3u/%-3u detected, latency mean %6.1f max %4u samples\n",
+                   className[c], (unsigned)pReport->detected[c], (unsigned)pReport->anomalies[c],
+                   (pReport->detected[c] > 0U) ? ((double)pReport->latencySum[c] / (double)pReport->detected[c]) : 0.0,
+                   (unsigned)pReport->latencyMax[c]);
+        }
+    }
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(int argc, char **argv)
+{
+    ADT7320_AnomalyParamTypeDef loose  = { 5U, 4U * 256U, 2U * 256U, 64U, 1U };
+    ADT7320_AnomalyParamTypeDef strict = { 5U, 6U * 256U, 3U * 256U, 64U, 1U };
+    ADT7320_AnomalyParamTypeDef bad    = { 0U, 4U * 256U, 2U * 256U, 64U, 1U };
+    ADT7320_AnomalyTypeDef det;
+    Test_ReportTypeDef rLoose;
+    Test_ReportTypeDef rStrict;
+
+    pLog = (Test_SampleTypeDef *)malloc(TEST_SAMPLES * sizeof(Test_SampleTypeDef));
+    TEST_CHECK(pLog != NULL);
+
+    if ( (pLog != NULL) && (argc > 1) )
+    {
+        /* Evaluation of a recording only */
+        TEST_CHECK(Test_Load(argv[1]) != 0U);
+        Test_Evaluate(&loose, &rLoose);
+        Test_Evaluate(&strict, &rStrict);
+        Test_Print(argv[1], &loose, &rLoose);
+        Test_Print(argv[1], &strict, &rStrict);
+    }
+    else if (pLog != NULL)
+    {
+        TEST_CHECK(ADT7320_Anomaly_Init(&det, 0U, &bad, NULL) == ADT7320_ERROR);
+        bad.shift = 17U;
+        TEST_CHECK(ADT7320_Anomaly_Init(&det, 0U, &bad, NULL) == ADT7320_ERROR);
+        bad.shift = 5U;
+        bad.zExit = (uint16_t)(bad.zEnter + 1U);
+        TEST_CHECK(ADT7320_Anomaly_Init(&det, 0U, &bad, NULL) == ADT7320_ERROR);
+
+        /* A constant input never alarms: minSigma keeps the variance off zero */
+        TEST_CHECK(ADT7320_Anomaly_Init(&det, 0U, &loose, Test_Event) == ADT7320_OK);
+        for (uint32_t i = 0U; i < 1000U; i++)
+        {
+            TEST_CHECK(ADT7320_Anomaly_Process(&det, 25 * 128) == 0U);
+        }
+        TEST_CHECK(det.events == 0U);
+
+        Test_Generate();
+        Test_Evaluate(&loose, &rLoose);
+        Test_Evaluate(&strict, &rStrict);
+
+        TEST_CHECK((rLoose.anomalies[TEST_STEP] + rLoose.anomalies[TEST_BURST] + rLoose.anomalies[TEST_RAMP]) == (TEST_EVENTS - 1U));
+
+        /* Steps and noise bursts: always caught, within a few samples */
+        TEST_CHECK(rLoose.detected[TEST_STEP] == rLoose.anomalies[TEST_STEP]);
+        TEST_CHECK(rStrict.detected[TEST_STEP] == rStrict.anomalies[TEST_STEP]);
+        TEST_CHECK(rLoose.detected[TEST_BURST] == rLoose.anomalies[TEST_BURST]);
+        TEST_CHECK(rStrict.detected[TEST_BURST] == rStrict.anomalies[TEST_BURST]);
+        TEST_CHECK(rStrict.latencyMax[TEST_STEP] <= 8U);
+        TEST_CHECK(rStrict.latencyMax[TEST_BURST] <= 8U);
+
+        /* Ramps: caught by the lower threshold, at the latest when they end */
+        TEST_CHECK(rLoose.detected[TEST_RAMP] == rLoose.anomalies[TEST_RAMP]);
+        TEST_CHECK(rLoose.latencyMax[TEST_RAMP] <= (TEST_LENGTH + 8U));
+
+        /* A higher threshold trades detections for fewer false alarms */
+        TEST_CHECK(rStrict.falseAlarms <= rLoose.falseAlarms);
+        TEST_CHECK(rStrict.detected[TEST_RAMP] <= rLoose.detected[TEST_RAMP]);
+        TEST_CHECK((rStrict.falseAlarms * 10000U) <= rStrict.normal);
+
+        Test_Print("synthetic", &loose, &rLoose);
+        Test_Print("synthetic", &strict, &rStrict);
+    }
+    else
+    {
+        /* No memory for the log */
+    }
+
+    free(pLog);
+
+    return TEST_RESULT();
+}
+
+
+/* test_anomaly.c */
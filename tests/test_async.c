@@ -0,0 +1,278 @@
+/**
+ * @file    test_async.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Asynchronous bus against stalled, failing and refused transfers.
+ *
+ * @details
+ * The fake keeps IT/DMA transfers pending until the test finishes or fails them, so a
+ * stall is a transfer that is never finished. Each scenario checks the outcome given
+ * to the callback, that CS is released and that the bus accepts the next operation.
+ * The last scenarios interrupt a metric update between its exclusive load and store,
+ * as the completion interrupt does to thread code, and race updates from two threads.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <pthread.h>           /**< Racing threads */
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_async.h"     /**< Asynchronous bus interface */
+#include "adt7320_metrics.h"   /**< Metric registry */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_DEADLINE_MS  (5U)
+#define  TEST_RACE_LOOPS   (1000000U)
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief Callback record */
+typedef struct
+{
+    uint32_t calls;
+    ADT7320_StatusTypeDef status;
+    uint16_t data;
+} Test_ResultTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_AsyncBusTypeDef bus;
+static Test_ResultTypeDef result;
+
+
+/* ------------------------------------ HAL Callbacks ------------------------------- */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Complete(&bus, h);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Error(&bus, h);
+}
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Records the outcome of an operation.
+ */
+static void Test_Done(void *pContext, ADT7320_StatusTypeDef status, uint16_t data)
+{
+    Test_ResultTypeDef *pResult = (Test_ResultTypeDef *)pContext;
+
+    pResult->calls++;
+    pResult->status = status;
+    pResult->data   = data;
+}
+
+/**
+ * @brief  Starts a temperature read with the test deadline.
+ */
+static ADT7320_StatusTypeDef Test_Read(void)
+{
+    result.calls = 0U;
+
+    return ADT7320_Async_Read(&bus, &sensor, ADT7320_TEMP, 2U, TEST_DEADLINE_MS, Test_Done, &result);
+}
+
+/**
+ * @brief  Checks that the operation ended once with @p status, CS high and the bus free.
+ */
+static void Test_Ended(ADT7320_StatusTypeDef status, int s)
+{
+    Fake_Sync();
+    TEST_CHECK(result.calls == 1U);
+    TEST_CHECK(result.status == status);
+    TEST_CHECK(bus.active == 0U);
+    TEST_CHECK(Fake_Sensor[s].selected == 0U);
+    TEST_CHECK(Fake_CsFalling == Fake_CsRising);
+    TEST_CHECK(Fake_SPI_Pending(&hspi) == 0U);
+}
+
+/**
+ * @brief  Completion interrupt recording metrics.
+ */
+static void Test_Isr(void)
+{
+    ADT7320_METRIC_INC(ADT7320_METRIC_SPI_TRANSACTIONS);
+    ADT7320_METRIC_MAX(ADT7320_METRIC_SPI_LATENCY_MAX, 500U);
+}
+
+/**
+ * @brief  SysTick interrupt polling the deadline.
+ */
+static void Test_Tick(void)
+{
+    ADT7320_Async_Poll(&bus);
+}
+
+/**
+ * @brief  Increments a counter and raises a gauge in a loop.
+ */
+static void *Test_Racer(void *pArg)
+{
+    uint32_t base = *(const uint32_t *)pArg;
+
+    for (uint32_t i = 0U; i < TEST_RACE_LOOPS; i++)
+    {
+        ADT7320_METRIC_INC(ADT7320_METRIC_SPI_TRANSACTIONS);
+        ADT7320_METRIC_MAX(ADT7320_METRIC_SPI_LATENCY_MAX, base + i);
+    }
+
+    return NULL;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    int      s      = Test_Setup(&sensor, &hspi, &spi, &port, 25 * 128);
+    uint32_t aborts = 0U;
+
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_Async_Init(&bus, &hspi, ADT7320_ASYNC_IT) == ADT7320_OK);
+
+    /* Normal read */
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    Fake_Sync();
+    TEST_CHECK(Fake_Sensor[s].selected != 0U);
+    TEST_CHECK(Test_Read() == ADT7320_BUSY);
+    Fake_SPI_Finish(&hspi);
+    Test_Ended(ADT7320_OK, s);
+    TEST_CHECK(result.data == (uint16_t)(25 * 128));
+
+    /* Stalled transfer: nothing before the deadline, abort after it */
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    Fake_AdvanceMs(TEST_DEADLINE_MS - 1U);
+    ADT7320_Async_Poll(&bus);
+    TEST_CHECK(result.calls == 0U);
+    TEST_CHECK(bus.active != 0U);
+    Fake_AdvanceMs(1U);
+    ADT7320_Async_Poll(&bus);
+    Test_Ended(ADT7320_TIMEOUT, s);
+    TEST_CHECK(Fake_SpiAborts == 1U);
+    TEST_CHECK(bus.timeouts == 1U);
+
+    /* A completion interrupt that still fires after the abort is ignored */
+    ADT7320_Async_Complete(&bus, &hspi);
+    TEST_CHECK(result.calls == 1U);
+    TEST_CHECK(bus.completed == 1U);
+
+    /* The bus is usable again */
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    Fake_SPI_Finish(&hspi);
+    Test_Ended(ADT7320_OK, s);
+
+    /* SPI error during the transfer */
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    Fake_SPI_Fail(&hspi);
+    Test_Ended(ADT7320_ERROR, s);
+    TEST_CHECK(bus.failed == 1U);
+
+    /* HAL refuses the transfer: no callback, CS released, bus free */
+    Fake_SPI_FailNext(HAL_BUSY, 1U);
+    TEST_CHECK(Test_Read() == ADT7320_ERROR);
+    TEST_CHECK(result.calls == 0U);
+    TEST_CHECK(bus.active == 0U);
+    Fake_Sync();
+    TEST_CHECK(Fake_Sensor[s].selected == 0U);
+    TEST_CHECK(Fake_CsFalling == Fake_CsRising);
+
+    /* Cancel, then nothing left to cancel */
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    TEST_CHECK(ADT7320_Async_Cancel(&bus) == ADT7320_OK);
+    Test_Ended(ADT7320_TIMEOUT, s);
+    TEST_CHECK(ADT7320_Async_Cancel(&bus) == ADT7320_ERROR);
+
+    /* Deadline 0: a stall is never aborted by polling */
+    result.calls = 0U;
+    TEST_CHECK(ADT7320_Async_Read(&bus, &sensor, ADT7320_TEMP, 2U, 0U, Test_Done, &result) == ADT7320_OK);
+    Fake_AdvanceMs(1000U);
+    ADT7320_Async_Poll(&bus);
+    TEST_CHECK(result.calls == 0U);
+    TEST_CHECK(ADT7320_Async_Cancel(&bus) == ADT7320_OK);
+    Test_Ended(ADT7320_TIMEOUT, s);
+
+    /* A tick polling while the next operation is set up neither claims it nor re-runs the last one */
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    Fake_SPI_Finish(&hspi);
+    Test_Ended(ADT7320_OK, s);
+    TEST_CHECK(bus.deadlineMs == 0U);
+    aborts = Fake_SpiAborts;
+    Fake_AdvanceMs(2U * TEST_DEADLINE_MS);
+    Fake_InterruptTick(Test_Tick);
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    TEST_CHECK(result.calls == 0U);
+    TEST_CHECK(bus.active != 0U);
+    TEST_CHECK(Fake_SPI_Pending(&hspi) != 0U);
+    TEST_CHECK(Fake_SpiAborts == aborts);
+    Fake_SPI_Finish(&hspi);
+    Test_Ended(ADT7320_OK, s);
+    TEST_CHECK(result.data == (uint16_t)(25 * 128));
+
+    TEST_CHECK(Fake_Unselected == 0U);
+    TEST_CHECK(Fake_Sensor[s].modeErrors == 0U);
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* DMA on a cached core: buffer on its own line, cleaned before, invalidated after */
+    TEST_CHECK((((uintptr_t)bus.buf) & 31U) == 0U);
+    TEST_CHECK(ADT7320_Async_Init(&bus, &hspi, ADT7320_ASYNC_DMA) == ADT7320_OK);
+    TEST_CHECK(Test_Read() == ADT7320_OK);
+    TEST_CHECK(Fake_DCacheCleans == 1U);
+    Fake_SPI_Finish(&hspi);
+    Test_Ended(ADT7320_OK, s);
+    TEST_CHECK(Fake_DCacheInvalidates == 1U);
+    TEST_CHECK(result.data == (uint16_t)(25 * 128));
+#endif
+
+    /* Interrupt inside the read-modify-write of the thread: both updates survive */
+    ADT7320_Metrics_Init();
+    ADT7320_METRIC_INC(ADT7320_METRIC_SPI_TRANSACTIONS);
+    Fake_InterruptExclusive(Test_Isr);
+    ADT7320_METRIC_INC(ADT7320_METRIC_SPI_TRANSACTIONS);
+    TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_SPI_TRANSACTIONS] == 3U);
+    Fake_InterruptExclusive(Test_Isr);
+    ADT7320_METRIC_MAX(ADT7320_METRIC_SPI_LATENCY_MAX, 400U);
+    TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_SPI_LATENCY_MAX] == 500U);
+    Fake_InterruptExclusive(Test_Isr);
+    ADT7320_METRIC_MAX(ADT7320_METRIC_SPI_LATENCY_MAX, 600U);
+    TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_SPI_LATENCY_MAX] == 600U);
+    TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_SPI_TRANSACTIONS] == 5U);
+
+    /* Metrics recorded from two threads at once lose no update */
+    {
+        pthread_t thread;
+        uint32_t  baseA = 0U;
+        uint32_t  baseB = TEST_RACE_LOOPS;
+
+        ADT7320_Metrics_Init();
+        TEST_CHECK(pthread_create(&thread, NULL, Test_Racer, &baseB) == 0);
+        (void)Test_Racer(&baseA);
+        TEST_CHECK(pthread_join(thread, NULL) == 0);
+
+        TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_SPI_TRANSACTIONS] == (2U * TEST_RACE_LOOPS));
+        TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_SPI_LATENCY_MAX] == ((2U * TEST_RACE_LOOPS) - 1U));
+    }
+
+    return TEST_RESULT();
+}
+
+
+/* test_async.c */
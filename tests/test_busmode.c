@@ -0,0 +1,212 @@
+/**
+ * @file    test_busmode.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Bus mode switching: register rewrites, lazy check, grouping order, accounting, BUSY.
+ *
+ * @details
+ * Built twice: the default build checks the CR1 bits, the H7 build the CFG1/CFG2 bits.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <stdint.h>            /**< uintptr_t */
+#include <string.h>            /**< memcmp() */
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_busmode.h"   /**< Bus mode switching interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_JOBS   (5U)
+#define  TEST_OTHER  (1UL << 8U)   /**< Register bit that is not part of the mode */
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static ADT7320_BusTypeDef bus;
+static ADT7320_BusJobTypeDef jobs[TEST_JOBS];
+static const ADT7320_BusModeTypeDef mode0  = { SPI_POLARITY_LOW, SPI_PHASE_1EDGE, SPI_BAUDRATEPRESCALER_2 };
+static const ADT7320_BusModeTypeDef mode3  = ADT7320_BUSMODE_ADT7320(SPI_BAUDRATEPRESCALER_8);
+static const ADT7320_BusModeTypeDef mode3s = ADT7320_BUSMODE_ADT7320(SPI_BAUDRATEPRESCALER_16);
+static uint8_t  order[TEST_JOBS];
+static uint32_t ran       = 0U;
+static uint32_t wrongMode = 0U;
+static uint8_t  failId    = 0xFFU;
+static uint8_t  grabId    = 0xFFU;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Non-zero if the SPI registers and the handle Init fields hold @p pMode.
+ */
+static uint8_t Test_InMode(const ADT7320_BusModeTypeDef *pMode)
+{
+    uint8_t init = (uint8_t)( (hspi.Init.CLKPolarity == pMode->polarity) && (hspi.Init.CLKPhase == pMode->phase) &&
+                              (hspi.Init.BaudRatePrescaler == pMode->prescaler) );
+
+#if defined (_STM32H7)
+    return (uint8_t)( (init != 0U) && ((spi.CFG1 & SPI_CFG1_MBR) == pMode->prescaler) &&
+                      ((spi.CFG2 & (SPI_CFG2_CPOL | SPI_CFG2_CPHA)) == (pMode->polarity | pMode->phase)) &&
+                      ((spi.CFG1 & TEST_OTHER) != 0U) && ((spi.CFG2 & TEST_OTHER) != 0U) );
+#else
+    return (uint8_t)( (init != 0U) &&
+                      ((spi.CR1 & (SPI_CR1_CPOL | SPI_CR1_CPHA | SPI_CR1_BR)) == (pMode->polarity | pMode->phase | pMode->prescaler)) &&
+                      ((spi.CR1 & TEST_OTHER) != 0U) );
+#endif
+}
+
+/**
+ * @brief  Job: records its position, checks the SPI mode, fails or grabs the bus on request.
+ */
+static ADT7320_StatusTypeDef Test_Job(void *pContext)
+{
+    uint8_t id = (uint8_t)(uintptr_t)pContext;
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    order[ran++] = id;
+    wrongMode   += (Test_InMode(jobs[id].pMode) == 0U) ? 1U : 0U;
+
+    if (id == failId)
+    {
+        status = ADT7320_ERROR;
+    }
+
+    if (id == grabId)
+    {
+        /* Another user starts a transfer on the shared bus */
+        hspi.State = HAL_SPI_STATE_BUSY_TX_RX;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Builds the batch: mode 0, mode 3, mode 0, mode 3, mode 3 at a slower clock.
+ */
+static void Test_Jobs(void)
+{
+    static const ADT7320_BusModeTypeDef *const pModes[TEST_JOBS] = { &mode0, &mode3, &mode0, &mode3, &mode3s };
+
+    for (uint32_t i = 0U; i < TEST_JOBS; i++)
+    {
+        jobs[i].pMode    = pModes[i];
+        jobs[i].run      = Test_Job;
+        jobs[i].pContext = (void *)(uintptr_t)i;
+        jobs[i].status   = ADT7320_BUSY;
+        jobs[i].done     = 0U;
+    }
+
+    ran = 0U;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    static const uint8_t grouped[TEST_JOBS] = { 0U, 2U, 1U, 3U, 4U };
+    uint32_t switches = 0U;
+    uint32_t avoided  = 0U;
+
+    Fake_Reset();
+    Fake_SPI_Init(&hspi, &spi);
+#if defined (_STM32H7)
+    spi.CFG1 |= TEST_OTHER;
+    spi.CFG2 |= TEST_OTHER;
+#else
+    spi.CR1  |= TEST_OTHER;
+#endif
+
+    TEST_CHECK(ADT7320_BusMode_Init(NULL, &hspi) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_BusMode_Init(&bus, NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_BusMode_Init(&bus, &hspi) == ADT7320_OK);
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, NULL) == ADT7320_ERROR);
+
+    /* Same mode: nothing written, the SPI stays enabled, one switch avoided */
+    spi.CR1 |= SPI_CR1_SPE;
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode3) == ADT7320_OK);
+    TEST_CHECK( (bus.switches == 0U) && (bus.avoided == 1U) );
+    TEST_CHECK((spi.CR1 & SPI_CR1_SPE) != 0U);
+    TEST_CHECK(Test_InMode(&mode3) == 1U);
+
+    /* New mode: SPI disabled, only the mode bits rewritten, Init fields follow */
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode0) == ADT7320_OK);
+    TEST_CHECK( (bus.switches == 1U) && (bus.avoided == 1U) );
+    TEST_CHECK((spi.CR1 & SPI_CR1_SPE) == 0U);
+    TEST_CHECK(Test_InMode(&mode0) == 1U);
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode0) == ADT7320_OK);
+    TEST_CHECK( (bus.switches == 1U) && (bus.avoided == 2U) );
+
+    /* A transfer in progress refuses the switch and leaves the mode as it was */
+    hspi.State = HAL_SPI_STATE_BUSY_TX_RX;
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode3) == ADT7320_BUSY);
+    TEST_CHECK( (bus.switches == 1U) && (Test_InMode(&mode0) == 1U) );
+    hspi.State = HAL_SPI_STATE_READY;
+
+    /* Grouping: current mode first, then the others in order of first appearance */
+    Test_Jobs();
+    switches = bus.switches;
+    avoided  = bus.avoided;
+    TEST_CHECK(ADT7320_BusMode_Run(&bus, jobs, TEST_JOBS) == ADT7320_OK);
+    TEST_CHECK(ran == TEST_JOBS);
+    TEST_CHECK(memcmp(order, grouped, TEST_JOBS) == 0);
+    TEST_CHECK(wrongMode == 0U);
+
+    for (uint32_t i = 0U; i < TEST_JOBS; i++)
+    {
+        TEST_CHECK( (jobs[i].done == 1U) && (jobs[i].status == ADT7320_OK) );
+    }
+
+    /* In the given order: 4 switches (0->3->0->3->3 slow); grouped: 2 */
+    TEST_CHECK(bus.switches == (switches + 2U));
+    TEST_CHECK(bus.avoided == (avoided + 2U));
+    TEST_CHECK(Test_InMode(&mode3s) == 1U);
+
+    /* A failing job is reported, the others still run */
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode0) == ADT7320_OK);
+    Test_Jobs();
+    failId = 1U;
+    TEST_CHECK(ADT7320_BusMode_Run(&bus, jobs, TEST_JOBS) == ADT7320_ERROR);
+    TEST_CHECK( (ran == TEST_JOBS) && (jobs[1U].status == ADT7320_ERROR) && (jobs[3U].status == ADT7320_OK) );
+    failId = 0xFFU;
+
+    /* BUSY stops the batch: jobs of the modes not reached keep done == 0 */
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode0) == ADT7320_OK);
+    Test_Jobs();
+    grabId   = 2U;
+    switches = bus.switches;
+    TEST_CHECK(ADT7320_BusMode_Run(&bus, jobs, TEST_JOBS) == ADT7320_BUSY);
+    TEST_CHECK( (ran == 2U) && (jobs[0U].done == 1U) && (jobs[2U].done == 1U) );
+    TEST_CHECK( (jobs[1U].done == 0U) && (jobs[3U].done == 0U) && (jobs[4U].done == 0U) );
+    TEST_CHECK( (bus.switches == switches) && (Test_InMode(&mode0) == 1U) );
+    hspi.State = HAL_SPI_STATE_READY;
+    grabId     = 0xFFU;
+
+    /* A job without a mode or without work: rejected before anything runs */
+    Test_Jobs();
+    jobs[3U].pMode = NULL;
+    TEST_CHECK(ADT7320_BusMode_Run(&bus, jobs, TEST_JOBS) == ADT7320_ERROR);
+    TEST_CHECK(ran == 0U);
+    Test_Jobs();
+    jobs[4U].run = NULL;
+    TEST_CHECK(ADT7320_BusMode_Run(&bus, jobs, TEST_JOBS) == ADT7320_ERROR);
+    TEST_CHECK(ran == 0U);
+    TEST_CHECK(ADT7320_BusMode_Run(&bus, NULL, 1U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_BusMode_Run(&bus, NULL, 0U) == ADT7320_OK);
+
+    return TEST_RESULT();
+}
+
+
+/* test_busmode.c */
@@ -0,0 +1,305 @@
+/**
+ * @file    test_can.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   CAN packer against a host transmit fake and a late-joining receiver.
+ *
+ * @details
+ * After the functional checks, a drifting 16-sensor array is streamed for many sweeps
+ * in classic CAN and CAN-FD. The receiver must stay within the deadband of every sensor
+ * after every sweep; frames per sweep and bus bits are compared with one float per
+ * frame. Bus bits count an 11-bit identifier frame without stuffing (47 bits + data),
+ * so they compare the two schemes rather than give an exact bus load. A lossy run
+ * checks that dropped frames show up as sequence gaps and that the refresh repairs them.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>       /**< memset() */
+#include "test_common.h"  /**< Checks and fixtures */
+#include "adt7320_can.h"  /**< CAN packer interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SENSORS  (ADT7320_CAN_MAX_SENSORS)
+#define  TEST_UNKNOWN  ((int16_t)0x7FFF)
+#define  TEST_SWEEPS   (10000U)
+#define  TEST_DEADBAND (2U)
+#define  TEST_REFRESH  (50U)
+#define  TEST_LOSE     (37U)           /**< Every n-th frame is lost in the lossy run */
+#define  TEST_OVERHEAD (47U)           /**< Classic frame bits besides the data field */
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief Simulated bus between the packer and a receiver */
+typedef struct
+{
+    uint32_t frames;     /**< Frames put on the bus */
+    uint32_t lost;       /**< Frames dropped by the bus */
+    uint32_t gaps;       /**< Sequence gaps seen by the receiver */
+    uint8_t  lose;       /**< Non-zero to drop every TEST_LOSE-th frame */
+    uint8_t  started;    /**< Non-zero once the receiver saw a frame */
+    uint8_t  seq;        /**< Sequence counter of the last frame received */
+} Test_BusTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static ADT7320_CanTypeDef can;
+static int16_t  raw[TEST_SENSORS];
+static int16_t  rx[TEST_SENSORS];
+static uint32_t sent   = 0U;
+static uint32_t failAt = 0xFFFFFFFFU;
+static uint8_t  lastSeq = 0U;
+static uint32_t seed    = 87U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Transmit fake: delivers the frame to the receiver, or fails on request.
+ */
+static ADT7320_StatusTypeDef Test_Transmit(void *pContext, uint32_t id, const uint8_t *pData, uint8_t len)
+{
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    (void)pContext;
+    (void)id;
+
+    if (sent == failAt)
+    {
+        failAt = 0xFFFFFFFFU;
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        sent++;
+        TEST_CHECK(ADT7320_Can_Unpack(pData, len, rx, TEST_SENSORS, &lastSeq, NULL) == ADT7320_OK);
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Number of sensors the receiver knows the current value of.
+ */
+static uint32_t Test_Known(void)
+{
+    uint32_t known = 0U;
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        known += (rx[s] == raw[s]) ? 1U : 0U;
+    }
+
+    return known;
+}
+
+/**
+ * @brief  Simulated bus: the receiver unpacks every frame that is not lost.
+ */
+static ADT7320_StatusTypeDef Test_Bus(void *pContext, uint32_t id, const uint8_t *pData, uint8_t len)
+{
+    Test_BusTypeDef *pBus = (Test_BusTypeDef *)pContext;
+    uint8_t seq = 0U;
+
+    (void)id;
+
+    pBus->frames++;
+
+    if ( (pBus->lose != 0U) && ((pBus->frames % TEST_LOSE) == 0U) )
+    {
+        pBus->lost++;
+    }
+    else
+    {
+        TEST_CHECK(ADT7320_Can_Unpack(pData, len, rx, TEST_SENSORS, &seq, NULL) == ADT7320_OK);
+
+        if ( (pBus->started != 0U) && (seq != (uint8_t)(pBus->seq + 1U)) )
+        {
+            pBus->gaps++;
+        }
+        pBus->started = 1U;
+        pBus->seq     = seq;
+    }
+
+    return ADT7320_OK;
+}
+
+/**
+ * @brief  Next sweep of a slowly drifting array: +/- 3 LSB noise on a shared drift.
+ */
+static void Test_Drift(uint32_t sweep)
+{
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        raw[s] = (int16_t)((int32_t)(40 * 128) + (int32_t)(s * 16U) + (int32_t)((sweep / 8U) % 256U) +
+                           ((int32_t)((seed >> 16U) % 7U) - 3));
+    }
+}
+
+/**
+ * @brief  Largest difference between the receiver and the array, in LSB.
+ */
+static uint32_t Test_Error(void)
+{
+    uint32_t err = 0U;
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        int32_t  d = (int32_t)rx[s] - (int32_t)raw[s];
+        uint32_t a = (uint32_t)((d < 0) ? -d : d);
+
+        err = (a > err) ? a : err;
+    }
+
+    return err;
+}
+
+/**
+ * @brief  Streams TEST_SWEEPS drifting sweeps, checking the receiver after each one.
+ *
+ * @return Largest receiver error over the run, in LSB.
+ */
+static uint32_t Test_Stream(ADT7320_CanModeTypeDef mode, Test_BusTypeDef *pBus)
+{
+    uint32_t errMax = 0U;
+    uint32_t err    = 0U;
+
+    TEST_CHECK(ADT7320_Can_Init(&can, mode, 0x125U, (uint16_t)TEST_DEADBAND, (uint16_t)TEST_REFRESH, Test_Bus, pBus) == ADT7320_OK);
+
+    for (uint32_t i = 0U; i < TEST_SWEEPS; i++)
+    {
+        Test_Drift(i);
+        TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+        err    = Test_Error();
+        errMax = (err > errMax) ? err : errMax;
+    }
+
+    return errMax;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    Test_BusTypeDef bus;
+    uint32_t errClassic    = 0U;
+    uint32_t errFd         = 0U;
+    uint32_t framesClassic = 0U;
+    uint32_t bitsClassic   = 0U;
+    uint32_t entries       = 0U;
+    uint32_t framesFd      = 0U;
+    uint32_t bytesFd       = 0U;
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        raw[s] = (int16_t)(s * 100U);
+        rx[s]  = TEST_UNKNOWN;
+    }
+
+    /* Classic CAN, two entries per frame, full refresh every 3 sweeps */
+    TEST_CHECK(ADT7320_Can_Init(&can, ADT7320_CAN_CLASSIC, 0x123U, 2U, 3U, Test_Transmit, NULL) == ADT7320_OK);
+
+    /* Sweep 1 sends everything once */
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(sent == (TEST_SENSORS / 2U));
+    TEST_CHECK(Test_Known() == TEST_SENSORS);
+
+    /* Sweep 2: one change above the deadband, one within it */
+    raw[3U] += 10;
+    raw[4U] += 1;
+    sent = 0U;
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(sent == 1U);
+    TEST_CHECK(rx[3U] == raw[3U]);
+    TEST_CHECK(rx[4U] != raw[4U]);
+
+    /* Sweep 3 is a full refresh: a receiver joining now, and the transmit fails on the 3rd frame */
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        rx[s] = TEST_UNKNOWN;
+    }
+    sent   = 0U;
+    failAt = 2U;
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_ERROR);
+    TEST_CHECK(Test_Known() == 4U);
+
+    /* Sweep 4 repeats the whole refresh, so the late receiver converges */
+    sent = 0U;
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(sent == (TEST_SENSORS / 2U));
+    TEST_CHECK(Test_Known() == TEST_SENSORS);
+
+    /* The refresh period restarts after the completed refresh */
+    sent = 0U;
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(sent == 0U);
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(sent == (TEST_SENSORS / 2U));
+
+    /* CAN-FD: 21 entries per 64-byte frame */
+    TEST_CHECK(ADT7320_Can_Init(&can, ADT7320_CAN_FD, 0x124U, 0U, 0U, Test_Transmit, NULL) == ADT7320_OK);
+    sent = 0U;
+    TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(sent == 1U);
+    TEST_CHECK(can.bytes == 64U);
+    TEST_CHECK(lastSeq == 0U);
+
+    /* Drifting array, classic CAN: the receiver never strays past the deadband */
+    memset(&bus, 0, sizeof(bus));
+    errClassic    = Test_Stream(ADT7320_CAN_CLASSIC, &bus);
+    framesClassic = can.frames;
+    entries       = can.entries;
+    bitsClassic   = (can.frames * TEST_OVERHEAD) + (can.bytes * 8U);
+    TEST_CHECK(errClassic <= TEST_DEADBAND);
+    TEST_CHECK(bus.gaps == 0U);
+    TEST_CHECK(framesClassic < (TEST_SWEEPS * TEST_SENSORS));
+
+    /* Same stream over CAN-FD */
+    memset(&bus, 0, sizeof(bus));
+    errFd    = Test_Stream(ADT7320_CAN_FD, &bus);
+    framesFd = can.frames;
+    bytesFd  = can.bytes;
+    TEST_CHECK(errFd <= TEST_DEADBAND);
+    TEST_CHECK(framesFd <= (TEST_SWEEPS + (TEST_SWEEPS / TEST_REFRESH)));
+
+    /* Lossy bus: every loss is a sequence gap, and the next full refresh repairs it */
+    memset(&bus, 0, sizeof(bus));
+    bus.lose = 1U;
+    (void)Test_Stream(ADT7320_CAN_CLASSIC, &bus);
+    TEST_CHECK(bus.lost > 0U);
+    TEST_CHECK(bus.gaps == bus.lost);
+    bus.lose = 0U;
+    for (uint32_t i = 0U; i < TEST_REFRESH; i++)
+    {
+        Test_Drift(TEST_SWEEPS + i);
+        TEST_CHECK(ADT7320_Can_Pack(&can, raw, TEST_SENSORS) == ADT7320_OK);
+    }
+    TEST_CHECK(Test_Error() <= TEST_DEADBAND);
+
+    printf("can: %u sensors, deadband %u, refresh %u; classic %.2f frames/sweep (%.2f entries/frame), %.0f bits/sweep vs %u for one float per frame; "
+           "fd %.2f frames/sweep, %.1f bytes/sweep; %u lost frames, %u gaps seen [host]\n",
+           (unsigned)TEST_SENSORS, (unsigned)TEST_DEADBAND, (unsigned)TEST_REFRESH,
+           (double)framesClassic / (double)TEST_SWEEPS, (double)entries / (double)framesClassic,
+           (double)bitsClassic / (double)TEST_SWEEPS, (unsigned)(TEST_SENSORS * (TEST_OVERHEAD + 32U)),
+           (double)framesFd / (double)TEST_SWEEPS, (double)bytesFd / (double)TEST_SWEEPS,
+           (unsigned)bus.lost, (unsigned)bus.gaps);
+
+    return TEST_RESULT();
+}
+
+
+/* test_can.c */
@@ -0,0 +1,207 @@
+/**
+ * @file    test_cmdframe.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Command frames against a simulated sensor, blocking and through the async bus.
+ *
+ * @details
+ * The simulated ADT7320 decodes consecutive commands while CS stays low, as the part
+ * does, so a frame that reaches it in one CS cycle reads and writes the same register
+ * file as the separate transactions would.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_cmdframe.h"  /**< Command frame interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_DEADLINE_MS  (5U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_AsyncBusTypeDef bus;
+static ADT7320_CmdFrameTypeDef frame;
+static uint8_t iStatus;
+static uint8_t iTemp;
+static uint8_t iConfig;
+static uint8_t iWrite;
+static uint8_t iHigh;
+
+
+/* ------------------------------------ HAL Callbacks ------------------------------- */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Complete(&bus, h);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Error(&bus, h);
+}
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Checks the values read by the diagnostic frame.
+ */
+static void Test_Values(int16_t raw, uint16_t high)
+{
+    uint16_t value = 0U;
+
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iStatus, &value) == ADT7320_OK);
+    TEST_CHECK((value & ADT7320_STATUS_NRDY) == 0U);
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iTemp, &value) == ADT7320_OK);
+    TEST_CHECK(value == (uint16_t)raw);
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iConfig, &value) == ADT7320_OK);
+    TEST_CHECK(value == 0U);
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iHigh, &value) == ADT7320_OK);
+    TEST_CHECK(value == high);
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iWrite, &value) == ADT7320_ERROR);
+}
+
+/**
+ * @brief  Checks that CS is high, the bus free and no transfer pending.
+ */
+static void Test_Idle(int s)
+{
+    Fake_Sync();
+    TEST_CHECK(Fake_Sensor[s].selected == 0U);
+    TEST_CHECK(Fake_CsFalling == Fake_CsRising);
+    TEST_CHECK(Fake_SPI_Pending(&hspi) == 0U);
+    TEST_CHECK(frame.busy == 0U);
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_CmdFrameTypeDef full;
+    uint16_t value    = 0U;
+    uint32_t edges    = 0U;
+    uint32_t commands = 0U;
+    int      s        = Test_Setup(&sensor, &hspi, &spi, &port, 25 * 128);
+
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_Async_Init(&bus, &hspi, ADT7320_ASYNC_IT) == ADT7320_OK);
+
+    /* Status, temperature, configuration, THIGH write and read back: one CS cycle */
+    TEST_CHECK(ADT7320_CmdFrame_Init(&frame, &sensor) == ADT7320_OK);
+    TEST_CHECK(ADT7320_CmdFrame_AddRead(&frame, ADT7320_STATUS, 1U, &iStatus) == ADT7320_OK);
+    TEST_CHECK(ADT7320_CmdFrame_AddRead(&frame, ADT7320_TEMP, 2U, &iTemp) == ADT7320_OK);
+    TEST_CHECK(ADT7320_CmdFrame_AddRead(&frame, ADT7320_CONFIG, 1U, &iConfig) == ADT7320_OK);
+    TEST_CHECK(ADT7320_CmdFrame_AddWrite(&frame, ADT7320_THIGH, 2U, 60U * 128U, &iWrite) == ADT7320_OK);
+    TEST_CHECK(ADT7320_CmdFrame_AddRead(&frame, ADT7320_THIGH, 2U, &iHigh) == ADT7320_OK);
+    TEST_CHECK(frame.length == 13U);
+
+    /* Not run yet */
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iTemp, &value) == ADT7320_ERROR);
+
+    /* Blocking run */
+    TEST_CHECK(ADT7320_CmdFrame_Execute(&frame) == ADT7320_OK);
+    TEST_CHECK(Fake_CsFalling == 1U);
+    TEST_CHECK(Fake_Sensor[s].commands == 5U);
+    Test_Values(25 * 128, 60U * 128U);
+    Test_Idle(s);
+
+    /* Through the async bus: busy until the transfer completes */
+    Fake_SetTemp(s, 30 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_CmdFrame_Start(&frame, &bus, TEST_DEADLINE_MS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iTemp, &value) == ADT7320_BUSY);
+    TEST_CHECK(ADT7320_CmdFrame_Start(&frame, &bus, TEST_DEADLINE_MS) == ADT7320_BUSY);
+    Fake_SPI_Finish(&hspi);
+    Test_Values(30 * 128, 60U * 128U);
+    Test_Idle(s);
+    TEST_CHECK(bus.completed == 1U);
+
+    /* Stalled run: aborted at the deadline by the bus, CS released, reads refused */
+    TEST_CHECK(ADT7320_CmdFrame_Start(&frame, &bus, TEST_DEADLINE_MS) == ADT7320_OK);
+    Fake_AdvanceMs(TEST_DEADLINE_MS);
+    ADT7320_Async_Poll(&bus);
+    Test_Idle(s);
+    TEST_CHECK(frame.status == ADT7320_TIMEOUT);
+    TEST_CHECK(Fake_SpiAborts == 1U);
+    TEST_CHECK(ADT7320_CmdFrame_Get(&frame, iTemp, &value) == ADT7320_ERROR);
+
+    /* Cancelled run */
+    TEST_CHECK(ADT7320_CmdFrame_Start(&frame, &bus, 0U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Async_Cancel(&bus) == ADT7320_OK);
+    Test_Idle(s);
+    TEST_CHECK(frame.status == ADT7320_TIMEOUT);
+
+    /* SPI error */
+    TEST_CHECK(ADT7320_CmdFrame_Start(&frame, &bus, TEST_DEADLINE_MS) == ADT7320_OK);
+    Fake_SPI_Fail(&hspi);
+    Test_Idle(s);
+    TEST_CHECK(frame.status == ADT7320_ERROR);
+
+    /* Bus owned by another operation: refused without touching CS */
+    TEST_CHECK(ADT7320_Async_Read(&bus, &sensor, ADT7320_ID, 1U, TEST_DEADLINE_MS, NULL, NULL) == ADT7320_ERROR);
+    edges = Fake_CsFalling;
+    TEST_CHECK(ADT7320_Async_Transfer(&bus, &sensor, frame.tx, frame.rx, 1U, 0U, NULL, NULL) == ADT7320_ERROR);
+    {
+        ADT7320_CmdFrameTypeDef other;
+
+        TEST_CHECK(ADT7320_CmdFrame_Init(&other, &sensor) == ADT7320_OK);
+        TEST_CHECK(ADT7320_CmdFrame_AddRead(&other, ADT7320_ID, 1U, NULL) == ADT7320_OK);
+        TEST_CHECK(ADT7320_CmdFrame_Start(&other, &bus, 0U) == ADT7320_OK);
+        TEST_CHECK(ADT7320_CmdFrame_Start(&frame, &bus, TEST_DEADLINE_MS) == ADT7320_BUSY);
+        TEST_CHECK(frame.busy == 0U);
+        TEST_CHECK(Fake_CsFalling == (edges + 1U));
+        Fake_SPI_Finish(&hspi);
+        TEST_CHECK(ADT7320_CmdFrame_Get(&other, 0U, &value) == ADT7320_OK);
+        TEST_CHECK(value == 0xC3U);
+    }
+
+    /* SPI held by another driver: CS never asserted, blocking or not */
+    edges    = Fake_CsFalling;
+    commands = Fake_Sensor[s].commands;
+    hspi.State = HAL_SPI_STATE_BUSY_TX_RX;
+    TEST_CHECK(ADT7320_CmdFrame_Start(&frame, &bus, TEST_DEADLINE_MS) == ADT7320_BUSY);
+    TEST_CHECK(ADT7320_CmdFrame_Execute(&frame) == ADT7320_BUSY);
+    TEST_CHECK(bus.active == 0U);
+    hspi.State = HAL_SPI_STATE_READY;
+    Fake_Sync();
+    TEST_CHECK(Fake_CsFalling == edges);
+    TEST_CHECK(Fake_Sensor[s].commands == commands);
+
+    /* Capacity */
+    TEST_CHECK(ADT7320_CmdFrame_Init(&full, &sensor) == ADT7320_OK);
+
+    for (uint32_t i = 0U; i < ADT7320_CMDFRAME_MAX_COMMANDS; i++)
+    {
+        TEST_CHECK(ADT7320_CmdFrame_AddRead(&full, ADT7320_TEMP, 2U, NULL) == ADT7320_OK);
+    }
+
+    TEST_CHECK(ADT7320_CmdFrame_AddRead(&full, ADT7320_TEMP, 2U, NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_CmdFrame_Execute(&full) == ADT7320_OK);
+    TEST_CHECK(ADT7320_CmdFrame_Get(&full, (uint8_t)(ADT7320_CMDFRAME_MAX_COMMANDS - 1U), &value) == ADT7320_OK);
+    TEST_CHECK(value == (uint16_t)(30 * 128));
+
+    TEST_CHECK(Fake_Unselected == 0U);
+    TEST_CHECK(Fake_Contention == 0U);
+    TEST_CHECK(Fake_Sensor[s].modeErrors == 0U);
+
+    return TEST_RESULT();
+}
+
+
+/* test_cmdframe.c */
@@ -0,0 +1,291 @@
+/**
+ * @file    test_colstore.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Columnar store: program-once flash writes, corrupt headers, ingest and query benchmarks.
+ *
+ * @details
+ * The write function appends to a RAM image of erased flash and records every program
+ * unit it touches, as the flash of an STM32L4/G4/H7/U5 refuses a second program of the
+ * same word. The benchmarks report host time per sample, so they compare encodings and
+ * query plans rather than predict MCU timings.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>            /**< memset(), memcpy() */
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_colstore.h"  /**< Columnar store interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SENSORS    (4U)
+#define  TEST_SAMPLES    (50000U)             /**< Samples per sensor */
+#define  TEST_PERIOD_MS  (1000U)
+#define  TEST_FLASH      (512U * 1024U)
+#define  TEST_UNITS      (TEST_FLASH / ADT7320_COLSTORE_WRITE_ALIGN)
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief RAM image of a flash region */
+typedef struct
+{
+    uint8_t  data[TEST_FLASH];
+    uint8_t  programmed[TEST_UNITS];  /**< Non-zero once a program unit was written */
+    uint32_t used;
+    uint32_t calls;
+    uint32_t misaligned;              /**< Writes not covering whole program units */
+    uint32_t reprogrammed;            /**< Program units written twice */
+} Test_FlashTypeDef;
+
+/** @brief Visit statistics */
+typedef struct
+{
+    uint32_t visits;
+    uint32_t lastTick;
+    uint32_t unordered;
+} Test_VisitTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static Test_FlashTypeDef flash;
+static ADT7320_ColumnTypeDef cols[TEST_SENSORS];
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Programs bytes at the end of the flash image.
+ */
+static ADT7320_StatusTypeDef Test_Write(void *pContext, const uint8_t *pData, uint16_t len)
+{
+    Test_FlashTypeDef *pFlash = (Test_FlashTypeDef *)pContext;
+    ADT7320_StatusTypeDef status = ADT7320_OK;
+
+    if ((pFlash->used + len) > TEST_FLASH)
+    {
+        status = ADT7320_ERROR;
+    }
+    else
+    {
+        if ( ((pFlash->used % ADT7320_COLSTORE_WRITE_ALIGN) != 0U) || ((len % ADT7320_COLSTORE_WRITE_ALIGN) != 0U) )
+        {
+            pFlash->misaligned++;
+        }
+
+        for (uint32_t u = pFlash->used / ADT7320_COLSTORE_WRITE_ALIGN; u < ((pFlash->used + len + ADT7320_COLSTORE_WRITE_ALIGN - 1U) / ADT7320_COLSTORE_WRITE_ALIGN); u++)
+        {
+            if (pFlash->programmed[u] != 0U)
+            {
+                pFlash->reprogrammed++;
+            }
+            pFlash->programmed[u] = 1U;
+        }
+
+        memcpy(&pFlash->data[pFlash->used], pData, len);
+        pFlash->used += len;
+        pFlash->calls++;
+    }
+
+    return status;
+}
+
+/**
+ * @brief  Counts visited samples and checks they come in tick order.
+ */
+static void Test_Visit(void *pContext, uint32_t tick, int16_t raw)
+{
+    Test_VisitTypeDef *pVisit = (Test_VisitTypeDef *)pContext;
+
+    (void)raw;
+
+    if ( (pVisit->visits > 0U) && (tick < pVisit->lastTick) )
+    {
+        pVisit->unordered++;
+    }
+
+    pVisit->lastTick = tick;
+    pVisit->visits++;
+}
+
+/**
+ * @brief  Temperature of a sensor at a sample: slow drift plus a small deterministic ripple.
+ */
+static int16_t Test_Raw(uint32_t s, uint32_t i)
+{
+    return (int16_t)((int32_t)(25 * 128) + (int32_t)(s * 64U) + (int32_t)((i / 600U) % 32U) + (int32_t)((i * 7U) % 5U));
+}
+
+/**
+ * @brief  Runs a query on the flash image.
+ */
+static ADT7320_StatusTypeDef Test_Query(const uint8_t *pBase, uint32_t size, ADT7320_ColStoreQueryTypeDef *pQuery, Test_VisitTypeDef *pVisit)
+{
+    memset(pVisit, 0, sizeof(*pVisit));
+
+    return ADT7320_ColStore_Query(pBase, size, pQuery, Test_Visit, pVisit);
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_ColStoreQueryTypeDef q;
+    Test_VisitTypeDef visit;
+    uint8_t  bad[256U];
+    uint32_t first   = 0U;
+    double   start   = 0.0;
+    double   ingest  = 0.0;
+    double   scan    = 0.0;
+    double   narrow  = 0.0;
+    uint16_t read    = 0U;
+    uint16_t pruned  = 0U;
+
+    memset(flash.data, 0xFF, sizeof(flash.data));
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(ADT7320_ColStore_Init(&cols[s], (uint8_t)s, Test_Write, &flash) == ADT7320_OK);
+    }
+
+    /* Ingest: one sample per sensor per second, sealed every ADT7320_COLSTORE_SEGMENT_SAMPLES */
+    start = Test_Now();
+    for (uint32_t i = 0U; i < TEST_SAMPLES; i++)
+    {
+        for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+        {
+            TEST_CHECK(ADT7320_ColStore_Append(&cols[s], i * TEST_PERIOD_MS, Test_Raw(s, i)) == ADT7320_OK);
+        }
+    }
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(ADT7320_ColStore_Seal(&cols[s]) == ADT7320_OK);
+    }
+    ingest = (Test_Now() - start) / (double)(TEST_SAMPLES * TEST_SENSORS);
+
+    /* Every write starts and ends on a program unit, and no unit is programmed twice */
+    TEST_CHECK(flash.misaligned == 0U);
+    TEST_CHECK(flash.reprogrammed == 0U);
+    TEST_CHECK((flash.used % ADT7320_COLSTORE_WRITE_ALIGN) == 0U);
+    TEST_CHECK(flash.used < ((TEST_SAMPLES * TEST_SENSORS * 6U) / 2U));
+
+    /* Full scan of one sensor: every sample back, in order */
+    q.sensor   = 2U;
+    q.fromTick = 0U;
+    q.toTick   = UINT32_MAX;
+    q.rawMin   = INT16_MIN;
+    q.rawMax   = INT16_MAX;
+    start = Test_Now();
+    TEST_CHECK(Test_Query(flash.data, TEST_FLASH, &q, &visit) == ADT7320_OK);
+    scan = (Test_Now() - start) / (double)visit.visits;
+    TEST_CHECK(q.matched == TEST_SAMPLES);
+    TEST_CHECK(visit.visits == TEST_SAMPLES);
+    TEST_CHECK(visit.unordered == 0U);
+    TEST_CHECK(q.segmentsPruned == 0U);
+
+    /* One hour in the middle: footers prune all but the overlapping segments */
+    q.fromTick = 20000U * TEST_PERIOD_MS;
+    q.toTick   = q.fromTick + (3599U * TEST_PERIOD_MS);
+    start = Test_Now();
+    TEST_CHECK(Test_Query(flash.data, TEST_FLASH, &q, &visit) == ADT7320_OK);
+    narrow = Test_Now() - start;
+    read   = q.segmentsRead;
+    pruned = q.segmentsPruned;
+    TEST_CHECK(q.matched == 3600U);
+    TEST_CHECK(q.segmentsRead <= ((3600U / ADT7320_COLSTORE_SEGMENT_SAMPLES) + 2U));
+    TEST_CHECK((q.segmentsRead + q.segmentsPruned) == cols[2U].segments);
+
+    /* Value range outside the sensor's: nothing decoded */
+    q.fromTick = 0U;
+    q.toTick   = UINT32_MAX;
+    q.rawMin   = 100 * 128;
+    TEST_CHECK(Test_Query(flash.data, TEST_FLASH, &q, &visit) == ADT7320_OK);
+    TEST_CHECK(q.matched == 0U);
+    TEST_CHECK(q.segmentsRead == 0U);
+
+    /* Corrupt headers: refused before decoding past the segment */
+    first = flash.data[2U] | ((uint32_t)flash.data[3U] << 8U);
+    TEST_CHECK((first % ADT7320_COLSTORE_WRITE_ALIGN) == 0U);
+    TEST_CHECK(first <= sizeof(bad));
+    q.sensor = 0U;
+    q.rawMin = INT16_MIN;
+
+    memcpy(bad, flash.data, first);
+    TEST_CHECK(Test_Query(bad, first, &q, &visit) == ADT7320_OK);
+    TEST_CHECK(q.matched == ADT7320_COLSTORE_SEGMENT_SAMPLES);
+
+    bad[5U] = 33U;
+    TEST_CHECK(Test_Query(bad, first, &q, &visit) == ADT7320_ERROR);
+    TEST_CHECK(visit.visits == 0U);
+
+    memcpy(bad, flash.data, first);
+    bad[6U] = 17U;
+    TEST_CHECK(Test_Query(bad, first, &q, &visit) == ADT7320_ERROR);
+
+    memcpy(bad, flash.data, first);
+    bad[5U] = 32U;
+    bad[6U] = 16U;
+    TEST_CHECK(Test_Query(bad, first, &q, &visit) == ADT7320_ERROR);
+
+    memcpy(bad, flash.data, first);
+    bad[8U] = 0xFFU;
+    bad[9U] = 0x0FU;
+    TEST_CHECK(Test_Query(bad, first, &q, &visit) == ADT7320_ERROR);
+    TEST_CHECK(visit.visits == 0U);
+
+    /* Tick wrap inside an open segment: the segment is sealed and recording goes on */
+    {
+        ADT7320_ColumnTypeDef wrap;
+        uint32_t segments = 0U;
+
+        TEST_CHECK(ADT7320_ColStore_Init(&wrap, 9U, Test_Write, &flash) == ADT7320_OK);
+        for (uint32_t i = 0U; i < 10U; i++)
+        {
+            TEST_CHECK(ADT7320_ColStore_Append(&wrap, UINT32_MAX - ((9U - i) * TEST_PERIOD_MS), Test_Raw(0U, i)) == ADT7320_OK);
+        }
+        TEST_CHECK( (wrap.segments == 0U) && (wrap.count == 10U) );
+        TEST_CHECK(ADT7320_ColStore_Append(&wrap, 999U, Test_Raw(0U, 10U)) == ADT7320_OK);
+        TEST_CHECK( (wrap.segments == 1U) && (wrap.count == 1U) );
+        for (uint32_t i = 11U; i < (11U + (2U * ADT7320_COLSTORE_SEGMENT_SAMPLES)); i++)
+        {
+            TEST_CHECK(ADT7320_ColStore_Append(&wrap, 999U + ((i - 10U) * TEST_PERIOD_MS), Test_Raw(0U, i)) == ADT7320_OK);
+        }
+        segments = wrap.segments;
+        TEST_CHECK(segments == 3U);
+        TEST_CHECK(ADT7320_ColStore_Seal(&wrap) == ADT7320_OK);
+
+        q.sensor   = 9U;
+        q.fromTick = 0U;
+        q.toTick   = UINT32_MAX;
+        q.rawMin   = INT16_MIN;
+        q.rawMax   = INT16_MAX;
+        TEST_CHECK(Test_Query(flash.data, flash.used, &q, &visit) == ADT7320_OK);
+        TEST_CHECK(q.matched == (11U + (2U * ADT7320_COLSTORE_SEGMENT_SAMPLES)));
+        q.toTick = UINT32_MAX / 2U;
+        TEST_CHECK(Test_Query(flash.data, flash.used, &q, &visit) == ADT7320_OK);
+        TEST_CHECK( (q.matched == (1U + (2U * ADT7320_COLSTORE_SEGMENT_SAMPLES))) && (visit.unordered == 0U) );
+    }
+
+    printf("colstore: %u samples in %u bytes (%u.%02u bytes/sample, %u writes, %u-byte program unit)\n",
+           (unsigned)(TEST_SAMPLES * TEST_SENSORS), (unsigned)flash.used,
+           (unsigned)(flash.used / (TEST_SAMPLES * TEST_SENSORS)), (unsigned)(((flash.used % (TEST_SAMPLES * TEST_SENSORS)) * 100U) / (TEST_SAMPLES * TEST_SENSORS)),
+           (unsigned)flash.calls, (unsigned)ADT7320_COLSTORE_WRITE_ALIGN);
+    printf("colstore: ingest %.1f ns/sample, full scan %.1f ns/sample, 1 h query %.0f ns (%u segments read, %u pruned) [host]\n",
+           ingest, scan, narrow, (unsigned)read, (unsigned)pruned);
+
+    return TEST_RESULT();
+}
+
+
+/* test_colstore.c */
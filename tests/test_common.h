@@ -0,0 +1,88 @@
+/**
+ * @file    test_common.h
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Check macros and fixtures shared by the host tests.
+ *
+ * @details
+ * Each test is one executable run by ctest: TEST_CHECK() reports a failed condition
+ * and keeps going, TEST_RESULT() turns the failure count into the exit code.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <stdio.h>     /**< printf() */
+#include <time.h>      /**< clock_gettime() */
+#include "fake_hal.h"  /**< Fake HAL and simulated sensors */
+#include "adt7320.h"   /**< ADT7320 driver interface */
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Failed checks of the running test */
+static unsigned Test_Failures = 0U;
+
+/** @brief Reports a failed condition */
+#define  TEST_CHECK(cond)                                                   \
+    do                                                                      \
+    {                                                                       \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            Test_Failures++;                                                \
+        }                                                                   \
+    } while (0)
+
+/** @brief Exit code of the test */
+#define  TEST_RESULT()  ((Test_Failures == 0U) ? 0 : 1)
+
+
+/* -------------------------------- Inline Functions -------------------------------- */
+
+/**
+ * @brief  Monotonic host time, in ns, for the benchmarks.
+ */
+static inline double Test_Now(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief  Resets the fake and attaches one sensor on a fresh bus.
+ *
+ * @param[out] pConfig  Sensor configuration.
+ * @param[out] hspi     SPI handle of the bus.
+ * @param[out] spi      SPI registers of the bus.
+ * @param[out] port     CS port of the sensor.
+ * @param[in]  raw      Initial temperature code.
+ *
+ * @return Index of the simulated sensor.
+ */
+static inline int Test_Setup(ADT7320_ConfigTypeDef *pConfig, SPI_HandleTypeDef *hspi, SPI_TypeDef *spi, GPIO_TypeDef *port, int16_t raw)
+{
+    Fake_Reset();
+    Fake_SPI_Init(hspi, spi);
+    pConfig->SPIx   = hspi;
+    pConfig->csPort = port;
+    pConfig->csPin  = GPIO_PIN_0;
+
+    return Fake_AddSensor(hspi, port, GPIO_PIN_0, raw);
+}
+
+
+#endif  /* TEST_COMMON_H */
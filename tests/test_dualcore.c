@@ -0,0 +1,260 @@
+/**
+ * @file    test_dualcore.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Dual-core ring: layout, doorbells, and a two-thread CM4/CM7 simulation.
+ *
+ * @details
+ * Built with CORE_CM4 and CORE_CM7 both defined, so one executable holds both sides.
+ * The fake HSEM calls HAL_HSEM_FreeCallback() from the releasing thread, as the HSEM
+ * interrupt would preempt the CM7. In the simulation a producer thread (CM4) streams
+ * records while the main thread (CM7) pops them only after a doorbell, so a lost
+ * notification stalls the run and fails it instead of going unnoticed. Throughput is
+ * host time, not an H7 figure; on a single-core host the threads interleave by
+ * preemption rather than run in parallel.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <pthread.h>           /**< Producer thread */
+#include <sched.h>             /**< sched_yield() */
+#include <stddef.h>            /**< offsetof() */
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_dualcore.h"  /**< Dual-core transport interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SENSORS   (4U)
+#define  TEST_RECORDS   (2000000U)
+#define  TEST_BATCH     (32U)
+#define  TEST_STALL_NS  (2000000000.0)   /**< No progress for this long fails the run */
+
+/** @brief Cache line index of a ring member */
+#define  TEST_LINE(member)  (offsetof(ADT7320_DualCoreRingTypeDef, member) / 32U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port[TEST_SENSORS];
+static ADT7320_ConfigTypeDef sensors[TEST_SENSORS];
+static ADT7320_DualCoreRingTypeDef ring;
+static ADT7320_DualCoreRecordTypeDef out[ADT7320_DUALCORE_RING_SIZE];
+
+static volatile uint32_t producerDone = 0U;
+static uint32_t producerFull = 0U;       /**< Pushes refused because the ring was full */
+
+
+/* ------------------------------------ HAL Callbacks ------------------------------- */
+
+void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+    ADT7320_DualCore_FreeCallback(SemMask);
+}
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  CM4 releasing the semaphore between the CM7's load and clear of the flag.
+ */
+static void Test_Notify(void)
+{
+    HAL_HSEM_Release(ADT7320_DUALCORE_HSEM_ID, 0U);
+}
+
+/**
+ * @brief  CM4 side: streams TEST_RECORDS records, retrying while the ring is full.
+ */
+static void *Test_Producer(void *pArg)
+{
+    (void)pArg;
+
+    for (uint32_t i = 0U; i < TEST_RECORDS; i++)
+    {
+        while (ADT7320_DualCore_Push(&ring, (uint8_t)(i % TEST_SENSORS), (int16_t)i, ADT7320_OK) == ADT7320_BUSY)
+        {
+            producerFull++;
+            (void)sched_yield();
+        }
+    }
+
+    __atomic_store_n(&producerDone, 1U, __ATOMIC_SEQ_CST);
+
+    return NULL;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    pthread_t thread;
+    uint16_t  count      = 0U;
+    uint32_t  notes      = 0U;
+    uint32_t  received   = 0U;
+    uint32_t  batches    = 0U;
+    uint32_t  disordered = 0U;
+    uint32_t  corrupt    = 0U;
+    uint8_t   stalled    = 0U;
+    double    start      = 0.0;
+    double    progress   = 0.0;
+    double    elapsed    = 0.0;
+
+    Fake_Reset();
+    Fake_SPI_Init(&hspi, &spi);
+
+    /* Producer index, consumer index and records on separate cache lines */
+    TEST_CHECK((((uintptr_t)&ring) % 32U) == 0U);
+    TEST_CHECK(TEST_LINE(head) != TEST_LINE(tail));
+    TEST_CHECK(TEST_LINE(tail) != TEST_LINE(record));
+    TEST_CHECK((offsetof(ADT7320_DualCoreRingTypeDef, record) % 32U) == 0U);
+    TEST_CHECK(sizeof(ADT7320_DualCoreRecordTypeDef) == 12U);
+
+    /* Not initialized */
+    TEST_CHECK(ADT7320_DualCore_Push(&ring, 0U, 0, ADT7320_OK) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_DualCore_Pop(&ring, out, TEST_BATCH, &count) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_DualCore_Init(NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_DualCore_Init(&ring) == ADT7320_OK);
+    ADT7320_DualCore_EnableNotify();
+
+    /* Doorbell on the first record into an empty ring, then once per batch */
+    TEST_CHECK(ADT7320_DualCore_Push(&ring, 0U, 100, ADT7320_OK) == ADT7320_OK);
+    TEST_CHECK(Fake_HSEM_Notifications() == 1U);
+    TEST_CHECK(ADT7320_DualCore_Pending() == 1U);
+    TEST_CHECK(ADT7320_DualCore_Pending() == 0U);
+
+    for (uint32_t i = 1U; i < ADT7320_DUALCORE_BATCH; i++)
+    {
+        TEST_CHECK(ADT7320_DualCore_Push(&ring, 0U, (int16_t)(100U + i), ADT7320_OK) == ADT7320_OK);
+    }
+    TEST_CHECK(Fake_HSEM_Notifications() == 2U);
+
+    /* A doorbell between the load and the clear of the flag is not lost */
+    TEST_CHECK(ADT7320_DualCore_Pending() == 1U);
+    Fake_InterruptExclusive(Test_Notify);
+    TEST_CHECK(ADT7320_DualCore_Pending() == 1U);
+    TEST_CHECK(ADT7320_DualCore_Pending() == 0U);
+
+    /* Full ring: the record is dropped and counted */
+    for (uint32_t i = ADT7320_DUALCORE_BATCH; i < ADT7320_DUALCORE_RING_SIZE; i++)
+    {
+        TEST_CHECK(ADT7320_DualCore_Push(&ring, 0U, (int16_t)(100U + i), ADT7320_OK) == ADT7320_OK);
+    }
+    TEST_CHECK(ADT7320_DualCore_Push(&ring, 0U, 0, ADT7320_OK) == ADT7320_BUSY);
+    TEST_CHECK(ring.dropped == 1U);
+
+    /* Batches come out in order, across the wrap, with their lines invalidated */
+    notes = Fake_DCacheInvalidates;
+    TEST_CHECK(ADT7320_DualCore_Pop(&ring, out, 200U, &count) == ADT7320_OK);
+    TEST_CHECK(count == 200U);
+    TEST_CHECK(Fake_DCacheInvalidates > notes);
+    for (uint32_t i = 0U; i < 100U; i++)
+    {
+        TEST_CHECK(ADT7320_DualCore_Push(&ring, 1U, (int16_t)(356U + i), ADT7320_OK) == ADT7320_OK);
+    }
+    TEST_CHECK(ADT7320_DualCore_Pop(&ring, out, ADT7320_DUALCORE_RING_SIZE, &count) == ADT7320_OK);
+    TEST_CHECK(count == 156U);
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        TEST_CHECK(out[i].seq == (200U + i));
+        TEST_CHECK(out[i].raw == (int16_t)(300U + i));
+    }
+    TEST_CHECK(ADT7320_DualCore_Pop(&ring, out, TEST_BATCH, &count) == ADT7320_OK);
+    TEST_CHECK(count == 0U);
+
+    /* Acquisition: one record per sensor, read over SPI */
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        sensors[s].SPIx   = &hspi;
+        sensors[s].csPort = &port[s];
+        sensors[s].csPin  = GPIO_PIN_0;
+        (void)Fake_AddSensor(&hspi, &port[s], GPIO_PIN_0, (int16_t)((30U + s) * 128U));
+    }
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_DualCore_Acquire(&ring, sensors, (uint8_t)TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_DualCore_Pop(&ring, out, TEST_BATCH, &count) == ADT7320_OK);
+    TEST_CHECK(count == TEST_SENSORS);
+    for (uint32_t s = 0U; s < count; s++)
+    {
+        TEST_CHECK(out[s].sensor == s);
+        TEST_CHECK(out[s].status == (uint8_t)ADT7320_OK);
+        TEST_CHECK(out[s].raw == (int16_t)((30U + s) * 128U));
+    }
+
+    /* Two cores: CM4 streams, CM7 pops only on a doorbell */
+    TEST_CHECK(ADT7320_DualCore_Init(&ring) == ADT7320_OK);
+    (void)ADT7320_DualCore_Pending();
+    notes = Fake_HSEM_Notifications();
+    start = Test_Now();
+    progress = start;
+    TEST_CHECK(pthread_create(&thread, NULL, Test_Producer, NULL) == 0);
+
+    while ( (received < TEST_RECORDS) && (stalled == 0U) )
+    {
+        /* Once the producer stops, the tail of the stream gets no batch doorbell */
+        if ( (ADT7320_DualCore_Pending() != 0U) || (__atomic_load_n(&producerDone, __ATOMIC_SEQ_CST) != 0U) )
+        {
+            do
+            {
+                (void)ADT7320_DualCore_Pop(&ring, out, TEST_BATCH, &count);
+
+                for (uint32_t i = 0U; i < count; i++)
+                {
+                    if (out[i].seq != received)
+                    {
+                        disordered++;
+                    }
+                    if ( (out[i].raw != (int16_t)out[i].seq) || (out[i].sensor != (out[i].seq % TEST_SENSORS)) )
+                    {
+                        corrupt++;
+                    }
+                    received++;
+                }
+
+                if (count > 0U)
+                {
+                    batches++;
+                    progress = Test_Now();
+                }
+            } while (count > 0U);
+        }
+        else if ((Test_Now() - progress) > TEST_STALL_NS)
+        {
+            stalled = 1U;
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+
+    elapsed = Test_Now() - start;
+    TEST_CHECK(pthread_join(thread, NULL) == 0);
+    notes = Fake_HSEM_Notifications() - notes;
+
+    TEST_CHECK(stalled == 0U);
+    TEST_CHECK(received == TEST_RECORDS);
+    TEST_CHECK(disordered == 0U);
+    TEST_CHECK(corrupt == 0U);
+    TEST_CHECK(ring.dropped == producerFull);
+    TEST_CHECK(notes <= ((TEST_RECORDS / ADT7320_DUALCORE_BATCH) + batches));
+
+    printf("dualcore: %u records in %u batches (%.1f/batch), %u doorbells, %u full retries, %.1f Mrecords/s [host]\n",
+           (unsigned)received, (unsigned)batches, (batches > 0U) ? ((double)received / (double)batches) : 0.0,
+           (unsigned)notes, (unsigned)producerFull, ((double)received * 1e3) / elapsed);
+
+    return TEST_RESULT();
+}
+
+
+/* test_dualcore.c */
@@ -0,0 +1,167 @@
+/**
+ * @file    test_eventlog.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Event log: coalescing, held spans, overwrite and wrap, limit flags, faults.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>             /**< memcpy(), memcmp() */
+#include "test_common.h"        /**< Checks and fixtures */
+#include "adt7320_eventlog.h"   /**< Event log interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_WINDOW_MS  (1000U)
+#define  TEST_SIZE       (ADT7320_EVENTLOG_SIZE)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_EventLogTypeDef elog;
+static ADT7320_EventRecordTypeDef copy[TEST_SIZE];
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Newest record of the log.
+ */
+static const ADT7320_EventRecordTypeDef *Test_Newest(void)
+{
+    return &elog.record[(elog.head + TEST_SIZE - 1U) % TEST_SIZE];
+}
+
+/**
+ * @brief  Fills the log with @p n distinct records, one per sensor index, 2 windows apart.
+ */
+static void Test_Fill(uint32_t n, uint32_t tick)
+{
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        ADT7320_EventLog_Record(&elog, ADT7320_EVENT_FAULT, (uint8_t)i, tick + (i * 2U * TEST_WINDOW_MS));
+    }
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    const ADT7320_EventRecordTypeDef *pSpan = NULL;
+    uint16_t n = 0U;
+    int      s = Test_Setup(&sensor, &hspi, &spi, &port, 25 * 128);
+
+    TEST_CHECK(ADT7320_EventLog_Init(NULL, TEST_WINDOW_MS) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_EventLog_Init(&elog, TEST_WINDOW_MS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_GetSpan(&elog, &pSpan, &n) == ADT7320_OK);
+    TEST_CHECK(n == 0U);
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, 1U) == ADT7320_ERROR);
+
+    /* Coalescing: same type and sensor within the window fold, anything else is new */
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 0U, 100U);
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 0U, 600U);
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 0U, 1600U);
+    TEST_CHECK(elog.count == 1U);
+    TEST_CHECK( (Test_Newest()->count == 3U) && (Test_Newest()->first == 100U) && (Test_Newest()->last == 1600U) );
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 1U, 1700U);
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_CLEAR, 0U, 1800U);
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 1U, 2500U);
+    TEST_CHECK( (elog.count == 3U) && (elog.record[1U].count == 2U) );
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 0U, 3000U);
+    TEST_CHECK(elog.count == 4U);
+
+    /* A held span is not coalesced into: a repeat starts a new record */
+    TEST_CHECK(ADT7320_EventLog_GetSpan(&elog, &pSpan, &n) == ADT7320_OK);
+    TEST_CHECK( (n == 4U) && (pSpan == &elog.record[0U]) );
+    memcpy(copy, pSpan, n * sizeof(copy[0U]));
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 0U, 3200U);
+    TEST_CHECK(elog.count == 5U);
+    TEST_CHECK(memcmp(copy, pSpan, 4U * sizeof(copy[0U])) == 0);
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, 5U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, 4U) == ADT7320_OK);
+    TEST_CHECK( (elog.count == 1U) && (elog.held == 0U) );
+
+    /* Once released, the record coalesces again */
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_THIGH_SET, 0U, 3300U);
+    TEST_CHECK( (elog.count == 1U) && (Test_Newest()->count == 2U) );
+
+    /* Full ring with a span held: new events are dropped, the span is untouched */
+    TEST_CHECK(ADT7320_EventLog_GetSpan(&elog, &pSpan, &n) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, n) == ADT7320_OK);
+    Test_Fill(TEST_SIZE, 10000U);
+    TEST_CHECK( (elog.count == TEST_SIZE) && (elog.overwritten == 0U) );
+    TEST_CHECK(ADT7320_EventLog_GetSpan(&elog, &pSpan, &n) == ADT7320_OK);
+    TEST_CHECK(n == (TEST_SIZE - 5U));
+    memcpy(copy, pSpan, n * sizeof(copy[0U]));
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_RECOVERED, 2U, 900000U);
+    ADT7320_EventLog_Record(&elog, ADT7320_EVENT_RECOVERED, 3U, 900000U);
+    TEST_CHECK( (elog.dropped == 2U) && (elog.overwritten == 0U) && (elog.count == TEST_SIZE) );
+    TEST_CHECK(memcmp(copy, pSpan, n * sizeof(copy[0U])) == 0);
+
+    /* The span stops at the end of the ring; the rest comes from slot 0 */
+    TEST_CHECK(pSpan[0U].sensor == 0U);
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, n) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_GetSpan(&elog, &pSpan, &n) == ADT7320_OK);
+    TEST_CHECK( (n == 5U) && (pSpan == &elog.record[0U]) && (pSpan[0U].sensor == (TEST_SIZE - 5U)) );
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, n) == ADT7320_OK);
+    TEST_CHECK(elog.count == 0U);
+
+    /* Nothing held: the oldest record is overwritten and counted */
+    Test_Fill(TEST_SIZE + 3U, 2000000U);
+    TEST_CHECK( (elog.count == TEST_SIZE) && (elog.overwritten == 3U) && (elog.dropped == 2U) );
+    TEST_CHECK(ADT7320_EventLog_GetSpan(&elog, &pSpan, &n) == ADT7320_OK);
+    TEST_CHECK(pSpan[0U].sensor == 3U);
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, n) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_GetSpan(&elog, &pSpan, &n) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_Consume(&elog, n) == ADT7320_OK);
+    TEST_CHECK(elog.count == 0U);
+
+    /* Limit flags from the sensor: one record per transition */
+    TEST_CHECK(ADT7320_EventLog_Init(&elog, TEST_WINDOW_MS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, ADT7320_EVENTLOG_MAX_SENSORS) == ADT7320_ERROR);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, 0U) == ADT7320_OK);
+    TEST_CHECK(elog.count == 0U);
+    Fake_SetTemp(s, 70 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, 0U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, 0U) == ADT7320_OK);
+    TEST_CHECK( (elog.count == 1U) && (Test_Newest()->type == (uint8_t)ADT7320_EVENT_THIGH_SET) && (Test_Newest()->count == 1U) );
+    Fake_SetTemp(s, 25 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, 0U) == ADT7320_OK);
+    TEST_CHECK( (elog.count == 2U) && (Test_Newest()->type == (uint8_t)ADT7320_EVENT_THIGH_CLEAR) );
+
+    /* Fault while the bus fails, one recovery once it answers again */
+    Fake_SPI_FailNext(HAL_ERROR, 3U);
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        Fake_AdvanceMs(10U);
+        TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, 0U) == ADT7320_ERROR);
+    }
+    TEST_CHECK( (elog.count == 3U) && (Test_Newest()->type == (uint8_t)ADT7320_EVENT_FAULT) && (Test_Newest()->count == 3U) );
+    TEST_CHECK(elog.faulted[0U] != 0U);
+    TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, 0U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_EventLog_PollStatus(&elog, &sensor, 0U) == ADT7320_OK);
+    TEST_CHECK( (elog.count == 4U) && (Test_Newest()->type == (uint8_t)ADT7320_EVENT_RECOVERED) );
+    TEST_CHECK(elog.faulted[0U] == 0U);
+
+    return TEST_RESULT();
+}
+
+
+/* test_eventlog.c */
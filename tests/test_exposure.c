@@ -0,0 +1,175 @@
+/**
+ * @file    test_exposure.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Exposure: Arrhenius table and interpolation, degree-minutes, saturation, persistence, restore.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"        /**< Checks and fixtures */
+#include "adt7320_exposure.h"   /**< Exposure integrator interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_MIN_MS    (60000U)                  /**< One minute, in ms */
+#define  TEST_RAW(c)    ((int16_t)((c) * 128))    /**< Raw code of a whole °C */
+#define  TEST_ENTRY(c)  ((c) - ADT7320_EXPOSURE_LUT_MIN_C)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static uint32_t table[ADT7320_EXPOSURE_LUT_SIZE];
+static uint32_t steep[ADT7320_EXPOSURE_LUT_SIZE];
+static uint32_t falling[ADT7320_EXPOSURE_LUT_SIZE];
+static ADT7320_ExposureTypeDef expo;
+static ADT7320_ExposureStateTypeDef saved;
+static uint32_t saves = 0U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Persistence hook: keeps a copy of the accumulators.
+ */
+static void Test_Save(const ADT7320_ExposureStateTypeDef *pState)
+{
+    saved = *pState;
+    saves++;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_ExposureStateTypeDef state;
+    uint64_t ageing = 0U;
+    uint64_t above  = 0U;
+    uint64_t below  = 0U;
+    uint32_t prev   = 0U;
+    uint32_t af     = 0U;
+    uint32_t tick   = 0U;
+
+    /* Table: 1.0 at the reference, rising with temperature, saturated at 32 bits */
+    TEST_CHECK(ADT7320_Exposure_BuildTable(NULL, 700U, 25) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Exposure_BuildTable(table, 700U, -273) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Exposure_BuildTable(table, 700U, 25) == ADT7320_OK);
+    TEST_CHECK(table[TEST_ENTRY(25)] == 65536U);
+
+    for (uint32_t i = 1U; i < ADT7320_EXPOSURE_LUT_SIZE; i++)
+    {
+        TEST_CHECK(table[i] > table[i - 1U]);
+    }
+
+    TEST_CHECK(ADT7320_Exposure_BuildTable(steep, 2000U, ADT7320_EXPOSURE_LUT_MIN_C) == ADT7320_OK);
+    TEST_CHECK(steep[ADT7320_EXPOSURE_LUT_SIZE - 1U] == 0xFFFFFFFFUL);
+
+    /* Factor: clamped outside the table, linear on the 7 fractional bits inside */
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, NULL, 0, 0, NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, table, TEST_RAW(8), TEST_RAW(2), NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, table, TEST_RAW(2), TEST_RAW(8), NULL) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Exposure_Factor(&expo, INT16_MIN) == table[0U]);
+    TEST_CHECK(ADT7320_Exposure_Factor(&expo, TEST_RAW(ADT7320_EXPOSURE_LUT_MAX_C)) == table[ADT7320_EXPOSURE_LUT_SIZE - 1U]);
+    TEST_CHECK(ADT7320_Exposure_Factor(&expo, INT16_MAX) == table[ADT7320_EXPOSURE_LUT_SIZE - 1U]);
+    TEST_CHECK(ADT7320_Exposure_Factor(&expo, TEST_RAW(25)) == 65536U);
+    af = ADT7320_Exposure_Factor(&expo, (int16_t)(TEST_RAW(25) + 64));
+    TEST_CHECK(af == (65536U + ((table[TEST_ENTRY(26)] - 65536U) / 2U)));
+
+    /* A falling table interpolates downwards instead of wrapping */
+    for (uint32_t i = 0U; i < ADT7320_EXPOSURE_LUT_SIZE; i++)
+    {
+        falling[i] = 0xFFFFFFFFUL - (i * 1000000UL);
+    }
+
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, falling, 0, 0, NULL) == ADT7320_OK);
+    prev = falling[TEST_ENTRY(25)];
+
+    for (int16_t frac = 1; frac < 128; frac++)
+    {
+        af = ADT7320_Exposure_Factor(&expo, (int16_t)(TEST_RAW(25) + frac));
+        TEST_CHECK( (af <= prev) && (af > falling[TEST_ENTRY(26)]) );
+        prev = af;
+    }
+
+    /* Degree-minutes: each sample is held until the next one, nothing inside the band */
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, table, TEST_RAW(2), TEST_RAW(8), NULL) == ADT7320_OK);
+    ADT7320_Exposure_Add(&expo, 1000U, TEST_RAW(11));
+    TEST_CHECK(expo.state.totalMs == 0U);
+    ADT7320_Exposure_Add(&expo, 1000U + (2U * TEST_MIN_MS), TEST_RAW(5));
+    ADT7320_Exposure_Add(&expo, 1000U + (7U * TEST_MIN_MS), TEST_RAW(-2));
+    ADT7320_Exposure_Add(&expo, 1000U + (10U * TEST_MIN_MS), (int16_t)(TEST_RAW(2) - 64));
+    ADT7320_Exposure_Add(&expo, 1000U + (14U * TEST_MIN_MS), TEST_RAW(25));
+    TEST_CHECK(ADT7320_Exposure_Get(&expo, NULL, &above, &below) == ADT7320_OK);
+    TEST_CHECK(above == (3U * 2U));
+    TEST_CHECK(below == ((4U * 3U) + 2U));
+    TEST_CHECK(expo.state.aboveRawMs == ((uint64_t)TEST_RAW(3) * 2U * TEST_MIN_MS));
+    TEST_CHECK(expo.state.totalMs == (14U * TEST_MIN_MS));
+
+    /* Ageing: an hour at the reference temperature is an hour of ageing */
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, table, TEST_RAW(2), TEST_RAW(8), NULL) == ADT7320_OK);
+    ADT7320_Exposure_Add(&expo, 0U, TEST_RAW(25));
+    ADT7320_Exposure_Add(&expo, 60U * TEST_MIN_MS, TEST_RAW(25));
+    TEST_CHECK(ADT7320_Exposure_Get(&expo, &ageing, NULL, NULL) == ADT7320_OK);
+    TEST_CHECK(ageing == 60U);
+    TEST_CHECK(ADT7320_Exposure_Get(NULL, &ageing, NULL, NULL) == ADT7320_ERROR);
+
+    /* Saturation: accumulators stick at the maximum instead of wrapping */
+    state.version    = ADT7320_EXPOSURE_VERSION;
+    state.ageing     = UINT64_MAX - 1U;
+    state.aboveRawMs = UINT64_MAX - 1U;
+    state.belowRawMs = 0U;
+    state.totalMs    = UINT64_MAX - 1U;
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, steep, TEST_RAW(2), TEST_RAW(8), &state) == ADT7320_OK);
+    ADT7320_Exposure_Add(&expo, 0U, TEST_RAW(ADT7320_EXPOSURE_LUT_MAX_C));
+    ADT7320_Exposure_Add(&expo, 0xFFFFFFFFUL, TEST_RAW(ADT7320_EXPOSURE_LUT_MAX_C));
+    ADT7320_Exposure_Add(&expo, 0xFFFFFFFEUL, TEST_RAW(ADT7320_EXPOSURE_LUT_MAX_C));
+    TEST_CHECK( (expo.state.ageing == UINT64_MAX) && (expo.state.aboveRawMs == UINT64_MAX) );
+    TEST_CHECK( (expo.state.totalMs == UINT64_MAX) && (expo.state.belowRawMs == 0U) );
+
+    /* Persistence hook: a save every 1000 integrated ms, none without a callback */
+    TEST_CHECK(ADT7320_Exposure_SetPersist(NULL, 1000U, Test_Save) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, table, TEST_RAW(2), TEST_RAW(8), NULL) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Exposure_SetPersist(&expo, 1000U, NULL) == ADT7320_OK);
+    ADT7320_Exposure_Add(&expo, 0U, TEST_RAW(40));
+    ADT7320_Exposure_Add(&expo, 5000U, TEST_RAW(40));
+    TEST_CHECK(saves == 0U);
+    TEST_CHECK(ADT7320_Exposure_SetPersist(&expo, 1000U, Test_Save) == ADT7320_OK);
+
+    for (tick = 5300U; tick <= (5000U + (10U * 300U)); tick += 300U)
+    {
+        ADT7320_Exposure_Add(&expo, tick, TEST_RAW(40));
+    }
+
+    TEST_CHECK(saves == 2U);
+    TEST_CHECK(saved.totalMs == (5000U + (8U * 300U)));
+    TEST_CHECK( (saved.version == ADT7320_EXPOSURE_VERSION) && (saved.aboveRawMs == ((uint64_t)TEST_RAW(32) * saved.totalMs)) );
+
+    /* Restore: resumes from the saved block, a block of another version is refused */
+    state         = saved;
+    state.version = ADT7320_EXPOSURE_VERSION + 1U;
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, table, TEST_RAW(2), TEST_RAW(8), &state) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Exposure_Init(&expo, table, TEST_RAW(2), TEST_RAW(8), &saved) == ADT7320_OK);
+    TEST_CHECK( (expo.state.ageing == saved.ageing) && (expo.state.totalMs == saved.totalMs) );
+
+    /* The first sample after a restore only primes, the gap is not integrated */
+    ADT7320_Exposure_Add(&expo, 900000U, TEST_RAW(40));
+    TEST_CHECK(expo.state.totalMs == saved.totalMs);
+    ADT7320_Exposure_Add(&expo, 900000U + TEST_MIN_MS, TEST_RAW(40));
+    TEST_CHECK(expo.state.totalMs == (saved.totalMs + TEST_MIN_MS));
+    TEST_CHECK(expo.state.aboveRawMs == (saved.aboveRawMs + ((uint64_t)TEST_RAW(32) * TEST_MIN_MS)));
+    TEST_CHECK(expo.state.ageing == (saved.ageing + ((uint64_t)table[TEST_ENTRY(40)] * TEST_MIN_MS)));
+
+    return TEST_RESULT();
+}
+
+
+/* test_exposure.c */
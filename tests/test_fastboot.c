@@ -0,0 +1,84 @@
+/**
+ * @file    test_fastboot.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Fast boot against a simulated sensor, and the shared DWT helper.
+ *
+ * @details
+ * The fake DWT only counts once TRCENA and CYCCNTENA are set, so a module that reads
+ * DWT->CYCCNT without ADT7320_DWT_Enable() spins forever in its post-reset wait.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_fastboot.h"  /**< Fast boot interface */
+#include "adt7320_metrics.h"   /**< DWT helpers */
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+
+static const ADT7320_FastBootStepTypeDef boot[] =
+{
+    ADT7320_FASTBOOT_WRITE16(ADT7320_THIGH, 0x2800U),
+    ADT7320_FASTBOOT_WRITE8(ADT7320_CONFIG, ADT7320_FASTBOOT_16BIT_ONE_SHOT),
+};
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_FastBootReportTypeDef report = {0U};
+    int16_t  raw   = 0;
+    uint32_t first = 0U;
+    int      s     = Test_Setup(&sensor, &hspi, &spi, &port, 31 * 128);
+
+    /* Counter stopped until the helper runs */
+    first = DWT->CYCCNT;
+    Fake_AdvanceUs(10U);
+    TEST_CHECK(DWT->CYCCNT == first);
+    ADT7320_DWT_Enable();
+    first = DWT->CYCCNT;
+    Fake_AdvanceUs(10U);
+    TEST_CHECK((DWT->CYCCNT - first) >= (10U * (FAKE_CORE_HZ / 1000000U)));
+
+    /* Fresh core: fast boot must start the counter itself */
+    Test_Setup(&sensor, &hspi, &spi, &port, 31 * 128);
+    TEST_CHECK(ADT7320_FastBoot_Run(&sensor, boot, 2U, 300U, &raw, &report) == ADT7320_OK);
+    TEST_CHECK(raw == 31 * 128);
+    TEST_CHECK(report.resetUs >= ADT7320_FASTBOOT_RESET_US);
+    TEST_CHECK(report.resetUs < (ADT7320_FASTBOOT_RESET_US + 50U));
+    TEST_CHECK(report.conversionUs >= FAKE_CONVERSION_US);
+    TEST_CHECK(report.totalUs < (FAKE_CONVERSION_US + 2000U));
+    TEST_CHECK(report.polls > 1U);
+    TEST_CHECK(Fake_Sensor[s].conversions == 1U);
+
+    printf("fast boot: reset %u us, script %u us, conversion %u us, total %u us, %u polls\n",
+           (unsigned)report.resetUs, (unsigned)report.scriptUs, (unsigned)report.conversionUs, (unsigned)report.totalUs, (unsigned)report.polls);
+
+    /* One-shot never ends in shutdown: RDY timeout */
+    Test_Setup(&sensor, &hspi, &spi, &port, 31 * 128);
+    {
+        static const ADT7320_FastBootStepTypeDef off[] = { ADT7320_FASTBOOT_WRITE8(ADT7320_CONFIG, 0xE0U) };
+
+        TEST_CHECK(ADT7320_FastBoot_Run(&sensor, off, 1U, 5U, &raw, &report) == ADT7320_TIMEOUT);
+    }
+
+    return TEST_RESULT();
+}
+
+
+/* test_fastboot.c */
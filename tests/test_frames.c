@@ -0,0 +1,188 @@
+/**
+ * @file    test_frames.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Sweep frames: held frames, BUSY and drops, sweeps, notification, counter wrap.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_frames.h"    /**< Sweep frames interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SENSORS  (2U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port[TEST_SENSORS];
+static ADT7320_ConfigTypeDef sensors[TEST_SENSORS];
+static ADT7320_FramesTypeDef frames;
+static const ADT7320_FrameTypeDef *pNotified = NULL;
+static uint32_t notified = 0U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Publish notification: records the frame.
+ */
+static void Test_Notify(const ADT7320_FrameTypeDef *pFrame)
+{
+    pNotified = pFrame;
+    notified++;
+}
+
+/**
+ * @brief  Fills the next free frame with @p seq and publishes it.
+ */
+static ADT7320_StatusTypeDef Test_Produce(uint32_t seq)
+{
+    ADT7320_FrameTypeDef *pFrame = NULL;
+    ADT7320_StatusTypeDef status = ADT7320_Frames_Begin(&frames, &pFrame);
+
+    if (status == ADT7320_OK)
+    {
+        pFrame->count  = 1U;
+        pFrame->raw[0] = (int16_t)seq;
+        status = ADT7320_Frames_PublishSeq(&frames, seq);
+    }
+
+    return status;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    const ADT7320_FrameTypeDef *pHeld = NULL;
+    const ADT7320_FrameTypeDef *pPrev = NULL;
+    ADT7320_FrameTypeDef *pFill = NULL;
+    uint32_t seq = 0U;
+
+    Fake_Reset();
+    Fake_SPI_Init(&hspi, &spi);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        sensors[s].SPIx   = &hspi;
+        sensors[s].csPort = &port[s];
+        sensors[s].csPin  = GPIO_PIN_0;
+        (void)Fake_AddSensor(&hspi, &port[s], GPIO_PIN_0, (int16_t)((20 + (int32_t)s) * 128));
+    }
+
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+
+    TEST_CHECK(ADT7320_Frames_Init(NULL, NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Frames_Init(&frames, Test_Notify) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_BUSY);
+    TEST_CHECK(pHeld == NULL);
+    TEST_CHECK(ADT7320_Frames_Release(&frames) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Frames_Sweep(&frames, sensors, ADT7320_FRAMES_MAX_SENSORS + 1U) == ADT7320_ERROR);
+
+    /* A sweep reads every sensor into the frame and notifies the consumer */
+    TEST_CHECK(ADT7320_Frames_Sweep(&frames, sensors, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(notified == 1U);
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_OK);
+    TEST_CHECK( (pHeld == pNotified) && (pHeld->seq == 0U) && (pHeld->count == TEST_SENSORS) );
+    TEST_CHECK( (pHeld->status[0U] == (uint8_t)ADT7320_OK) && (pHeld->raw[0U] == (20 * 128)) );
+    TEST_CHECK( (pHeld->status[1U] == (uint8_t)ADT7320_OK) && (pHeld->raw[1U] == (21 * 128)) );
+    TEST_CHECK(ADT7320_Frames_Release(&frames) == ADT7320_OK);
+
+    /* A failed read is reported in the frame, the sweep is still published */
+    Fake_SPI_FailNext(HAL_ERROR, 1U);
+    TEST_CHECK(ADT7320_Frames_Sweep(&frames, sensors, TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_OK);
+    TEST_CHECK( (pHeld->status[0U] == (uint8_t)ADT7320_ERROR) && (pHeld->status[1U] == (uint8_t)ADT7320_OK) );
+    TEST_CHECK(ADT7320_Frames_Release(&frames) == ADT7320_OK);
+
+    /* Publishing with no frame free is refused */
+    TEST_CHECK(ADT7320_Frames_Init(&frames, NULL) == ADT7320_OK);
+
+    for (uint32_t i = 0U; i < ADT7320_FRAMES_DEPTH; i++)
+    {
+        TEST_CHECK(Test_Produce(100U + i) == ADT7320_OK);
+    }
+
+    TEST_CHECK(ADT7320_Frames_Publish(&frames) == ADT7320_ERROR);
+
+    /* A held frame is never handed back to the producer: every frame busy, sweeps dropped */
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_OK);
+    TEST_CHECK( (pHeld->seq == 100U) && (pHeld->raw[0U] == 100) );
+    TEST_CHECK(ADT7320_Frames_Begin(&frames, &pFill) == ADT7320_BUSY);
+    TEST_CHECK(pFill == NULL);
+    TEST_CHECK(ADT7320_Frames_Sweep(&frames, sensors, TEST_SENSORS) == ADT7320_BUSY);
+    TEST_CHECK(frames.dropped == 2U);
+    TEST_CHECK( (pHeld->seq == 100U) && (pHeld->raw[0U] == 100) );
+
+    /* Once released, the oldest frame is the one reused; frames come out in order */
+    TEST_CHECK(ADT7320_Frames_Release(&frames) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Frames_Begin(&frames, &pFill) == ADT7320_OK);
+    TEST_CHECK(pFill == pHeld);
+    TEST_CHECK(Test_Produce(200U) == ADT7320_OK);
+
+    for (uint32_t i = 1U; i < ADT7320_FRAMES_DEPTH; i++)
+    {
+        TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_OK);
+        TEST_CHECK(pHeld->seq == (100U + i));
+        TEST_CHECK(ADT7320_Frames_Release(&frames) == ADT7320_OK);
+    }
+
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_OK);
+    TEST_CHECK(pHeld->seq == 200U);
+    TEST_CHECK(ADT7320_Frames_Release(&frames) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_BUSY);
+
+    /* Counter wrap: every frame taken is the successor of the previous one, across the wrap too */
+    TEST_CHECK(ADT7320_Frames_Init(&frames, NULL) == ADT7320_OK);
+    frames.head = 0U - (2U * ADT7320_FRAMES_DEPTH);
+    frames.tail = frames.head;
+    pPrev = NULL;
+
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        seq = frames.head;
+
+        for (uint32_t j = 0U; j < ADT7320_FRAMES_DEPTH; j++)
+        {
+            TEST_CHECK(Test_Produce(seq + j) == ADT7320_OK);
+        }
+
+        TEST_CHECK(ADT7320_Frames_Begin(&frames, &pFill) == ADT7320_BUSY);
+
+        for (uint32_t j = 0U; j < ADT7320_FRAMES_DEPTH; j++)
+        {
+            TEST_CHECK(ADT7320_Frames_Take(&frames, &pHeld) == ADT7320_OK);
+            TEST_CHECK( (pHeld->seq == (seq + j)) && (pHeld->raw[0U] == (int16_t)(seq + j)) );
+
+            if (pPrev != NULL)
+            {
+                TEST_CHECK(pHeld == &frames.frame[((uint32_t)(pPrev - frames.frame) + 1U) % ADT7320_FRAMES_DEPTH]);
+            }
+
+            pPrev = pHeld;
+            TEST_CHECK(ADT7320_Frames_Release(&frames) == ADT7320_OK);
+        }
+    }
+
+    TEST_CHECK( (frames.head == (2U * ADT7320_FRAMES_DEPTH)) && (frames.tail == frames.head) );
+    TEST_CHECK(frames.dropped == 4U);
+
+    return TEST_RESULT();
+}
+
+
+/* test_frames.c */
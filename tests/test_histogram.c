@@ -0,0 +1,88 @@
+/**
+ * @file    test_histogram.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   P² quantile accuracy against exact quantiles, beyond 2^16 samples.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"        /**< Checks and fixtures */
+#include "adt7320_histogram.h"  /**< Histogram and quantile interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SAMPLES  (200000UL)
+#define  TEST_RANGE    (4096U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static uint32_t seed = 12345U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Uniform pseudo-random raw code in [0, TEST_RANGE).
+ */
+static int16_t Test_Random(void)
+{
+    seed = (seed * 1664525U) + 1013904223U;
+
+    return (int16_t)((seed >> 8U) % TEST_RANGE);
+}
+
+/**
+ * @brief  Tracks one quantile of a uniform stream and checks it against the exact value.
+ */
+static void Test_Quantile(uint16_t permille)
+{
+    ADT7320_QuantileTypeDef q;
+    int16_t  estimate = 0;
+    int32_t  exact    = (int32_t)(((uint32_t)permille * TEST_RANGE) / 1000U);
+    int32_t  error    = 0;
+
+    TEST_CHECK(ADT7320_Quantile_Init(&q, permille) == ADT7320_OK);
+
+    for (uint32_t i = 0U; i < TEST_SAMPLES; i++)
+    {
+        ADT7320_Quantile_Add(&q, Test_Random());
+    }
+
+    TEST_CHECK(ADT7320_Quantile_Get(&q, &estimate) == ADT7320_OK);
+    error = (int32_t)estimate - exact;
+
+    /* Within 1 % of the range */
+    TEST_CHECK( (error < (int32_t)(TEST_RANGE / 100U)) && (error > -(int32_t)(TEST_RANGE / 100U)) );
+
+    /* The desired position of the last marker follows the sample count exactly */
+    TEST_CHECK(q.np[4U] == ((uint64_t)TEST_SAMPLES * 65536U));
+    TEST_CHECK(q.n[4U] == (int32_t)TEST_SAMPLES);
+
+    printf("p%u.%u: estimate %d, exact %d\n", (unsigned)(permille / 10U), (unsigned)(permille % 10U), (int)estimate, (int)exact);
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    Test_Quantile(500U);
+    Test_Quantile(950U);
+    Test_Quantile(990U);
+    Test_Quantile(50U);
+
+    return TEST_RESULT();
+}
+
+
+/* test_histogram.c */
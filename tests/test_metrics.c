@@ -0,0 +1,258 @@
+/**
+ * @file    test_metrics.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Metrics registry: exact dump text, shell commands, module recording hooks.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>            /**< memcpy(), strcmp() */
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_metrics.h"   /**< Metric registry */
+#include "adt7320_async.h"     /**< Asynchronous bus interface */
+#include "adt7320_busmode.h"   /**< Bus mode switching interface */
+#include "adt7320_frames.h"    /**< Sweep frames interface */
+#include "adt7320_sync.h"      /**< Synchronized sampling interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_OUT_SIZE  (4096U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_AsyncBusTypeDef async;
+static ADT7320_BusTypeDef bus;
+static ADT7320_FramesTypeDef frames;
+static ADT7320_SyncTypeDef sync;
+static const ADT7320_BusModeTypeDef mode0 = { SPI_POLARITY_LOW, SPI_PHASE_1EDGE, SPI_BAUDRATEPRESCALER_2 };
+static const ADT7320_BusModeTypeDef mode3 = ADT7320_BUSMODE_ADT7320(SPI_BAUDRATEPRESCALER_8);
+static char     out[TEST_OUT_SIZE];
+static uint32_t outLen = 0U;
+static uint32_t writes = 0U;
+
+/** @brief Dump of the values set by Test_Values() */
+static const char dump[] =
+    "# HELP adt7320_spi_transactions_total SPI transactions issued\n"
+    "# TYPE adt7320_spi_transactions_total counter\n"
+    "adt7320_spi_transactions_total 4294967295\n"
+    "# HELP adt7320_spi_errors_total SPI transactions that failed\n"
+    "# TYPE adt7320_spi_errors_total counter\n"
+    "adt7320_spi_errors_total 1\n"
+    "# HELP adt7320_spi_busy_total SPI transactions rejected as busy\n"
+    "# TYPE adt7320_spi_busy_total counter\n"
+    "adt7320_spi_busy_total 2\n"
+    "# HELP adt7320_spi_timeouts_total SPI transactions that timed out\n"
+    "# TYPE adt7320_spi_timeouts_total counter\n"
+    "adt7320_spi_timeouts_total 3\n"
+    "# HELP adt7320_spi_latency_max_cycles Longest SPI transaction, in cycles\n"
+    "# TYPE adt7320_spi_latency_max_cycles gauge\n"
+    "adt7320_spi_latency_max_cycles 40\n"
+    "# HELP adt7320_async_timeouts_total Async operations aborted (deadline or cancel)\n"
+    "# TYPE adt7320_async_timeouts_total counter\n"
+    "adt7320_async_timeouts_total 500\n"
+    "# HELP adt7320_predictor_hits_total Reads answered by the predictor\n"
+    "# TYPE adt7320_predictor_hits_total counter\n"
+    "adt7320_predictor_hits_total 6000\n"
+    "# HELP adt7320_dualcore_depth_max Deepest dual-core ring fill, in records\n"
+    "# TYPE adt7320_dualcore_depth_max gauge\n"
+    "adt7320_dualcore_depth_max 70000\n"
+    "# HELP adt7320_eventlog_depth_max Deepest event log fill, in records\n"
+    "# TYPE adt7320_eventlog_depth_max gauge\n"
+    "adt7320_eventlog_depth_max 800000\n"
+    "# HELP adt7320_frames_depth_max Deepest sweep frame fill, in frames\n"
+    "# TYPE adt7320_frames_depth_max gauge\n"
+    "adt7320_frames_depth_max 9000000\n"
+    "# HELP adt7320_frames_dropped_total Sweeps dropped with every frame taken\n"
+    "# TYPE adt7320_frames_dropped_total counter\n"
+    "adt7320_frames_dropped_total 10\n"
+    "# HELP adt7320_sync_missed_total Sync pulses without a sweep of their own\n"
+    "# TYPE adt7320_sync_missed_total counter\n"
+    "adt7320_sync_missed_total 11\n"
+    "# HELP adt7320_sync_deferred_total Sync pulses deferred behind a transfer\n"
+    "# TYPE adt7320_sync_deferred_total counter\n"
+    "adt7320_sync_deferred_total 12\n"
+    "# HELP adt7320_busmode_switches_total SPI mode switches\n"
+    "# TYPE adt7320_busmode_switches_total counter\n"
+    "adt7320_busmode_switches_total 0\n";
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Shell output: appends to the capture buffer.
+ */
+static void Test_Write(void *pContext, const char *pText, uint16_t len)
+{
+    (void)pContext;
+
+    if ((outLen + len) < TEST_OUT_SIZE)
+    {
+        memcpy(&out[outLen], pText, len);
+        outLen += len;
+        out[outLen] = '\0';
+    }
+
+    writes++;
+}
+
+/**
+ * @brief  Async completion: nothing to record, the bus keeps its own counters.
+ */
+static void Test_Done(void *pContext, ADT7320_StatusTypeDef status, uint16_t data)
+{
+    (void)pContext;
+    (void)status;
+    (void)data;
+}
+
+/**
+ * @brief  Runs one shell line and checks its status and exact output.
+ */
+static void Test_Shell(const char *pLine, ADT7320_StatusTypeDef status, const char *pExpect)
+{
+    outLen = 0U;
+    out[0] = '\0';
+
+    TEST_CHECK(ADT7320_Metrics_Shell(pLine, Test_Write, NULL) == status);
+    TEST_CHECK(strcmp(out, pExpect) == 0);
+}
+
+/**
+ * @brief  Sets every metric to a distinct value, with 32-bit extremes at both ends.
+ */
+static void Test_Values(void)
+{
+    static const uint32_t value[ADT7320_METRIC_COUNT] = { 4294967295U, 1U, 2U, 3U, 40U, 500U, 6000U, 70000U,
+                                                          800000U, 9000000U, 10U, 11U, 12U, 0U };
+
+    for (uint32_t m = 0U; m < (uint32_t)ADT7320_METRIC_COUNT; m++)
+    {
+        ADT7320_Metrics_Value[m] = value[m];
+    }
+}
+
+/**
+ * @brief  Number of metrics that are not zero.
+ */
+static uint32_t Test_NonZero(void)
+{
+    uint32_t n = 0U;
+
+    for (uint32_t m = 0U; m < (uint32_t)ADT7320_METRIC_COUNT; m++)
+    {
+        n += (ADT7320_Metrics_Value[m] != 0U) ? 1U : 0U;
+    }
+
+    return n;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_FrameTypeDef *pFill = NULL;
+
+    (void)Test_Setup(&sensor, &hspi, &spi, &port, 25 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    ADT7320_Metrics_Init();
+    TEST_CHECK(Test_NonZero() == 0U);
+
+    /* Dump: HELP, TYPE and value lines for every metric, in registry order */
+    TEST_CHECK(ADT7320_Metrics_Dump(NULL, NULL) == ADT7320_ERROR);
+    Test_Values();
+    TEST_CHECK(ADT7320_Metrics_Dump(Test_Write, NULL) == ADT7320_OK);
+    TEST_CHECK(strcmp(out, dump) == 0);
+    TEST_CHECK(writes == (3U * (uint32_t)ADT7320_METRIC_COUNT));
+
+    /* Shell: metrics, with or without line ending, answers the same text */
+    TEST_CHECK(ADT7320_Metrics_Shell(NULL, Test_Write, NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Metrics_Shell("metrics", NULL, NULL) == ADT7320_ERROR);
+    Test_Shell("metrics", ADT7320_OK, dump);
+    Test_Shell("metrics \r\n", ADT7320_OK, dump);
+
+    /* reset <name>: clears only that metric; the name must be exported in full */
+    Test_Shell("reset adt7320_frames_dropped_total\r\n", ADT7320_OK, "OK\n");
+    TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_FRAMES_DROPPED] == 0U);
+    TEST_CHECK(Test_NonZero() == ((uint32_t)ADT7320_METRIC_COUNT - 2U));
+    Test_Shell("reset frames_dropped_total", ADT7320_ERROR, "ERR unknown metric\n");
+    Test_Shell("reset adt7320_spi_errors", ADT7320_ERROR, "ERR unknown metric\n");
+    Test_Shell("reset adt7320_spi_errors_total_x", ADT7320_ERROR, "ERR unknown metric\n");
+    TEST_CHECK(Test_NonZero() == ((uint32_t)ADT7320_METRIC_COUNT - 2U));
+
+    /* Unknown commands change nothing */
+    Test_Shell("", ADT7320_ERROR, "ERR unknown command\n");
+    Test_Shell("Metrics", ADT7320_ERROR, "ERR unknown command\n");
+    Test_Shell("metricsx", ADT7320_ERROR, "ERR unknown command\n");
+    Test_Shell("resetall", ADT7320_ERROR, "ERR unknown command\n");
+    Test_Shell("help", ADT7320_ERROR, "ERR unknown command\n");
+    TEST_CHECK(Test_NonZero() == ((uint32_t)ADT7320_METRIC_COUNT - 2U));
+
+    /* reset: clears every metric */
+    Test_Shell("reset\n", ADT7320_OK, "OK\n");
+    TEST_CHECK(Test_NonZero() == 0U);
+
+    /* Module hooks: each counter follows the module's own accounting */
+    TEST_CHECK(ADT7320_Async_Init(&async, &hspi, ADT7320_ASYNC_IT) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Async_Read(&async, &sensor, ADT7320_TEMP, 2U, 5U, Test_Done, NULL) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Async_Cancel(&async) == ADT7320_OK);
+    TEST_CHECK( (async.timeouts == 1U) && (ADT7320_Metrics_Value[ADT7320_METRIC_ASYNC_TIMEOUTS] == 1U) );
+
+    TEST_CHECK(ADT7320_BusMode_Init(&bus, &hspi) == ADT7320_OK);
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode0) == ADT7320_OK);
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode0) == ADT7320_OK);
+    TEST_CHECK(ADT7320_BusMode_Apply(&bus, &mode3) == ADT7320_OK);
+    TEST_CHECK( (bus.switches == 2U) && (ADT7320_Metrics_Value[ADT7320_METRIC_BUSMODE_SWITCHES] == 2U) );
+
+    TEST_CHECK(ADT7320_Frames_Init(&frames, NULL) == ADT7320_OK);
+
+    for (uint32_t i = 0U; i < ADT7320_FRAMES_DEPTH; i++)
+    {
+        TEST_CHECK(ADT7320_Frames_Begin(&frames, &pFill) == ADT7320_OK);
+        TEST_CHECK(ADT7320_Frames_Publish(&frames) == ADT7320_OK);
+    }
+
+    TEST_CHECK(ADT7320_Frames_Begin(&frames, &pFill) == ADT7320_BUSY);
+    TEST_CHECK( (frames.dropped == 1U) && (ADT7320_Metrics_Value[ADT7320_METRIC_FRAMES_DROPPED] == 1U) );
+    TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_FRAMES_DEPTH_MAX] == ADT7320_FRAMES_DEPTH);
+
+    /* Sync: a pulse while a sweep is pending is missed, one during a transfer deferred */
+    TEST_CHECK(ADT7320_Frames_Init(&frames, NULL) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Sync_Init(&sync, &frames, &sensor, 1U, 0x80U) == ADT7320_OK);
+    ADT7320_Sync_Trigger(&sync);
+    ADT7320_Sync_Trigger(&sync);
+    hspi.State = HAL_SPI_STATE_BUSY_TX_RX;
+    ADT7320_Sync_Trigger(&sync);
+    hspi.State = HAL_SPI_STATE_READY;
+    TEST_CHECK( (sync.missed == 1U) && (ADT7320_Metrics_Value[ADT7320_METRIC_SYNC_MISSED] == 1U) );
+    TEST_CHECK( (sync.deferrals == 1U) && (ADT7320_Metrics_Value[ADT7320_METRIC_SYNC_DEFERRED] == 1U) );
+
+    /* Two deferred pulses run as one trigger: one of them never gets its own sweep */
+    hspi.State = HAL_SPI_STATE_BUSY_TX_RX;
+    ADT7320_Sync_Trigger(&sync);
+    hspi.State = HAL_SPI_STATE_READY;
+    Fake_AdvanceMs(1U);
+    (void)ADT7320_Sync_Poll(&sync);
+    TEST_CHECK(sync.deferrals == 2U);
+    TEST_CHECK(ADT7320_Metrics_Value[ADT7320_METRIC_SYNC_DEFERRED] == sync.deferrals);
+    TEST_CHECK( (sync.missed > 1U) && (ADT7320_Metrics_Value[ADT7320_METRIC_SYNC_MISSED] == sync.missed) );
+
+    return TEST_RESULT();
+}
+
+
+/* test_metrics.c */
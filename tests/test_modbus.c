@@ -0,0 +1,426 @@
+/**
+ * @file    test_modbus.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Modbus RTU slave over a pseudo-terminal: register map, exceptions, response latency.
+ *
+ * @details
+ * The frame checks build requests with a bitwise CRC independent of the driver's table.
+ * Then a slave thread serves the pty's slave side as a board's main loop would: it
+ * reads the sensors while the line is idle, ends a frame after TEST_T35_MS of silence,
+ * and answers from the latest-value table. The main thread is the Modbus master. It
+ * checks every response and measures the time from request to complete response, and
+ * the slave times ADT7320_Modbus_Process() alone against the 3.5-character deadline.
+ * Host timings, with the pty standing in for the UART.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <fcntl.h>             /**< open(), O_RDWR */
+#include <poll.h>              /**< poll() */
+#include <pthread.h>           /**< Slave thread */
+#include <stdlib.h>            /**< posix_openpt(), grantpt(), unlockpt(), ptsname(), qsort() */
+#include <termios.h>           /**< cfmakeraw(), tcsetattr() */
+#include <unistd.h>            /**< read(), write(), close() */
+
+/* termios.h names output delay flags CR1/CR2, as the fake names its SPI registers */
+#undef  CR1
+#undef  CR2
+
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_modbus.h"    /**< Modbus slave interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_ADDRESS    (17U)
+#define  TEST_SENSORS    (ADT7320_MODBUS_MAX_SENSORS)
+#define  TEST_REQUESTS   (300U)
+#define  TEST_T35_MS     (2)        /**< 3.5 characters at 19200 baud, rounded up */
+#define  TEST_T35_NS     (1823000.0)
+#define  TEST_REPLY_MS   (1000)     /**< Master gives up on a response after this long */
+#define  TEST_SILENT_MS  (50)       /**< Wait that proves no response is sent */
+
+/** @brief Raw code of sensor @p s: distinct, fractional, some below zero */
+#define  TEST_RAW(s)     ((int16_t)((((int32_t)(s) - 4) * 1000) + ((int32_t)(s) * 7)))
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port[TEST_SENSORS];
+static ADT7320_ConfigTypeDef sensors[TEST_SENSORS];
+static ADT7320_ModbusTypeDef mb;
+static double latency[TEST_REQUESTS];
+
+static int slaveFd = -1;
+static volatile uint32_t stop = 0U;
+static uint32_t slaveFrames = 0U;      /**< Frames processed by the slave */
+static uint32_t slaveSamples = 0U;     /**< Sensor reads done while the line was idle */
+static uint32_t slaveSpi = 0U;         /**< SPI calls made while answering a frame */
+static double processMax = 0.0;        /**< Longest ADT7320_Modbus_Process(), in ns */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Reference CRC-16/MODBUS, bit by bit.
+ */
+static uint16_t Test_Crc(const uint8_t *pData, uint16_t len)
+{
+    uint16_t crc = 0xFFFFU;
+
+    for (uint16_t i = 0U; i < len; i++)
+    {
+        crc ^= pData[i];
+        for (uint32_t b = 0U; b < 8U; b++)
+        {
+            crc = ((crc & 1U) != 0U) ? (uint16_t)((crc >> 1U) ^ 0xA001U) : (uint16_t)(crc >> 1U);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief  Builds a read request; returns its length.
+ */
+static uint16_t Test_Request(uint8_t *pFrame, uint8_t address, uint8_t function, uint16_t start, uint16_t quantity)
+{
+    uint16_t crc = 0U;
+
+    pFrame[0U] = address;
+    pFrame[1U] = function;
+    pFrame[2U] = (uint8_t)(start >> 8U);
+    pFrame[3U] = (uint8_t)start;
+    pFrame[4U] = (uint8_t)(quantity >> 8U);
+    pFrame[5U] = (uint8_t)quantity;
+    crc = Test_Crc(pFrame, 6U);
+    pFrame[6U] = (uint8_t)crc;
+    pFrame[7U] = (uint8_t)(crc >> 8U);
+
+    return 8U;
+}
+
+/**
+ * @brief  Expected register of sensor @p s: raw code (0x04) or 0.01 °C (0x03).
+ */
+static uint16_t Test_Register(uint8_t function, uint32_t s)
+{
+    int32_t raw   = TEST_RAW(s);
+    int32_t centi = (raw * 100) + ((raw >= 0) ? 64 : -64);
+
+    return (function == 0x04U) ? (uint16_t)raw : (uint16_t)(int16_t)(centi / 128);
+}
+
+/**
+ * @brief  Checks a response against the expected registers; returns non-zero if it matches.
+ */
+static uint8_t Test_Match(const uint8_t *pResp, uint16_t len, uint8_t function, uint16_t start, uint16_t quantity)
+{
+    uint8_t ok = 1U;
+
+    if ( (len != (5U + (2U * quantity))) || (Test_Crc(pResp, len) != 0U) ||
+         (pResp[0U] != TEST_ADDRESS) || (pResp[1U] != function) || (pResp[2U] != (2U * quantity)) )
+    {
+        ok = 0U;
+    }
+    else
+    {
+        for (uint16_t r = 0U; r < quantity; r++)
+        {
+            uint16_t value = (uint16_t)(((uint16_t)pResp[3U + (2U * r)] << 8U) | pResp[4U + (2U * r)]);
+
+            if (value != Test_Register(function, (uint32_t)start + r))
+            {
+                ok = 0U;
+            }
+        }
+    }
+
+    return ok;
+}
+
+/**
+ * @brief  Sends one frame through the driver, as the UART handler would.
+ */
+static uint16_t Test_Process(const uint8_t *pReq, uint16_t len, uint8_t *pResp)
+{
+    uint16_t respLen = 0xFFFFU;
+
+    TEST_CHECK(ADT7320_Modbus_Process(&mb, pReq, len, pResp, &respLen) == ADT7320_OK);
+
+    return respLen;
+}
+
+/**
+ * @brief  Slave side: samples while idle, answers each frame after the line goes silent.
+ */
+static void *Test_Slave(void *pArg)
+{
+    uint8_t  rx[ADT7320_MODBUS_MAX_FRAME];
+    uint8_t  tx[ADT7320_MODBUS_MAX_FRAME];
+    struct pollfd pfd;
+    uint16_t rxLen  = 0U;
+    uint16_t txLen  = 0U;
+    uint32_t calls  = 0U;
+    ssize_t  n      = 0;
+    double   t0     = 0.0;
+
+    (void)pArg;
+    pfd.fd     = slaveFd;
+    pfd.events = POLLIN;
+
+    while (__atomic_load_n(&stop, __ATOMIC_SEQ_CST) == 0U)
+    {
+        if (poll(&pfd, 1U, (rxLen > 0U) ? TEST_T35_MS : 1) > 0)
+        {
+            n = read(slaveFd, &rx[rxLen], sizeof(rx) - rxLen);
+            rxLen = (uint16_t)(rxLen + ((n > 0) ? (uint16_t)n : 0U));
+        }
+        else if (rxLen > 0U)
+        {
+            /* 3.5 characters of silence: the frame is complete */
+            calls = Fake_SpiCalls;
+            t0    = Test_Now();
+            (void)ADT7320_Modbus_Process(&mb, rx, rxLen, tx, &txLen);
+            t0    = Test_Now() - t0;
+
+            processMax = (t0 > processMax) ? t0 : processMax;
+            slaveSpi  += Fake_SpiCalls - calls;
+            slaveFrames++;
+            rxLen = 0U;
+
+            if (txLen > 0U)
+            {
+                (void)write(slaveFd, tx, txLen);
+            }
+        }
+        else
+        {
+            /* Idle line: the application's sampling loop */
+            for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+            {
+                (void)ADT7320_Modbus_Read(&mb, &sensors[s], (uint8_t)s);
+            }
+            slaveSamples++;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief  Master side: sends a frame and collects @p expect bytes of response.
+ *
+ * @return Bytes received before the timeout.
+ */
+static uint16_t Test_Transact(int fd, const uint8_t *pReq, uint16_t len, uint8_t *pResp, uint16_t expect, int timeoutMs)
+{
+    struct pollfd pfd;
+    uint16_t got = 0U;
+    ssize_t  n   = 0;
+    uint8_t  end = 0U;
+
+    pfd.fd     = fd;
+    pfd.events = POLLIN;
+
+    TEST_CHECK(write(fd, pReq, len) == (ssize_t)len);
+
+    while ( (got < expect) && (end == 0U) )
+    {
+        if (poll(&pfd, 1U, timeoutMs) > 0)
+        {
+            n   = read(fd, &pResp[got], (size_t)(ADT7320_MODBUS_MAX_FRAME - got));
+            got = (uint16_t)(got + ((n > 0) ? (uint16_t)n : 0U));
+            end = (n <= 0) ? 1U : 0U;
+        }
+        else
+        {
+            end = 1U;
+        }
+    }
+
+    return got;
+}
+
+/**
+ * @brief  Ascending order of doubles.
+ */
+static int Test_Compare(const void *pA, const void *pB)
+{
+    double a = *(const double *)pA;
+    double b = *(const double *)pB;
+
+    return (a > b) - (a < b);
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    uint8_t   req[ADT7320_MODBUS_MAX_FRAME];
+    uint8_t   resp[ADT7320_MODBUS_MAX_FRAME];
+    struct termios tio;
+    pthread_t thread;
+    uint16_t  len      = 0U;
+    uint16_t  got      = 0U;
+    uint32_t  calls    = 0U;
+    uint32_t  answered = 0U;
+    uint32_t  wrong    = 0U;
+    int       masterFd = -1;
+    double    t0       = 0.0;
+
+    Fake_Reset();
+    Fake_SPI_Init(&hspi, &spi);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        sensors[s].SPIx   = &hspi;
+        sensors[s].csPort = &port[s];
+        sensors[s].csPin  = GPIO_PIN_0;
+        (void)Fake_AddSensor(&hspi, &port[s], GPIO_PIN_0, TEST_RAW(s));
+    }
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+
+    TEST_CHECK(ADT7320_Modbus_Init(&mb, 0U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Modbus_Init(&mb, 248U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Modbus_Init(&mb, TEST_ADDRESS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Modbus_Update(&mb, (uint8_t)TEST_SENSORS, 0) == ADT7320_ERROR);
+
+    /* Never updated: invalid */
+    len = Test_Request(req, TEST_ADDRESS, 0x04U, 0U, 1U);
+    TEST_CHECK(Test_Process(req, len, resp) == 7U);
+    TEST_CHECK( (resp[3U] == 0x80U) && (resp[4U] == 0x00U) );
+
+    /* Sampled: both tables, whole map, straight from RAM */
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(ADT7320_Modbus_Read(&mb, &sensors[s], (uint8_t)s) == ADT7320_OK);
+    }
+    calls = Fake_SpiCalls;
+    len = Test_Request(req, TEST_ADDRESS, 0x04U, 0U, (uint16_t)TEST_SENSORS);
+    got = Test_Process(req, len, resp);
+    TEST_CHECK(Test_Match(resp, got, 0x04U, 0U, (uint16_t)TEST_SENSORS) != 0U);
+    len = Test_Request(req, TEST_ADDRESS, 0x03U, 3U, 5U);
+    got = Test_Process(req, len, resp);
+    TEST_CHECK(Test_Match(resp, got, 0x03U, 3U, 5U) != 0U);
+    TEST_CHECK(Fake_SpiCalls == calls);
+
+    /* Failed read: invalid until the next good one */
+    Fake_SPI_FailNext(HAL_ERROR, 1U);
+    TEST_CHECK(ADT7320_Modbus_Read(&mb, &sensors[2U], 2U) == ADT7320_ERROR);
+    len = Test_Request(req, TEST_ADDRESS, 0x03U, 2U, 1U);
+    TEST_CHECK(Test_Process(req, len, resp) == 7U);
+    TEST_CHECK( (resp[3U] == 0x80U) && (resp[4U] == 0x00U) );
+    TEST_CHECK(ADT7320_Modbus_Read(&mb, &sensors[2U], 2U) == ADT7320_OK);
+
+    /* Exceptions: function, address range, quantity */
+    len = Test_Request(req, TEST_ADDRESS, 0x06U, 0U, 1U);
+    TEST_CHECK(Test_Process(req, len, resp) == 5U);
+    TEST_CHECK( (resp[1U] == 0x86U) && (resp[2U] == 0x01U) && (Test_Crc(resp, 5U) == 0U) );
+    len = Test_Request(req, TEST_ADDRESS, 0x04U, (uint16_t)(TEST_SENSORS - 1U), 2U);
+    TEST_CHECK(Test_Process(req, len, resp) == 5U);
+    TEST_CHECK( (resp[1U] == 0x84U) && (resp[2U] == 0x02U) );
+    len = Test_Request(req, TEST_ADDRESS, 0x03U, 0U, 0U);
+    TEST_CHECK(Test_Process(req, len, resp) == 5U);
+    TEST_CHECK( (resp[1U] == 0x83U) && (resp[2U] == 0x03U) );
+    TEST_CHECK(mb.exceptions == 3U);
+
+    /* Silent: other slave, broadcast, bad CRC, runt */
+    len = Test_Request(req, (uint8_t)(TEST_ADDRESS + 1U), 0x04U, 0U, 1U);
+    TEST_CHECK(Test_Process(req, len, resp) == 0U);
+    len = Test_Request(req, 0U, 0x04U, 0U, 1U);
+    TEST_CHECK(Test_Process(req, len, resp) == 0U);
+    len = Test_Request(req, TEST_ADDRESS, 0x04U, 0U, 1U);
+    req[7U] ^= 0x01U;
+    TEST_CHECK(Test_Process(req, len, resp) == 0U);
+    TEST_CHECK(mb.crcErrors == 1U);
+    TEST_CHECK(Test_Process(req, 3U, resp) == 0U);
+
+    /* Over a pseudo-terminal: the slave thread owns the sensors from here on */
+    masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+    TEST_CHECK(masterFd >= 0);
+
+    if ( (masterFd >= 0) && (grantpt(masterFd) == 0) && (unlockpt(masterFd) == 0) )
+    {
+        slaveFd = open(ptsname(masterFd), O_RDWR | O_NOCTTY);
+        TEST_CHECK(slaveFd >= 0);
+        TEST_CHECK(tcgetattr(slaveFd, &tio) == 0);
+        cfmakeraw(&tio);
+        (void)cfsetspeed(&tio, B19200);
+        TEST_CHECK(tcsetattr(slaveFd, TCSANOW, &tio) == 0);
+        TEST_CHECK(pthread_create(&thread, NULL, Test_Slave, NULL) == 0);
+
+        /* Mixed reads of both tables */
+        for (uint32_t i = 0U; i < TEST_REQUESTS; i++)
+        {
+            uint8_t  function = ((i % 2U) == 0U) ? 0x03U : 0x04U;
+            uint16_t start    = (uint16_t)(i % TEST_SENSORS);
+            uint16_t quantity = (uint16_t)(1U + ((i * 7U) % (TEST_SENSORS - start)));
+
+            len = Test_Request(req, TEST_ADDRESS, function, start, quantity);
+            t0  = Test_Now();
+            got = Test_Transact(masterFd, req, len, resp, (uint16_t)(5U + (2U * quantity)), TEST_REPLY_MS);
+            latency[answered] = Test_Now() - t0;
+
+            if (Test_Match(resp, got, function, start, quantity) != 0U)
+            {
+                answered++;
+            }
+            else
+            {
+                wrong++;
+            }
+        }
+
+        /* A frame with a bad CRC gets no answer, the next one does */
+        len = Test_Request(req, TEST_ADDRESS, 0x04U, 0U, 1U);
+        req[6U] ^= 0x10U;
+        TEST_CHECK(Test_Transact(masterFd, req, len, resp, 7U, TEST_SILENT_MS) == 0U);
+        len = Test_Request(req, TEST_ADDRESS, 0x04U, 0U, 1U);
+        got = Test_Transact(masterFd, req, len, resp, 7U, TEST_REPLY_MS);
+        TEST_CHECK(Test_Match(resp, got, 0x04U, 0U, 1U) != 0U);
+
+        __atomic_store_n(&stop, 1U, __ATOMIC_SEQ_CST);
+        TEST_CHECK(pthread_join(thread, NULL) == 0);
+        (void)close(slaveFd);
+
+        TEST_CHECK(wrong == 0U);
+        TEST_CHECK(answered == TEST_REQUESTS);
+        TEST_CHECK(slaveFrames == (TEST_REQUESTS + 2U));
+        TEST_CHECK(slaveSamples > 0U);
+        TEST_CHECK(slaveSpi == 0U);
+        TEST_CHECK(processMax < TEST_T35_NS);
+        TEST_CHECK(mb.crcErrors == 2U);
+
+        if (answered > 0U)
+        {
+            qsort(latency, answered, sizeof(latency[0U]), Test_Compare);
+            printf("modbus: %u responses over a pty, request to response p50 %.0f us p99 %.0f us max %.0f us "
+                   "(%d ms silence included); process max %.1f us vs t3.5 %.0f us; %u idle sweeps [host]\n",
+                   (unsigned)answered, latency[answered / 2U] / 1e3, latency[(answered * 99U) / 100U] / 1e3,
+                   latency[answered - 1U] / 1e3, TEST_T35_MS, processMax / 1e3, TEST_T35_NS / 1e3,
+                   (unsigned)slaveSamples);
+        }
+    }
+
+    if (masterFd >= 0)
+    {
+        (void)close(masterFd);
+    }
+
+    return TEST_RESULT();
+}
+
+
+/* test_modbus.c */
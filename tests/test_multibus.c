@@ -0,0 +1,162 @@
+/**
+ * @file    test_multibus.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Multi-bus sweep on the host fake, across the 32-bit cycle counter wrap.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_multibus.h"  /**< Multi-bus sweep interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_BUSES    (2U)
+#define  TEST_PER_BUS  (3U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi[TEST_BUSES];
+static SPI_TypeDef spi[TEST_BUSES];
+static GPIO_TypeDef port[TEST_BUSES];
+static ADT7320_ConfigTypeDef sensors[TEST_BUSES][TEST_PER_BUS];
+static ADT7320_FramesTypeDef frames;
+static ADT7320_MultiBusTypeDef sweep;
+
+
+/* ------------------------------------ HAL Callbacks ------------------------------- */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_MultiBus_Complete(&sweep, h);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_MultiBus_Error(&sweep, h);
+}
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Runs one sweep to the end, finishing the transfers of every bus in turn.
+ */
+static void Test_Sweep(void)
+{
+    const ADT7320_FrameTypeDef *pFrame = NULL;
+
+    TEST_CHECK(ADT7320_MultiBus_Start(&sweep) == ADT7320_OK);
+
+    while (sweep.pending != 0U)
+    {
+        for (uint32_t b = 0U; b < TEST_BUSES; b++)
+        {
+            Fake_SPI_Finish(&hspi[b]);
+        }
+    }
+
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pFrame) == ADT7320_OK);
+
+    if (pFrame != NULL)
+    {
+        TEST_CHECK(pFrame->count == (TEST_BUSES * TEST_PER_BUS));
+
+        for (uint32_t i = 0U; i < pFrame->count; i++)
+        {
+            TEST_CHECK(pFrame->status[i] == ADT7320_OK);
+            TEST_CHECK(pFrame->raw[i] == (int16_t)(i * 128U));
+        }
+
+        ADT7320_Frames_Release(&frames);
+    }
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_MultiBusReportTypeDef report;
+    uint64_t period = 0U;
+
+    Fake_Reset();
+
+    for (uint32_t b = 0U; b < TEST_BUSES; b++)
+    {
+        Fake_SPI_Init(&hspi[b], &spi[b]);
+
+        for (uint32_t i = 0U; i < TEST_PER_BUS; i++)
+        {
+            sensors[b][i].SPIx   = &hspi[b];
+            sensors[b][i].csPort = &port[b];
+            sensors[b][i].csPin  = (uint16_t)(GPIO_PIN_0 << i);
+            (void)Fake_AddSensor(&hspi[b], &port[b], sensors[b][i].csPin, (int16_t)(((b * TEST_PER_BUS) + i) * 128U));
+        }
+    }
+
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+
+    TEST_CHECK(ADT7320_Frames_Init(&frames, NULL) == ADT7320_OK);
+    TEST_CHECK(ADT7320_MultiBus_Init(&sweep, &frames, 10U) == ADT7320_OK);
+
+    for (uint32_t b = 0U; b < TEST_BUSES; b++)
+    {
+        TEST_CHECK(ADT7320_MultiBus_AddBus(&sweep, &hspi[b], ADT7320_ASYNC_IT, sensors[b], TEST_PER_BUS) == ADT7320_OK);
+    }
+
+    /* Init starts the counter: the first sweep is timed in cycles */
+    Test_Sweep();
+    TEST_CHECK(sweep.lane[0U].busyTime > 0U);
+
+    /* Sweeps 100 ms apart, then one 100 s apart: beyond the 2^32-cycle counter period */
+    Fake_AdvanceMs(100U);
+    Test_Sweep();
+    Fake_AdvanceMs(100000U);
+    Test_Sweep();
+
+    TEST_CHECK(ADT7320_MultiBus_GetReport(&sweep, &report, 0U) == ADT7320_OK);
+    period = 100000ULL * (FAKE_CORE_HZ / 1000U);
+
+    TEST_CHECK(report.sweeps == 3U);
+    TEST_CHECK(report.periodMax >= period);
+    TEST_CHECK(report.periodMax < (period + (FAKE_CORE_HZ / 1000U)));
+    TEST_CHECK(report.periodMin >= (100ULL * (FAKE_CORE_HZ / 1000U)));
+    TEST_CHECK(report.periodMin < (101ULL * (FAKE_CORE_HZ / 1000U)));
+
+    for (uint32_t b = 0U; b < TEST_BUSES; b++)
+    {
+        /* A sweep costs microseconds of a 100 s window */
+        TEST_CHECK(report.utilisation[b] == 0U);
+    }
+
+    /* Back-to-back sweeps keep both buses busy most of the window */
+    TEST_CHECK(ADT7320_MultiBus_GetReport(&sweep, &report, 1U) == ADT7320_OK);
+
+    for (uint32_t n = 0U; n < 10U; n++)
+    {
+        Test_Sweep();
+    }
+
+    TEST_CHECK(ADT7320_MultiBus_GetReport(&sweep, &report, 0U) == ADT7320_OK);
+    TEST_CHECK(report.utilisation[0U] > 500U);
+    TEST_CHECK(report.utilisation[0U] <= 1000U);
+
+    printf("period %llu..%llu cycles, utilisation %u/%u per mille\n", (unsigned long long)report.periodMin,
+           (unsigned long long)report.periodMax, (unsigned)report.utilisation[0U], (unsigned)report.utilisation[1U]);
+
+    return TEST_RESULT();
+}
+
+
+/* test_multibus.c */
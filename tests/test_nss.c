@@ -0,0 +1,167 @@
+/**
+ * @file    test_nss.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Hardware NSS (csPort = NULL): no GPIO writes, SPI disabled after each transaction.
+ *
+ * @details
+ * Built for a series with ADT7320_HW_NSS. The fake selects a sensor without a CS port
+ * while its SPI is enabled, as the peripheral drives NSS, and enables the SPI on every
+ * transfer start, as the HAL does. Sensor sets that share a hardware NSS SPI are
+ * rejected by the multi-sensor modules.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"        /**< Checks and fixtures */
+#include "adt7320_prepared.h"   /**< Prepared transaction interface */
+#include "adt7320_async.h"      /**< Asynchronous bus interface */
+#include "adt7320_sync.h"       /**< Synchronized sampling interface */
+#include "adt7320_multibus.h"   /**< Multi-bus sweep interface */
+
+#if (ADT7320_HW_NSS != 1U)
+    #error "test_nss needs a series with hardware NSS"
+#endif
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_HandleTypeDef hspi2;
+static SPI_TypeDef spi;
+static SPI_TypeDef spi2;
+static GPIO_TypeDef port;
+static ADT7320_AsyncBusTypeDef bus;
+static ADT7320_FramesTypeDef frames;
+static ADT7320_SyncTypeDef sync;
+static ADT7320_MultiBusTypeDef mb;
+static uint32_t doneCalls = 0U;
+static uint16_t doneData  = 0U;
+
+
+/* ------------------------------------ HAL Callbacks ------------------------------- */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Complete(&bus, h);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Error(&bus, h);
+}
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Records the outcome of an asynchronous read.
+ */
+static void Test_Done(void *pContext, ADT7320_StatusTypeDef status, uint16_t data)
+{
+    (void)pContext;
+
+    doneCalls += (status == ADT7320_OK) ? 1U : 0U;
+    doneData   = data;
+}
+
+/**
+ * @brief  Non-zero once the SPI is disabled, i.e. NSS released.
+ */
+static uint8_t Test_Released(void)
+{
+    Fake_Sync();
+
+    return ((spi.CR1 & SPI_CR1_SPE) == 0U) ? 1U : 0U;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_ConfigTypeDef sensor = { &hspi, NULL, 0U };
+    ADT7320_ConfigTypeDef shared[2U] = { { &hspi, NULL, 0U }, { &hspi, &port, GPIO_PIN_0 } };
+    ADT7320_ConfigTypeDef twoNss[2U] = { { &hspi, NULL, 0U }, { &hspi, NULL, 0U } };
+    ADT7320_ConfigTypeDef apart[2U]  = { { &hspi, NULL, 0U }, { &hspi2, &port, GPIO_PIN_0 } };
+    ADT7320_PreparedTypeDef readTemp;
+    uint16_t value  = 0U;
+    uint32_t gpio   = 0U;
+    uint32_t cycles = 0U;
+
+    Fake_Reset();
+    Fake_SPI_Init(&hspi, &spi);
+    Fake_SPI_Init(&hspi2, &spi2);
+    (void)Fake_AddSensor(&hspi, NULL, 0U, 25 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    gpio = Fake_GpioWrites;
+
+    TEST_CHECK(ADT7320_IsValid(&sensor) != 0U);
+
+    /* Blocking read and write: NSS selects the sensor, disabling the SPI releases it */
+    TEST_CHECK(ADT7320_ReadRegister(&sensor, ADT7320_TEMP, 2U, &value) == ADT7320_OK);
+    TEST_CHECK(value == (uint16_t)(25 * 128));
+    TEST_CHECK(Test_Released() == 1U);
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_CONFIG, 1U, 0x80U) == ADT7320_OK);
+    TEST_CHECK(Test_Released() == 1U);
+    TEST_CHECK(ADT7320_ReadRegister(&sensor, ADT7320_CONFIG, 1U, &value) == ADT7320_OK);
+    TEST_CHECK(value == 0x80U);
+    TEST_CHECK(Test_Released() == 1U);
+    cycles += 3U;
+
+    /* Prepared transaction */
+    TEST_CHECK(ADT7320_Prepared_Read(&readTemp, &sensor, ADT7320_TEMP, 2U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Prepared_Execute(&readTemp, &value) == ADT7320_OK);
+    TEST_CHECK(value == (uint16_t)(25 * 128));
+    TEST_CHECK(Test_Released() == 1U);
+    cycles += 1U;
+
+    /* Asynchronous read: NSS held for the whole transfer, released at completion */
+    TEST_CHECK(ADT7320_Async_Init(&bus, &hspi, ADT7320_ASYNC_IT) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Async_Read(&bus, &sensor, ADT7320_TEMP, 2U, 0U, Test_Done, NULL) == ADT7320_OK);
+    Fake_Sync();
+    TEST_CHECK((spi.CR1 & SPI_CR1_SPE) != 0U);
+    Fake_SPI_Finish(&hspi);
+    TEST_CHECK( (doneCalls == 1U) && (doneData == (uint16_t)(25 * 128)) );
+    TEST_CHECK(Test_Released() == 1U);
+    cycles += 1U;
+
+    /* Not a single GPIO write, one NSS cycle per transaction, every transfer selected */
+    TEST_CHECK(Fake_GpioWrites == gpio);
+    TEST_CHECK(port.ODR == 0U);
+    TEST_CHECK( (Fake_CsFalling == cycles) && (Fake_CsRising == Fake_CsFalling) );
+    TEST_CHECK(Fake_Unselected == 0U);
+
+    /* A failed transfer still leaves the SPI disabled, even if the HAL had enabled it */
+    Fake_SPI_FailNext(HAL_ERROR, 1U);
+    spi.CR1 |= SPI_CR1_SPE;
+    TEST_CHECK(ADT7320_ReadRegister(&sensor, ADT7320_TEMP, 2U, &value) == ADT7320_ERROR);
+    TEST_CHECK(Test_Released() == 1U);
+    TEST_CHECK(Fake_GpioWrites == gpio);
+
+    /* A hardware NSS sensor must be alone on its SPI */
+    TEST_CHECK(ADT7320_IsNssExclusive(&sensor, 1U) != 0U);
+    TEST_CHECK(ADT7320_IsNssExclusive(shared, 2U) == 0U);
+    TEST_CHECK(ADT7320_IsNssExclusive(twoNss, 2U) == 0U);
+    TEST_CHECK(ADT7320_IsNssExclusive(apart, 2U) != 0U);
+
+    TEST_CHECK(ADT7320_Frames_Init(&frames, NULL) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Sync_Init(&sync, &frames, twoNss, 2U, 0U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Sync_Init(&sync, &frames, shared, 2U, 0U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_MultiBus_Init(&mb, &frames, 0U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_MultiBus_AddBus(&mb, &hspi, ADT7320_ASYNC_IT, twoNss, 2U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_MultiBus_AddBus(&mb, &hspi, ADT7320_ASYNC_IT, shared, 2U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_MultiBus_AddBus(&mb, &hspi, ADT7320_ASYNC_IT, &sensor, 1U) == ADT7320_OK);
+
+    return TEST_RESULT();
+}
+
+
+/* test_nss.c */
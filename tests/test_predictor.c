@@ -0,0 +1,161 @@
+/**
+ * @file    test_predictor.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Predictor: SPI reads avoided, threshold and minimum interval gating, slope, saturation.
+ *
+ * @details
+ * Queries every TEST_STEP_MS against a simulated sensor; every real read is an SPI
+ * transfer counted by the fake, so the reads the predictor avoids are measured on the
+ * bus rather than taken from its own counters.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"         /**< Checks and fixtures */
+#include "adt7320_predictor.h"   /**< Predictor interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_STEP_MS   (10U)
+#define  TEST_QUERIES   (480U)    /**< 4.8 s of queries */
+#define  TEST_RAMP_Q16  (6554)    /**< 0.1 LSB per ms, Q16 */
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_PredictorTypeDef pred;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Queries the predictor every TEST_STEP_MS and returns the SPI reads it issued.
+ */
+static uint32_t Test_Query(uint32_t queries)
+{
+    uint32_t calls = Fake_SpiCalls;
+    int16_t  raw   = 0;
+
+    for (uint32_t q = 0U; q < queries; q++)
+    {
+        Fake_AdvanceMs(TEST_STEP_MS);
+        TEST_CHECK(ADT7320_Predictor_Read(&pred, &raw) == ADT7320_OK);
+        TEST_CHECK(raw == (25 * 128));
+    }
+
+    return Fake_SpiCalls - calls;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    /* Uncertainty 2 + 40 LSB/s: above 20 LSB after 475 ms */
+    ADT7320_PredictorParamTypeDef param = { 128U, 26U, 2U, 40U, 20U, ADT7320_CONVERSION_MS };
+    ADT7320_PredictorParamTypeDef bad   = param;
+    uint32_t reads    = 0U;
+    uint32_t avoided  = 0U;
+    uint32_t total    = 0U;
+    uint16_t uncert   = 0U;
+    int16_t  raw      = 0;
+    int16_t  truth    = 0;
+
+    (void)Test_Setup(&sensor, &hspi, &spi, &port, 25 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+
+    bad.alpha = 257U;
+    TEST_CHECK(ADT7320_Predictor_Init(&pred, &sensor, &bad) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Predictor_Init(&pred, &sensor, &param) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Predictor_Estimate(&pred, 0U, &raw, NULL) == ADT7320_ERROR);
+
+    /* The first query always reads */
+    TEST_CHECK(Test_Query(1U) == 1U);
+    TEST_CHECK( (pred.reads == 1U) && (pred.avoided == 0U) );
+
+    /* Threshold gating: one read every 480 ms, every other query served from the estimate */
+    reads = Test_Query(TEST_QUERIES);
+    TEST_CHECK(reads == (TEST_QUERIES / 48U));
+    TEST_CHECK(pred.reads == (1U + reads));
+    TEST_CHECK(pred.avoided == (TEST_QUERIES - reads));
+    total   += TEST_QUERIES;
+    avoided += pred.avoided;
+
+    /* Minimum interval gating: with no threshold, reads are still spaced by minIntervalMs */
+    param.threshold = 0U;
+    TEST_CHECK(ADT7320_Predictor_Init(&pred, &sensor, &param) == ADT7320_OK);
+    TEST_CHECK(Test_Query(1U) == 1U);
+    reads = Test_Query(TEST_QUERIES);
+    TEST_CHECK(reads == (TEST_QUERIES / (ADT7320_CONVERSION_MS / TEST_STEP_MS)));
+    TEST_CHECK(pred.avoided == (TEST_QUERIES - reads));
+    total   += TEST_QUERIES;
+    avoided += pred.avoided;
+
+    /* The uncertainty grows linearly with the time since the last reading */
+    TEST_CHECK(ADT7320_Predictor_Estimate(&pred, pred.lastTick, &raw, &uncert) == ADT7320_OK);
+    TEST_CHECK(uncert == param.measNoise);
+    TEST_CHECK(ADT7320_Predictor_Estimate(&pred, pred.lastTick + 1000U, &raw, &uncert) == ADT7320_OK);
+    TEST_CHECK(uncert == (param.measNoise + param.growthPerSec));
+    TEST_CHECK(ADT7320_Predictor_Estimate(&pred, pred.lastTick + 0x7FFFFFFFU, &raw, &uncert) == ADT7320_OK);
+    TEST_CHECK(uncert == 0xFFFFU);
+
+    /* Slope convergence on a 0.1 LSB/ms ramp fed every conversion */
+    TEST_CHECK(ADT7320_Predictor_Init(&pred, NULL, &param) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Predictor_Read(&pred, &raw) == ADT7320_ERROR);
+
+    for (uint32_t t = 0U; t <= (100U * ADT7320_CONVERSION_MS); t += ADT7320_CONVERSION_MS)
+    {
+        TEST_CHECK(ADT7320_Predictor_Feed(&pred, (int16_t)(1000 + (int32_t)(t / 10U)), t) == ADT7320_OK);
+    }
+
+    TEST_CHECK( (pred.slope > (TEST_RAMP_Q16 - (TEST_RAMP_Q16 / 20))) && (pred.slope < (TEST_RAMP_Q16 + (TEST_RAMP_Q16 / 20))) );
+    truth = (int16_t)(1000 + (int32_t)(((100U * ADT7320_CONVERSION_MS) + 200U) / 10U));
+    TEST_CHECK(ADT7320_Predictor_Estimate(&pred, pred.lastTick + 200U, &raw, NULL) == ADT7320_OK);
+    TEST_CHECK( (raw >= (truth - 2)) && (raw <= (truth + 2)) );
+
+    /* Saturation: a steep rise extrapolated far ahead clamps instead of wrapping */
+    param.alpha = 256U;
+    param.beta  = 256U;
+    TEST_CHECK(ADT7320_Predictor_Init(&pred, NULL, &param) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Predictor_Feed(&pred, -32768, 0U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Predictor_Feed(&pred, 32767, 1U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Predictor_Feed(&pred, 32767, 2U) == ADT7320_OK);
+    TEST_CHECK(pred.slope > 0);
+
+    for (uint32_t dt = 1U; dt != 0U; dt <<= 2U)
+    {
+        TEST_CHECK(ADT7320_Predictor_Estimate(&pred, pred.lastTick + dt, &raw, NULL) == ADT7320_OK);
+        TEST_CHECK(raw == INT16_MAX);
+    }
+
+    TEST_CHECK(ADT7320_Predictor_Feed(&pred, -32768, 3U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Predictor_Feed(&pred, -32768, 4U) == ADT7320_OK);
+    TEST_CHECK(pred.slope < 0);
+
+    for (uint32_t dt = 1U; dt != 0U; dt <<= 2U)
+    {
+        TEST_CHECK(ADT7320_Predictor_Estimate(&pred, pred.lastTick + dt, &raw, NULL) == ADT7320_OK);
+        TEST_CHECK(raw == INT16_MIN);
+    }
+
+    printf("predictor: %u of %u queries served without an SPI read (%.1f %%) [host]\n",
+           (unsigned)avoided, (unsigned)total, (100.0 * (double)avoided) / (double)total);
+
+    return TEST_RESULT();
+}
+
+
+/* test_predictor.c */
@@ -0,0 +1,238 @@
+/**
+ * @file    test_prepared.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Prepared transactions: same wire traffic as the plain calls, and the setup saved.
+ *
+ * @details
+ * Every prepared read and write must put the same bytes on the wire as
+ * ADT7320_ReadRegister() / ADT7320_WriteRegister() and return the same value, blocking
+ * and on an asynchronous bus. The benchmark runs each path against the same fake, so the
+ * simulated bus time is identical and the difference in host time per call is the
+ * per-call setup the prepared form saves. It compares the two paths rather than predicts
+ * MCU cycles.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>             /**< memcpy(), memcmp() */
+#include "test_common.h"        /**< Checks and fixtures */
+#include "adt7320_prepared.h"   /**< Prepared transaction interface */
+#include "adt7320_async.h"      /**< Asynchronous bus interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_BENCH  (1000000U)
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief Outcome of an asynchronous operation */
+typedef struct
+{
+    uint32_t calls;
+    ADT7320_StatusTypeDef status;
+    uint16_t data;
+} Test_ResultTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_AsyncBusTypeDef bus;
+static Test_ResultTypeDef result;
+static uint8_t  wire[FAKE_STREAM_SIZE];  /**< Bytes of the last CS cycle */
+static uint16_t wireLen = 0U;
+
+
+/* ------------------------------------ HAL Callbacks ------------------------------- */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Complete(&bus, h);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h)
+{
+    ADT7320_Async_Error(&bus, h);
+}
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Records the bytes of each CS cycle.
+ */
+static void Test_Observe(const uint8_t *pTx, uint16_t len)
+{
+    memcpy(wire, pTx, len);
+    wireLen = len;
+}
+
+/**
+ * @brief  Records the outcome of an asynchronous operation.
+ */
+static void Test_Done(void *pContext, ADT7320_StatusTypeDef status, uint16_t data)
+{
+    Test_ResultTypeDef *pResult = (Test_ResultTypeDef *)pContext;
+
+    pResult->calls++;
+    pResult->status = status;
+    pResult->data   = data;
+}
+
+/**
+ * @brief  Checks that the last CS cycle carried the same bytes as @p pRef.
+ */
+static uint8_t Test_SameWire(const uint8_t *pRef, uint16_t refLen)
+{
+    Fake_Sync();
+
+    return ( (wireLen == refLen) && (memcmp(wire, pRef, refLen) == 0) ) ? 1U : 0U;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_ConfigTypeDef noBus = { NULL, &port, GPIO_PIN_0 };
+    ADT7320_PreparedTypeDef readTemp;
+    ADT7320_PreparedTypeDef readConfig;
+    ADT7320_PreparedTypeDef writeConfig;
+    uint8_t   ref[FAKE_STREAM_SIZE];
+    uint16_t  refLen   = 0U;
+    uint16_t  plain    = 0U;
+    uint16_t  prepared = 0U;
+    uint64_t  cycles   = 0U;
+    uint64_t  busPlain = 0U;
+    uint64_t  busPrep  = 0U;
+    int       s        = 0;
+    double    start    = 0.0;
+    double    nsPlain  = 0.0;
+    double    nsPrep   = 0.0;
+    double    nsAsync  = 0.0;
+    double    nsAsyncP = 0.0;
+
+    s = Test_Setup(&sensor, &hspi, &spi, &port, 25 * 128);
+    Fake_SetObserver(Test_Observe);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+
+    /* Parameters are checked once, at prepare time */
+    TEST_CHECK(ADT7320_Prepared_Read(NULL, &sensor, ADT7320_TEMP, 2U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Prepared_Read(&readTemp, &noBus, ADT7320_TEMP, 2U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Prepared_Read(&readTemp, &sensor, ADT7320_TEMP, 0U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Prepared_Read(&readTemp, &sensor, ADT7320_TEMP, 3U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Prepared_Write(&writeConfig, &sensor, ADT7320_CONFIG, 3U, 0U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Prepared_Execute(NULL, &prepared) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Prepared_Read(&readTemp, &sensor, ADT7320_TEMP, 2U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Prepared_Read(&readConfig, &sensor, ADT7320_CONFIG, 1U) == ADT7320_OK);
+
+    /* Blocking read: same bytes, same value */
+    TEST_CHECK(ADT7320_ReadRegister(&sensor, ADT7320_TEMP, 2U, &plain) == ADT7320_OK);
+    Fake_Sync();
+    memcpy(ref, wire, wireLen);
+    refLen = wireLen;
+    TEST_CHECK(ADT7320_Prepared_Execute(&readTemp, &prepared) == ADT7320_OK);
+    TEST_CHECK(Test_SameWire(ref, refLen) == 1U);
+    TEST_CHECK( (prepared == plain) && (prepared == (uint16_t)(25 * 128)) );
+
+    /* A prepared read follows the temperature, repeated executions need no re-prepare */
+    Fake_SetTemp(s, -10 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_Prepared_Execute(&readTemp, &prepared) == ADT7320_OK);
+    TEST_CHECK(ADT7320_ReadRegister(&sensor, ADT7320_TEMP, 2U, &plain) == ADT7320_OK);
+    TEST_CHECK( (prepared == plain) && ((int16_t)prepared == (-10 * 128)) );
+
+    /* Blocking write: same bytes as ADT7320_WriteRegister(), read back by both paths */
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_CONFIG, 1U, 0x80U) == ADT7320_OK);
+    Fake_Sync();
+    memcpy(ref, wire, wireLen);
+    refLen = wireLen;
+    TEST_CHECK(ADT7320_Prepared_Write(&writeConfig, &sensor, ADT7320_CONFIG, 1U, 0x80U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Prepared_Execute(&writeConfig, NULL) == ADT7320_OK);
+    TEST_CHECK(Test_SameWire(ref, refLen) == 1U);
+    TEST_CHECK(ADT7320_Prepared_Execute(&readConfig, &prepared) == ADT7320_OK);
+    TEST_CHECK(ADT7320_ReadRegister(&sensor, ADT7320_CONFIG, 1U, &plain) == ADT7320_OK);
+    TEST_CHECK( (prepared == plain) && (prepared == 0x80U) );
+
+    /* A failed transfer is reported and releases CS */
+    Fake_SPI_FailNext(HAL_ERROR, 1U);
+    TEST_CHECK(ADT7320_Prepared_Execute(&readTemp, &prepared) == ADT7320_ERROR);
+    Fake_Sync();
+    TEST_CHECK((port.ODR & GPIO_PIN_0) != 0U);
+
+    /* Asynchronous bus: same bytes and value as ADT7320_Async_Read() */
+    TEST_CHECK(ADT7320_Async_Init(&bus, &hspi, ADT7320_ASYNC_IT) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Async_Read(&bus, &sensor, ADT7320_TEMP, 2U, 0U, Test_Done, &result) == ADT7320_OK);
+    Fake_SPI_Finish(&hspi);
+    Fake_Sync();
+    memcpy(ref, wire, wireLen);
+    refLen = wireLen;
+    plain  = result.data;
+    TEST_CHECK( (result.calls == 1U) && (result.status == ADT7320_OK) );
+    TEST_CHECK(ADT7320_Async_Execute(&bus, &readTemp, 0U, Test_Done, &result) == ADT7320_OK);
+    Fake_SPI_Finish(&hspi);
+    TEST_CHECK(Test_SameWire(ref, refLen) == 1U);
+    TEST_CHECK( (result.calls == 2U) && (result.status == ADT7320_OK) && (result.data == plain) );
+
+    /* Benchmark: identical simulated bus time, host time per call for each path */
+    Fake_SetObserver(NULL);
+
+    cycles = Fake_Cycles;
+    start  = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        (void)ADT7320_ReadRegister(&sensor, ADT7320_TEMP, 2U, &plain);
+    }
+    nsPlain  = (Test_Now() - start) / (double)TEST_BENCH;
+    busPlain = (Fake_Cycles - cycles) / TEST_BENCH;
+
+    cycles = Fake_Cycles;
+    start  = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        (void)ADT7320_Prepared_Execute(&readTemp, &prepared);
+    }
+    nsPrep  = (Test_Now() - start) / (double)TEST_BENCH;
+    busPrep = (Fake_Cycles - cycles) / TEST_BENCH;
+    TEST_CHECK(busPrep == busPlain);
+
+    start = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        (void)ADT7320_Async_Read(&bus, &sensor, ADT7320_TEMP, 2U, 0U, Test_Done, &result);
+        Fake_SPI_Finish(&hspi);
+    }
+    nsAsync = (Test_Now() - start) / (double)TEST_BENCH;
+
+    start = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        (void)ADT7320_Async_Execute(&bus, &readTemp, 0U, Test_Done, &result);
+        Fake_SPI_Finish(&hspi);
+    }
+    nsAsyncP = (Test_Now() - start) / (double)TEST_BENCH;
+    TEST_CHECK(result.calls == (2U + (2U * TEST_BENCH)));
+    TEST_CHECK(result.data == plain);
+
+    printf("prepared: blocking read %.1f ns plain vs %.1f ns prepared, async %.1f ns vs %.1f ns per call, fake included; "
+           "%u bus cycles per read on both paths [host]\n",
+           nsPlain, nsPrep, nsAsync, nsAsyncP, (unsigned)busPlain);
+
+    return TEST_RESULT();
+}
+
+
+/* test_prepared.c */
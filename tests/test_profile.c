@@ -0,0 +1,344 @@
+/**
+ * @file    test_profile.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Scaling simulation: N sensors on M SPI buses, blocking and asynchronous sweeps.
+ *
+ * @details
+ * Discrete-event simulation on the fake HAL. Sweeps are requested at a target rate;
+ * a sweep that takes longer than the period delays the next one, so the achieved rate
+ * falls once the buses saturate. Two read paths are compared for each N x M:
+ *
+ * - blocking: ADT7320_Profile_Sweep() reads every sensor in turn, one bus at a time;
+ * - async: one adt7320_async.h bus per SPI, each chaining the reads of its own sensors
+ *   from the completion callback. Fake_SPI_FinishNext() lets the buses clock in
+ *   parallel and the CPU idles until the earliest transfer ends.
+ *
+ * Latencies go through the profiler (ADT7320_Profile_Record() for the async path). CPU
+ * per sample is the simulated time not spent idle, divided by the reads: for blocking
+ * reads it equals the mean latency, for async reads it is the start and interrupt cost,
+ * while the latency adds the wait for the CPU behind the other buses' interrupts. With
+ * the fake's HAL costs a 3-byte read costs more CPU through IT than it takes on a
+ * 9 MHz bus, so saturated async sweeps are CPU bound from two buses on.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"      /**< Checks and fixtures */
+#include "adt7320_profile.h"  /**< Profiler interface */
+#include "adt7320_async.h"    /**< Asynchronous bus interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_MAX_SENSORS   (256U)
+#define  TEST_MAX_BUSES     (8U)
+#define  TEST_PINS          (16U)               /**< CS pins per port */
+#define  TEST_SWEEPS        (200U)
+#define  TEST_TARGET_HZ     (1000U)             /**< Requested sweep rate */
+#define  TEST_CYCLES_PER_US (FAKE_CORE_HZ / 1000000U)
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief One simulated SPI bus and the sensors it reads */
+typedef struct
+{
+    ADT7320_AsyncBusTypeDef async;
+    uint16_t first;       /**< Index of the bus's first sensor in the sweep order */
+    uint16_t count;       /**< Sensors on the bus */
+    uint16_t next;        /**< Next sensor to read in the current sweep */
+    uint32_t start;       /**< Cycle counter at the start of the read in flight */
+} Test_BusTypeDef;
+
+/** @brief Result of one configuration */
+typedef struct
+{
+    uint32_t sweepsPerSec;
+    uint32_t cpuCycles;       /**< CPU cycles per sample */
+    ADT7320_ProfileReportTypeDef report;
+} Test_ResultTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi[TEST_MAX_BUSES];
+static SPI_TypeDef spi[TEST_MAX_BUSES];
+static GPIO_TypeDef port[TEST_MAX_SENSORS / TEST_PINS];
+static ADT7320_ConfigTypeDef sensors[TEST_MAX_SENSORS];  /**< Grouped by bus */
+static Test_BusTypeDef bus[TEST_MAX_BUSES];
+static uint32_t buses = 0U;
+static uint32_t active = 0U;                             /**< Buses still reading in this sweep */
+static uint32_t wrong = 0U;                              /**< Reads that failed or returned another sensor's value */
+static ADT7320_ProfileTypeDef prof;
+
+
+/* ------------------------------------ HAL Callbacks ------------------------------- */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *h)
+{
+    for (uint32_t b = 0U; b < buses; b++)
+    {
+        ADT7320_Async_Complete(&bus[b].async, h);
+    }
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h)
+{
+    for (uint32_t b = 0U; b < buses; b++)
+    {
+        ADT7320_Async_Error(&bus[b].async, h);
+    }
+}
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Temperature code simulated for sensor @p i.
+ */
+static int16_t Test_Raw(uint32_t i)
+{
+    return (int16_t)((int32_t)(i * 8U) - 1024);
+}
+
+/**
+ * @brief  Attaches @p n sensors spread round-robin over @p m buses, grouped by bus.
+ */
+static void Test_Build(uint32_t n, uint32_t m)
+{
+    uint32_t index = 0U;
+
+    Fake_Reset();
+    buses = m;
+
+    for (uint32_t b = 0U; b < m; b++)
+    {
+        Fake_SPI_Init(&hspi[b], &spi[b]);
+        bus[b].first = (uint16_t)index;
+        bus[b].count = 0U;
+
+        for (uint32_t i = b; i < n; i += m)
+        {
+            sensors[index].SPIx   = &hspi[b];
+            sensors[index].csPort = &port[i / TEST_PINS];
+            sensors[index].csPin  = (uint16_t)(1U << (i % TEST_PINS));
+            (void)Fake_AddSensor(&hspi[b], &port[i / TEST_PINS], sensors[index].csPin, Test_Raw(index));
+            bus[b].count++;
+            index++;
+        }
+
+        TEST_CHECK(ADT7320_Async_Init(&bus[b].async, &hspi[b], ADT7320_ASYNC_IT) == ADT7320_OK);
+    }
+
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(ADT7320_Profile_Init(&prof) == ADT7320_OK);
+}
+
+/**
+ * @brief  Waits for the next sweep slot of the target rate (no wait once behind).
+ */
+static void Test_Pace(uint64_t *pNext)
+{
+    if (Fake_Cycles < *pNext)
+    {
+        Fake_IdleCycles += *pNext - Fake_Cycles;
+        Fake_Cycles      = *pNext;
+    }
+
+    *pNext += FAKE_CORE_HZ / TEST_TARGET_HZ;
+
+    if (*pNext < Fake_Cycles)
+    {
+        *pNext = Fake_Cycles;
+    }
+}
+
+/**
+ * @brief  Fills in the achieved rate and CPU cost of the finished run.
+ */
+static void Test_Report(Test_ResultTypeDef *pResult, uint64_t begin, uint64_t idle, uint64_t *pNext)
+{
+    uint64_t elapsed = 0U;
+
+    /* The run ends where the next sweep would start */
+    Test_Pace(pNext);
+    elapsed = Fake_Cycles - begin;
+
+    TEST_CHECK(ADT7320_Profile_GetReport(&prof, &pResult->report) == ADT7320_OK);
+    pResult->sweepsPerSec = (uint32_t)(((uint64_t)TEST_SWEEPS * FAKE_CORE_HZ) / elapsed);
+    pResult->cpuCycles    = (uint32_t)((elapsed - (Fake_IdleCycles - idle)) / pResult->report.samples);
+}
+
+/**
+ * @brief  Blocking sweeps: every read holds the CPU until its transfer ends.
+ */
+static void Test_Blocking(uint32_t n, Test_ResultTypeDef *pResult)
+{
+    int16_t  raw[TEST_MAX_SENSORS];
+    uint64_t next  = Fake_Cycles;
+    uint64_t begin = Fake_Cycles;
+    uint64_t idle  = Fake_IdleCycles;
+
+    for (uint32_t k = 0U; k < TEST_SWEEPS; k++)
+    {
+        Test_Pace(&next);
+        TEST_CHECK(ADT7320_Profile_Sweep(&prof, sensors, (uint16_t)n, raw) == ADT7320_OK);
+
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            wrong += (raw[i] != Test_Raw(i)) ? 1U : 0U;
+        }
+    }
+
+    Test_Report(pResult, begin, idle, &next);
+}
+
+/**
+ * @brief  Starts the next read of a bus, or retires the bus for this sweep.
+ */
+static void Test_Next(Test_BusTypeDef *pBus);
+
+/**
+ * @brief  Read completion: records the latency and chains the next read of the bus.
+ */
+static void Test_Done(void *pContext, ADT7320_StatusTypeDef status, uint16_t data)
+{
+    Test_BusTypeDef *pBus = (Test_BusTypeDef *)pContext;
+
+    ADT7320_Profile_Record(&prof, DWT->CYCCNT - pBus->start, status);
+    wrong += ( (status != ADT7320_OK) || ((int16_t)data != Test_Raw(pBus->first + pBus->next - 1U)) ) ? 1U : 0U;
+    Test_Next(pBus);
+}
+
+static void Test_Next(Test_BusTypeDef *pBus)
+{
+    if (pBus->next < pBus->count)
+    {
+        pBus->start = DWT->CYCCNT;
+        pBus->next++;
+        TEST_CHECK(ADT7320_Async_Read(&pBus->async, &sensors[pBus->first + pBus->next - 1U], ADT7320_TEMP, 2U, 0U, Test_Done, pBus) == ADT7320_OK);
+    }
+    else
+    {
+        active--;
+    }
+}
+
+/**
+ * @brief  Async sweeps: every bus chains its own reads, all buses clock in parallel.
+ */
+static void Test_Async(Test_ResultTypeDef *pResult)
+{
+    uint64_t next  = Fake_Cycles;
+    uint64_t begin = Fake_Cycles;
+    uint64_t idle  = Fake_IdleCycles;
+
+    for (uint32_t k = 0U; k < TEST_SWEEPS; k++)
+    {
+        Test_Pace(&next);
+        active = buses;
+
+        for (uint32_t b = 0U; b < buses; b++)
+        {
+            bus[b].next = 0U;
+            Test_Next(&bus[b]);
+        }
+
+        while (active != 0U)
+        {
+            TEST_CHECK(Fake_SPI_FinishNext() != 0U);
+        }
+
+        ADT7320_Profile_EndSweep(&prof);
+    }
+
+    Test_Report(pResult, begin, idle, &next);
+}
+
+/**
+ * @brief  Prints one row of the scaling table.
+ */
+static void Test_Print(const char *path, uint32_t n, uint32_t m, const Test_ResultTypeDef *pResult)
+{
+    printf("%-8s %4u %2u %8u %8u %8u %8u %9u %9u\n", path, (unsigned)n, (unsigned)m, (unsigned)pResult->sweepsPerSec,
+           (unsigned)(pResult->report.p50 / TEST_CYCLES_PER_US), (unsigned)(pResult->report.p95 / TEST_CYCLES_PER_US),
+           (unsigned)(pResult->report.p99 / TEST_CYCLES_PER_US), (unsigned)pResult->report.cyclesPerSample, (unsigned)pResult->cpuCycles);
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    static const uint32_t counts[] = { 16U, 64U, 256U };
+    static const uint32_t widths[] = { 1U, 2U, 4U, 8U };
+    Test_ResultTypeDef blocking;
+    Test_ResultTypeDef async;
+    Test_ResultTypeDef async1;
+    Test_ResultTypeDef blocking1;
+
+    printf("%-8s %4s %2s %8s %8s %8s %8s %9s %9s\n", "path", "N", "M", "sweeps/s", "p50 us", "p95 us", "p99 us", "lat cyc", "cpu cyc");
+
+    for (uint32_t c = 0U; c < (sizeof(counts) / sizeof(counts[0U])); c++)
+    {
+        for (uint32_t w = 0U; w < (sizeof(widths) / sizeof(widths[0U])); w++)
+        {
+            uint32_t n = counts[c];
+            uint32_t m = widths[w];
+
+            Test_Build(n, m);
+            Test_Blocking(n, &blocking);
+            Test_Print("blocking", n, m, &blocking);
+
+            Test_Build(n, m);
+            Test_Async(&async);
+            Test_Print("async", n, m, &async);
+
+            TEST_CHECK(blocking.report.samples == (n * TEST_SWEEPS));
+            TEST_CHECK(async.report.samples == (n * TEST_SWEEPS));
+            TEST_CHECK((blocking.report.errors == 0U) && (async.report.errors == 0U));
+
+            /* Blocking reads: the CPU waits out every transfer, latency is CPU time */
+            TEST_CHECK(blocking.cpuCycles >= blocking.report.cyclesPerSample);
+            TEST_CHECK(blocking.cpuCycles < ((blocking.report.cyclesPerSample * 21U) / 20U));
+
+            /* Async reads: the CPU only starts and completes them, while latency grows with queueing */
+            TEST_CHECK(async.cpuCycles < async.report.cyclesPerSample);
+            TEST_CHECK(async.report.p50 <= async.report.p99);
+
+            /* Never faster than requested, nor than the CPU allows */
+            TEST_CHECK(blocking.sweepsPerSec <= TEST_TARGET_HZ);
+            TEST_CHECK(async.sweepsPerSec <= TEST_TARGET_HZ);
+            TEST_CHECK(((uint64_t)async.sweepsPerSec * n * async.cpuCycles) <= FAKE_CORE_HZ);
+
+            if (m == 1U)
+            {
+                blocking1 = blocking;
+                async1    = async;
+            }
+            else
+            {
+                /* More buses do nothing for blocking sweeps; async ones gain until the CPU saturates */
+                TEST_CHECK(blocking.sweepsPerSec == blocking1.sweepsPerSec);
+                TEST_CHECK(async.sweepsPerSec >= async1.sweepsPerSec);
+            }
+        }
+    }
+
+    TEST_CHECK(wrong == 0U);
+    TEST_CHECK(Fake_Contention == 0U);
+    TEST_CHECK(Fake_Unselected == 0U);
+
+    return TEST_RESULT();
+}
+
+
+/* test_profile.c */
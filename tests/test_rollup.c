@@ -0,0 +1,135 @@
+/**
+ * @file    test_rollup.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Rollup tier selection by horizon and partial coverage, update and query cost.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"     /**< Checks and fixtures */
+#include "adt7320_rollup.h"  /**< Rollup interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SECOND  (1000UL)
+#define  TEST_MINUTE  (60UL * TEST_SECOND)
+#define  TEST_HOUR    (60UL * TEST_MINUTE)
+#define  TEST_BENCH   (1000000U)   /**< Samples added, and queries run, by the benchmark */
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static ADT7320_RollupTypeDef roll;
+static uint32_t now = 0U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Adds one sample per second until the given time.
+ */
+static void Test_Fill(uint32_t until)
+{
+    while (now < until)
+    {
+        ADT7320_Rollup_Add(&roll, now, (int16_t)((now / TEST_SECOND) % 1000U));
+        now += TEST_SECOND;
+    }
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_RollupResultTypeDef r;
+    static const uint32_t span[3U] = { 30U * TEST_SECOND, 50U * TEST_MINUTE, 2U * 24U * TEST_HOUR };
+    uint32_t answered = 0U;
+    double   start    = 0.0;
+    double   perAdd   = 0.0;
+    double   perQuery = 0.0;
+
+    TEST_CHECK(ADT7320_Rollup_Init(&roll) == ADT7320_OK);
+    Test_Fill(3U * TEST_HOUR);
+
+    /* Recent 30 s: finest tier, exact */
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, now - (30U * TEST_SECOND), now, &r) == ADT7320_OK);
+    TEST_CHECK(r.resolution == TEST_SECOND);
+    TEST_CHECK(r.count == 30U);
+    TEST_CHECK(r.partial == 0U);
+
+    /* 30 s ten minutes ago: the seconds are gone, the minutes answer */
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, now - (10U * TEST_MINUTE), now - (10U * TEST_MINUTE) + (30U * TEST_SECOND), &r) == ADT7320_OK);
+    TEST_CHECK(r.resolution == TEST_MINUTE);
+    TEST_CHECK(r.count == 60U);
+    TEST_CHECK(r.partial == 0U);
+
+    /* 30 s two hours ago: only the hours tier still reaches back */
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, now - (2U * TEST_HOUR), now - (2U * TEST_HOUR) + (30U * TEST_SECOND), &r) == ADT7320_OK);
+    TEST_CHECK(r.resolution == TEST_HOUR);
+    TEST_CHECK(r.count == 3600U);
+    TEST_CHECK(r.partial == 0U);
+
+    /* 90 min up to now: the minutes tier holds 60 min only, so no truncation to it; the
+       hours tier answers with whole hours, [1 h, 3 h) */
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, now - (90U * TEST_MINUTE), now, &r) == ADT7320_OK);
+    TEST_CHECK(r.resolution == TEST_HOUR);
+    TEST_CHECK(r.count == (2U * 3600U));
+    TEST_CHECK(r.partial == 0U);
+
+    /* 50 min up to now: still within the minutes tier */
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, now - (50U * TEST_MINUTE), now, &r) == ADT7320_OK);
+    TEST_CHECK(r.resolution == TEST_MINUTE);
+    TEST_CHECK(r.count == (50U * 60U));
+
+    /* Beyond the hours horizon: partial result, reporting where coverage starts */
+    Test_Fill((ADT7320_ROLLUP_DEPTH + 4U) * TEST_HOUR);
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, 0U, now, &r) == ADT7320_OK);
+    TEST_CHECK(r.resolution == TEST_HOUR);
+    TEST_CHECK(r.partial != 0U);
+    TEST_CHECK(r.covered == (3U * TEST_HOUR));
+    TEST_CHECK(r.count == ((ADT7320_ROLLUP_DEPTH + 1U) * 3600U));
+
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, 10U * TEST_HOUR, 11U * TEST_HOUR, &r) == ADT7320_OK);
+    TEST_CHECK(r.partial == 0U);
+    TEST_CHECK(r.covered == (10U * TEST_HOUR));
+    TEST_CHECK(r.count == 3600U);
+
+    /* Nothing left at all */
+    TEST_CHECK(ADT7320_Rollup_Query(&roll, 0U, TEST_HOUR, &r) == ADT7320_ERROR);
+
+    /* Benchmark: one sample per second, then queries cycling over a seconds, minutes and hours range */
+    TEST_CHECK(ADT7320_Rollup_Init(&roll) == ADT7320_OK);
+    start = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        ADT7320_Rollup_Add(&roll, i * TEST_SECOND, (int16_t)(i % 1000U));
+    }
+    perAdd = (Test_Now() - start) / (double)TEST_BENCH;
+    now    = TEST_BENCH * TEST_SECOND;
+
+    start = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        answered += (ADT7320_Rollup_Query(&roll, now - span[i % 3U], now, &r) == ADT7320_OK) ? 1U : 0U;
+    }
+    perQuery = (Test_Now() - start) / (double)TEST_BENCH;
+    TEST_CHECK(answered == TEST_BENCH);
+
+    printf("rollup: %u tiers x %u buckets, %.1f ns per sample added, %.1f ns per query [host]\n",
+           (unsigned)ADT7320_ROLLUP_TIERS, (unsigned)ADT7320_ROLLUP_DEPTH, perAdd, perQuery);
+
+    return TEST_RESULT();
+}
+
+
+/* test_rollup.c */
@@ -0,0 +1,123 @@
+/**
+ * @file    test_sensorarray.cpp
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   C++ sensor array batch operations against simulated sensors.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"             /**< Checks and fixtures */
+#include "adt7320_sensorarray.hpp"   /**< C++ sensor array */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SENSORS  (3U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port[TEST_SENSORS];
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    std::array<int32_t, TEST_SENSORS> raw;
+    std::array<int32_t, 2U> pair;
+    uint16_t config = 0U;
+    uint32_t calls  = 0U;
+    int      sim[TEST_SENSORS];
+
+    Fake_Reset();
+    Fake_SPI_Init(&hspi, &spi);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        sim[s] = Fake_AddSensor(&hspi, &port[s], GPIO_PIN_0, static_cast<int16_t>((20U + s) * 128U));
+    }
+
+    adt7320::SensorArray<TEST_SENSORS> sensors({{ {&hspi, &port[0U], GPIO_PIN_0}, {&hspi, &port[1U], GPIO_PIN_0},
+                                                  {&hspi, &port[2U], GPIO_PIN_0} }});
+
+    /* One write per sensor, each in its own CS cycle: no two sensors selected together */
+    calls = Fake_SpiCalls;
+    TEST_CHECK(sensors.configure_all(0x80U) == ADT7320_OK);
+    TEST_CHECK(Fake_SpiCalls == (calls + TEST_SENSORS));
+    Fake_Sync();
+    TEST_CHECK(Fake_CsFalling == TEST_SENSORS);
+    TEST_CHECK(Fake_CsFalling == Fake_CsRising);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(ADT7320_ReadRegister(&sensors[s], ADT7320_CONFIG, 1U, &config) == ADT7320_OK);
+        TEST_CHECK(config == 0x80U);
+    }
+
+    TEST_CHECK(sensors.write_all(ADT7320_THIGH, 3U, 0U) == ADT7320_ERROR);
+
+    /* Batch read */
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    TEST_CHECK(sensors.read_all(raw) == ADT7320_OK);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(raw[s] == static_cast<int32_t>((20U + s) * 128U));
+    }
+
+    TEST_CHECK(sensors.read_all(raw.data(), 2U) == ADT7320_ERROR);
+
+#if (ADT7320_HW_NSS == 0U)
+    /* No CS port and no hardware NSS: that sensor is skipped, never clocked */
+    {
+        adt7320::SensorArray<2U> mixed({{ {&hspi, nullptr, GPIO_PIN_0}, {&hspi, &port[1U], GPIO_PIN_0} }});
+
+        calls = Fake_SpiCalls;
+        TEST_CHECK(mixed.read_all(pair) == ADT7320_ERROR);
+        TEST_CHECK(pair[0U] == adt7320::SensorArray<2U>::invalid);
+        TEST_CHECK(pair[1U] == static_cast<int32_t>(21U * 128U));
+        TEST_CHECK(Fake_SpiCalls == (calls + 1U));
+        TEST_CHECK(mixed.configure_all(0x80U) == ADT7320_ERROR);
+    }
+#else
+    /* Hardware NSS sharing an SPI with another sensor: the bus is never clocked */
+    {
+        adt7320::SensorArray<2U> mixed({{ {&hspi, nullptr, GPIO_PIN_0}, {&hspi, &port[1U], GPIO_PIN_0} }});
+        adt7320::SensorArray<2U> twoNss({{ {&hspi, nullptr, GPIO_PIN_0}, {&hspi, nullptr, GPIO_PIN_0} }});
+
+        calls = Fake_SpiCalls;
+        TEST_CHECK(mixed.read_all(pair) == ADT7320_ERROR);
+        TEST_CHECK( (pair[0U] == adt7320::SensorArray<2U>::invalid) && (pair[1U] == adt7320::SensorArray<2U>::invalid) );
+        TEST_CHECK(mixed.configure_all(0x80U) == ADT7320_ERROR);
+        TEST_CHECK(twoNss.read_all(pair) == ADT7320_ERROR);
+        TEST_CHECK(twoNss.configure_all(0x80U) == ADT7320_ERROR);
+        TEST_CHECK(Fake_SpiCalls == calls);
+    }
+#endif
+
+    Fake_Sync();
+    TEST_CHECK(Fake_CsFalling == Fake_CsRising);
+    TEST_CHECK(Fake_Contention == 0U);
+    TEST_CHECK(Fake_Unselected == 0U);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(Fake_Sensor[sim[s]].modeErrors == 0U);
+    }
+
+    return TEST_RESULT();
+}
+
+
+/* test_sensorarray.cpp */
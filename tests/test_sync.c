@@ -0,0 +1,302 @@
+/**
+ * @file    test_sync.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Discrete-event simulation of sync mode: pulses, RDY polling and contention.
+ *
+ * @details
+ * Simulated time advances in 1 ms steps. Sync pulses arrive on a fixed period and the
+ * main loop polls once per step, as on a board. The sensors convert in different times,
+ * the slowest beyond the typical ADT7320_CONVERSION_MS, and every pulse measures a new
+ * temperature, so a sweep read before its conversions end shows the previous pulse.
+ * Pulses are also injected in the middle of a Poll transfer, and while another driver
+ * holds the SPI.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"   /**< Checks and fixtures */
+#include "adt7320_sync.h"  /**< Sync mode interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SENSORS    (3U)
+#define  TEST_PERIOD_MS  (500U)
+#define  TEST_PULSES     (10U)
+#define  TEST_SLOWEST_MS (300U)
+
+/** @brief Temperature measured by sensor @p s for pulse @p seq */
+#define  TEST_RAW(seq, s)  ((int16_t)((((seq) + 20U) * 128U) + (s)))
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port[TEST_SENSORS];
+static GPIO_TypeDef syncPort;
+static ADT7320_ConfigTypeDef sensors[TEST_SENSORS];
+static ADT7320_FramesTypeDef frames;
+static ADT7320_SyncTypeDef sync;
+static int sim[TEST_SENSORS];
+
+static const uint32_t conversionUs[TEST_SENSORS] = { 200000U, 240000U, TEST_SLOWEST_MS * 1000U };
+
+static uint32_t published = 0U;     /**< Frames checked */
+static uint32_t expectSeq = 0U;     /**< Sequence number of the next frame */
+static uint32_t latencyMax = 0U;    /**< Longest pulse to publish time, in ms */
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Sets the temperatures the sensors measure for pulse @p seq.
+ */
+static void Test_Temps(uint32_t seq)
+{
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        Fake_SetTemp(sim[s], TEST_RAW(seq, s));
+    }
+}
+
+/**
+ * @brief  Sync edge interrupt: sets the temperatures of the next pulse, then triggers.
+ */
+static void Test_Pulse(void)
+{
+    Test_Temps(sync.next);
+    ADT7320_Sync_Trigger(&sync);
+}
+
+/**
+ * @brief  Sync edge interrupt alone (the fake converts when a sensor is next clocked,
+ *         so temperatures set in the middle of a read would leak into it).
+ */
+static void Test_Trigger(void)
+{
+    ADT7320_Sync_Trigger(&sync);
+}
+
+/**
+ * @brief  Takes the published frame and checks it against the pulse it belongs to.
+ *
+ * @param timedOut  Sensor expected to time out, or TEST_SENSORS for none.
+ */
+static void Test_Frame(uint32_t timedOut)
+{
+    const ADT7320_FrameTypeDef *pFrame = NULL;
+
+    TEST_CHECK(ADT7320_Frames_Take(&frames, &pFrame) == ADT7320_OK);
+
+    if (pFrame != NULL)
+    {
+        TEST_CHECK(pFrame->seq == expectSeq);
+        TEST_CHECK(pFrame->count == TEST_SENSORS);
+
+        for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+        {
+            if (s == timedOut)
+            {
+                TEST_CHECK(pFrame->status[s] == (uint8_t)ADT7320_TIMEOUT);
+            }
+            else
+            {
+                TEST_CHECK(pFrame->status[s] == (uint8_t)ADT7320_OK);
+                TEST_CHECK(pFrame->raw[s] == TEST_RAW(pFrame->seq, s));
+            }
+        }
+
+        if ((HAL_GetTick() - pFrame->tick) > latencyMax)
+        {
+            latencyMax = HAL_GetTick() - pFrame->tick;
+        }
+
+        expectSeq = pFrame->seq + 1U;
+        published++;
+        ADT7320_Frames_Release(&frames);
+    }
+}
+
+/**
+ * @brief  Polls every ms until a frame is published or @p ms elapse.
+ *
+ * @return Ticks from the pending pulse to the end of the wait.
+ */
+static uint32_t Test_Wait(uint32_t ms, uint32_t timedOut)
+{
+    uint32_t t    = 0U;
+    uint32_t tick = sync.sweepTick;
+    uint8_t  done = 0U;
+
+    while ( (done == 0U) && (t < ms) )
+    {
+        Fake_AdvanceMs(1U);
+        t++;
+
+        if (ADT7320_Sync_Poll(&sync) == ADT7320_OK)
+        {
+            Test_Frame(timedOut);
+            done = 1U;
+        }
+    }
+
+    return HAL_GetTick() - tick;
+}
+
+/**
+ * @brief  Checks that no chip select is left low and no sensor was misdriven.
+ */
+static void Test_Bus(void)
+{
+    Fake_Sync();
+    TEST_CHECK(Fake_CsFalling == Fake_CsRising);
+    TEST_CHECK(Fake_Contention == 0U);
+    TEST_CHECK(Fake_Unselected == 0U);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(Fake_Sensor[sim[s]].modeErrors == 0U);
+    }
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    uint32_t edges = 0U;
+    uint32_t calls = 0U;
+    uint32_t waited = 0U;
+
+    Fake_Reset();
+    Fake_SPI_Init(&hspi, &spi);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        sensors[s].SPIx   = &hspi;
+        sensors[s].csPort = &port[s];
+        sensors[s].csPin  = GPIO_PIN_0;
+        sim[s] = Fake_AddSensor(&hspi, &port[s], GPIO_PIN_0, 0);
+        Fake_SetConversionUs(sim[s], conversionUs[s]);
+    }
+
+    TEST_CHECK(ADT7320_Frames_Init(&frames, NULL) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Sync_Init(&sync, &frames, sensors, TEST_SENSORS, 0x80U) == ADT7320_OK);
+    Test_Bus();
+
+    /* Periodic pulses: every frame waits for the slowest sensor and holds its own pulse */
+    for (uint32_t n = 0U; n < TEST_PULSES; n++)
+    {
+        edges = Fake_CsFalling;
+        Test_Pulse();
+        Fake_Sync();
+
+        /* One configuration write per sensor: each starts its own conversion */
+        TEST_CHECK(Fake_CsFalling == (edges + TEST_SENSORS));
+        TEST_CHECK(sync.pending != 0U);
+
+        waited = Test_Wait(TEST_PERIOD_MS, TEST_SENSORS);
+        TEST_CHECK(waited >= TEST_SLOWEST_MS);
+        Fake_AdvanceMs(TEST_PERIOD_MS - waited);
+    }
+
+    TEST_CHECK(published == TEST_PULSES);
+    TEST_CHECK(latencyMax <= (TEST_SLOWEST_MS + 2U));
+    TEST_CHECK(sync.missed == 0U);
+    TEST_CHECK(sync.timeouts == 0U);
+
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(Fake_Sensor[sim[s]].conversions == TEST_PULSES);
+    }
+
+    Test_Bus();
+
+    /* RDY is checked at most once per tick */
+    Test_Pulse();
+    Fake_AdvanceMs(1U);
+    TEST_CHECK(ADT7320_Sync_Poll(&sync) == ADT7320_BUSY);
+    calls = Fake_SpiCalls;
+    TEST_CHECK(ADT7320_Sync_Poll(&sync) == ADT7320_BUSY);
+    TEST_CHECK(Fake_SpiCalls == calls);
+    (void)Test_Wait(TEST_PERIOD_MS, TEST_SENSORS);
+
+    /* Pulse during a Poll transfer: deferred, run once Poll releases the SPI */
+    Test_Pulse();
+    Fake_AdvanceMs(TEST_SLOWEST_MS + 1U);
+    Fake_InterruptTransfer(Test_Trigger);
+    TEST_CHECK(ADT7320_Sync_Poll(&sync) == ADT7320_OK);
+    TEST_CHECK(sync.deferrals == 1U);
+    TEST_CHECK(sync.pending != 0U);
+    TEST_CHECK(sync.polling == 0U);
+    Test_Frame(TEST_SENSORS);
+    Test_Temps(sync.sweepSeq);
+    Test_Bus();
+    (void)Test_Wait(TEST_PERIOD_MS, TEST_SENSORS);
+    TEST_CHECK(sync.missed == 0U);
+    TEST_CHECK(sync.failed == 0U);
+
+    /* SPI held by another driver: no chip select moves, the next Poll triggers */
+    edges = Fake_CsFalling;
+    hspi.State = HAL_SPI_STATE_BUSY_TX_RX;
+    Test_Pulse();
+    Fake_Sync();
+    TEST_CHECK(Fake_CsFalling == edges);
+    TEST_CHECK(sync.pending == 0U);
+    hspi.State = HAL_SPI_STATE_READY;
+    TEST_CHECK(ADT7320_Sync_Poll(&sync) == ADT7320_BUSY);
+    TEST_CHECK(sync.pending != 0U);
+    TEST_CHECK(sync.deferrals == 2U);
+    (void)Test_Wait(TEST_PERIOD_MS, TEST_SENSORS);
+
+    /* Two pulses deferred: one sweep, stamped with the later one, the earlier missed */
+    hspi.State = HAL_SPI_STATE_BUSY_TX_RX;
+    Test_Pulse();
+    Test_Pulse();
+    hspi.State = HAL_SPI_STATE_READY;
+    TEST_CHECK(ADT7320_Sync_Poll(&sync) == ADT7320_BUSY);
+    TEST_CHECK(sync.missed == 1U);
+    Test_Temps(sync.sweepSeq);
+    expectSeq++;
+    (void)Test_Wait(TEST_PERIOD_MS, TEST_SENSORS);
+    TEST_CHECK(expectSeq == sync.next);
+
+    /* A sensor that never finishes: published after the timeout, marked ADT7320_TIMEOUT */
+    Fake_SetConversionUs(sim[2U], 10U * 1000000U);
+    Test_Pulse();
+    waited = Test_Wait(2U * ADT7320_SYNC_TIMEOUT_MS, 2U);
+    TEST_CHECK(waited >= ADT7320_SYNC_TIMEOUT_MS);
+    TEST_CHECK(waited <= (ADT7320_SYNC_TIMEOUT_MS + 1U));
+    TEST_CHECK(sync.timeouts == 1U);
+
+    /* Back to normal on the next pulse */
+    Fake_SetConversionUs(sim[2U], conversionUs[2U]);
+    Test_Pulse();
+    (void)Test_Wait(TEST_PERIOD_MS, TEST_SENSORS);
+
+    /* The master's pulse triggers its own sensors */
+    Test_Temps(sync.next);
+    ADT7320_Sync_Pulse(&sync, &syncPort, GPIO_PIN_7);
+    (void)Test_Wait(TEST_PERIOD_MS, TEST_SENSORS);
+
+    TEST_CHECK(expectSeq == sync.next);
+    TEST_CHECK(sync.failed == 0U);
+    Test_Bus();
+
+    printf("sync: %u frames, pulse to frame %u ms max, %u deferred, %u missed, %u timed out\n",
+           (unsigned)published, (unsigned)latencyMax, (unsigned)sync.deferrals, (unsigned)sync.missed, (unsigned)sync.timeouts);
+
+    return TEST_RESULT();
+}
+
+
+/* test_sync.c */
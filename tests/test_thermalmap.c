@@ -0,0 +1,214 @@
+/**
+ * @file    test_thermalmap.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Thermal map: incremental updates against full rebuilds, hottest cell, benchmark.
+ *
+ * @details
+ * A 4 x 4 sensor grid drives the map through a long sequence of pseudo-random readings.
+ * After every reading the incremental map must equal a rebuilt copy cell for cell, and
+ * the hottest cell must match a brute-force scan. The benchmark reports host time per
+ * reading for ADT7320_Map_Update() and ADT7320_Map_Rebuild(), so it compares the two
+ * strategies rather than predicts MCU timings.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include <string.h>              /**< memcpy() */
+#include "test_common.h"         /**< Checks and fixtures */
+#include "adt7320_thermalmap.h"  /**< Thermal map interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_SENSORS   (16U)
+#define  TEST_READINGS  (20000U)
+#define  TEST_BENCH     (200000U)
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static ADT7320_MapTypeDef map;
+static ADT7320_MapTypeDef ref;
+static ADT7320_MapSensorTypeDef layout[TEST_SENSORS];
+static uint32_t seed = 12345U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Deterministic pseudo-random number (LCG).
+ */
+static uint32_t Test_Rand(void)
+{
+    seed = (seed * 1103515245U) + 12345U;
+
+    return seed >> 8U;
+}
+
+/**
+ * @brief  Raw code between 20 °C and 90 °C.
+ */
+static int16_t Test_Raw(void)
+{
+    return (int16_t)((20 * 128) + (int32_t)(Test_Rand() % (70U * 128U)));
+}
+
+/**
+ * @brief  Index of the hottest cell by brute force.
+ */
+static uint16_t Test_Hottest(const ADT7320_MapTypeDef *pMap)
+{
+    uint16_t hot = 0U;
+
+    for (uint16_t c = 1U; c < ADT7320_MAP_CELLS; c++)
+    {
+        if (pMap->cell[c] > pMap->cell[hot])
+        {
+            hot = c;
+        }
+    }
+
+    return hot;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    ADT7320_MapSensorTypeDef outside = { ADT7320_MAP_WIDTH, 0U };
+    uint32_t weights  = 0U;
+    uint32_t mismatch = 0U;
+    uint32_t wrongHot = 0U;
+    uint32_t entries  = 0U;
+    uint16_t x        = 0U;
+    uint16_t y        = 0U;
+    int16_t  value    = 0;
+    int16_t  lo       = INT16_MAX;
+    int16_t  hi       = INT16_MIN;
+    double   start    = 0.0;
+    double   update   = 0.0;
+    double   rebuild  = 0.0;
+
+    /* Sensors on a 4 x 4 grid, 4 cells apart, offset from the border */
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        layout[s].x = (uint16_t)(2U + ((s % 4U) * 4U));
+        layout[s].y = (uint16_t)(2U + ((s / 4U) * 4U));
+    }
+
+    TEST_CHECK(ADT7320_Map_Init(&map, NULL, 1U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Map_Init(&map, layout, 0U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Map_Init(&map, layout, (uint8_t)(ADT7320_MAP_MAX_SENSORS + 1U)) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Map_Init(&map, &outside, 1U) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Map_Init(&map, layout, (uint8_t)TEST_SENSORS) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Map_Update(&map, (uint8_t)TEST_SENSORS, 0) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Map_GetCell(&map, ADT7320_MAP_WIDTH, 0U, &value) == ADT7320_ERROR);
+
+    /* Every cell has a full set of weights summing to exactly one */
+    entries = map.offset[TEST_SENSORS];
+    TEST_CHECK(entries <= (ADT7320_MAP_CELLS * ADT7320_MAP_NEIGHBOURS));
+    for (uint16_t c = 0U; c < ADT7320_MAP_CELLS; c++)
+    {
+        weights = 0U;
+        for (uint32_t i = 0U; i < entries; i++)
+        {
+            if (map.weight[i].cell == c)
+            {
+                weights += map.weight[i].weight;
+            }
+        }
+        TEST_CHECK(weights == ADT7320_MAP_WEIGHT_ONE);
+    }
+
+    /* A uniform plate maps to a uniform map */
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(ADT7320_Map_Update(&map, (uint8_t)s, 40 * 128) == ADT7320_OK);
+    }
+    for (uint16_t c = 0U; c < ADT7320_MAP_CELLS; c++)
+    {
+        TEST_CHECK(ADT7320_Map_GetCell(&map, (uint16_t)(c % ADT7320_MAP_WIDTH), (uint16_t)(c / ADT7320_MAP_WIDTH), &value) == ADT7320_OK);
+        TEST_CHECK(value == (40 * 128));
+    }
+
+    /* Random readings: incremental equals rebuilt, hottest equals brute force */
+    memcpy(&ref, &map, sizeof(map));
+    for (uint32_t i = 0U; i < TEST_READINGS; i++)
+    {
+        uint8_t s   = (uint8_t)(Test_Rand() % TEST_SENSORS);
+        int16_t raw = Test_Raw();
+
+        (void)ADT7320_Map_Update(&map, s, raw);
+        ref.raw[s] = raw;
+        (void)ADT7320_Map_Rebuild(&ref);
+
+        if (memcmp(map.cell, ref.cell, sizeof(map.cell)) != 0)
+        {
+            mismatch++;
+        }
+
+        (void)ADT7320_Map_GetHottest(&map, &x, &y, &value);
+        if (map.cell[(y * ADT7320_MAP_WIDTH) + x] != map.cell[Test_Hottest(&map)])
+        {
+            wrongHot++;
+        }
+    }
+    TEST_CHECK(mismatch == 0U);
+    TEST_CHECK(wrongHot == 0U);
+
+    /* Sensor cells read back their sensor; every cell stays within the readings */
+    for (uint32_t s = 0U; s < TEST_SENSORS; s++)
+    {
+        TEST_CHECK(ADT7320_Map_GetCell(&map, layout[s].x, layout[s].y, &value) == ADT7320_OK);
+        TEST_CHECK(value == map.raw[s]);
+        lo = (map.raw[s] < lo) ? map.raw[s] : lo;
+        hi = (map.raw[s] > hi) ? map.raw[s] : hi;
+    }
+    for (uint16_t c = 0U; c < ADT7320_MAP_CELLS; c++)
+    {
+        (void)ADT7320_Map_GetCell(&map, (uint16_t)(c % ADT7320_MAP_WIDTH), (uint16_t)(c / ADT7320_MAP_WIDTH), &value);
+        TEST_CHECK( (value >= lo) && (value <= hi) );
+    }
+
+    /* A hot spot under one sensor moves the hottest cell onto it, and away once it cools */
+    TEST_CHECK(ADT7320_Map_Update(&map, 5U, 120 * 128) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Map_GetHottest(&map, &x, &y, &value) == ADT7320_OK);
+    TEST_CHECK( (x == layout[5U].x) && (y == layout[5U].y) && (value == (120 * 128)) );
+    TEST_CHECK(ADT7320_Map_Update(&map, 5U, 0) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Map_GetHottest(&map, &x, &y, &value) == ADT7320_OK);
+    TEST_CHECK(map.cell[(y * ADT7320_MAP_WIDTH) + x] == map.cell[Test_Hottest(&map)]);
+
+    /* Benchmark: one reading applied incrementally vs a full rebuild */
+    start = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        (void)ADT7320_Map_Update(&map, (uint8_t)(i % TEST_SENSORS), (int16_t)((30 * 128) + (int32_t)(i % 1024U)));
+    }
+    update = (Test_Now() - start) / (double)TEST_BENCH;
+
+    start = Test_Now();
+    for (uint32_t i = 0U; i < (TEST_BENCH / 10U); i++)
+    {
+        ref.raw[i % TEST_SENSORS] = (int16_t)((30 * 128) + (int32_t)(i % 1024U));
+        (void)ADT7320_Map_Rebuild(&ref);
+    }
+    rebuild = (Test_Now() - start) / (double)(TEST_BENCH / 10U);
+
+    printf("thermalmap: %ux%u cells, %u sensors, %u weights; update %.1f ns/reading (%u cells), rebuild %.1f ns/reading [host]\n",
+           (unsigned)ADT7320_MAP_WIDTH, (unsigned)ADT7320_MAP_HEIGHT, (unsigned)TEST_SENSORS, (unsigned)entries,
+           update, (unsigned)(entries / TEST_SENSORS), rebuild);
+
+    return TEST_RESULT();
+}
+
+
+/* test_thermalmap.c */
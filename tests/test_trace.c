@@ -0,0 +1,167 @@
+/**
+ * @file    test_trace.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Bus-traffic regression test of the core driver against golden traces.
+ *
+ * @details
+ * The fake HAL reports every CS cycle seen on the wire to ADT7320_Trace_Record(), so
+ * the traces cover what the bus actually carried rather than what the driver meant
+ * to send. Each scenario is checked against its golden stream and budget, and the
+ * bytes per sample of each scenario are printed as a table.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"           /**< Checks and fixtures */
+#include "adt7320_trace.h"         /**< Trace interface */
+#include "golden/trace_golden.h"   /**< Golden streams and budgets */
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief One scenario of the summary table */
+typedef struct
+{
+    const char *name;
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t samples;
+    uint32_t bytesPerSample;  /**< Q8 */
+} Test_RowTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_TraceTypeDef trace;
+static Test_RowTypeDef rows[4U];
+static uint8_t rowCount = 0U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Checks a finished scenario and adds it to the summary table.
+ */
+static void Test_Scenario(const char *name, const uint8_t *pGolden, uint16_t goldenLength, uint32_t maxTransactions, uint32_t maxBytes, uint32_t samples)
+{
+    ADT7320_TraceBudgetTypeDef budget = { maxTransactions, maxBytes, pGolden, goldenLength };
+    Test_RowTypeDef *pRow = &rows[rowCount++];
+
+    ADT7320_Trace_Stop();
+
+    pRow->name         = name;
+    pRow->transactions = trace.transactions;
+    pRow->bytes        = trace.bytes;
+    pRow->samples      = samples;
+
+    if (ADT7320_Trace_Check(&trace, &budget) != ADT7320_OK)
+    {
+        printf("%s: %u transactions / %u bytes (budget %u / %u) or stream differs from golden\n", name,
+               (unsigned)trace.transactions, (unsigned)trace.bytes, (unsigned)maxTransactions, (unsigned)maxBytes);
+        Test_Failures++;
+    }
+
+    if (samples != 0U)
+    {
+        TEST_CHECK(ADT7320_Trace_BytesPerSample(&trace, samples, &pRow->bytesPerSample) == ADT7320_OK);
+    }
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    uint16_t status = 0U;
+    float    temp   = 0.0f;
+    int      s      = Test_Setup(&sensor, &hspi, &spi, &port, 25 * 128);
+
+    Fake_SetObserver(ADT7320_Trace_Record);
+
+    /* Init */
+    ADT7320_Trace_Start(&trace);
+    TEST_CHECK(ADT7320_Init(&sensor) == ADT7320_OK);
+    Test_Scenario("init", Golden_Init, sizeof(Golden_Init), GOLDEN_INIT_TRANSACTIONS, GOLDEN_INIT_BYTES, 0U);
+
+    /* Configure */
+    ADT7320_Trace_Start(&trace);
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_CONFIG, 1U, 0x80U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_TCRIT, 2U, 80U * 128U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_THIGH, 2U, 50U * 128U) == ADT7320_OK);
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_TLOW,  2U, 20U * 128U) == ADT7320_OK);
+    Test_Scenario("configure", Golden_Configure, sizeof(Golden_Configure), GOLDEN_CONFIGURE_TRANSACTIONS, GOLDEN_CONFIGURE_BYTES, 0U);
+
+    /* N reads */
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    ADT7320_Trace_Start(&trace);
+
+    for (uint32_t i = 0U; i < GOLDEN_READS; i++)
+    {
+        TEST_CHECK(ADT7320_ReadTemperature(&sensor, &temp) == ADT7320_OK);
+        TEST_CHECK(temp == 25.0f);
+        Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    }
+
+    Test_Scenario("reads", Golden_Reads, sizeof(Golden_Reads), GOLDEN_READS_TRANSACTIONS, GOLDEN_READS_BYTES, GOLDEN_READS);
+
+    /* Alarm handling */
+    Fake_SetTemp(s, 55 * 128);
+    Fake_AdvanceMs(ADT7320_CONVERSION_MS);
+    ADT7320_Trace_Start(&trace);
+    TEST_CHECK(ADT7320_ReadRegister(&sensor, ADT7320_STATUS, 1U, &status) == ADT7320_OK);
+    TEST_CHECK((status & ADT7320_STATUS_THIGH) != 0U);
+    TEST_CHECK(ADT7320_ReadTemperature(&sensor, &temp) == ADT7320_OK);
+    TEST_CHECK(temp == 55.0f);
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_THIGH, 2U, 60U * 128U) == ADT7320_OK);
+    Test_Scenario("alarm", Golden_Alarm, sizeof(Golden_Alarm), GOLDEN_ALARM_TRANSACTIONS, GOLDEN_ALARM_BYTES, 1U);
+
+    /* The guard itself: one extra read must break the N-reads budget */
+    {
+        ADT7320_TraceBudgetTypeDef budget = { GOLDEN_READS_TRANSACTIONS, GOLDEN_READS_BYTES, NULL, 0U };
+
+        ADT7320_Trace_Start(&trace);
+
+        for (uint32_t i = 0U; i <= GOLDEN_READS; i++)
+        {
+            TEST_CHECK(ADT7320_ReadTemperature(&sensor, &temp) == ADT7320_OK);
+        }
+
+        ADT7320_Trace_Stop();
+        TEST_CHECK(ADT7320_Trace_Check(&trace, &budget) == ADT7320_ERROR);
+    }
+
+    TEST_CHECK(Fake_Sensor[s].modeErrors == 0U);
+    TEST_CHECK(Fake_Unselected == 0U);
+
+    printf("\n%-10s %12s %6s %8s %13s\n", "scenario", "transactions", "bytes", "samples", "bytes/sample");
+
+    for (uint8_t i = 0U; i < rowCount; i++)
+    {
+        if (rows[i].samples != 0U)
+        {
+            printf("%-10s %12u %6u %8u %9u.%02u\n", rows[i].name, (unsigned)rows[i].transactions, (unsigned)rows[i].bytes,
+                   (unsigned)rows[i].samples, (unsigned)(rows[i].bytesPerSample >> 8U), (unsigned)(((rows[i].bytesPerSample & 0xFFU) * 100U) >> 8U));
+        }
+        else
+        {
+            printf("%-10s %12u %6u %8s %13s\n", rows[i].name, (unsigned)rows[i].transactions, (unsigned)rows[i].bytes, "-", "-");
+        }
+    }
+
+    return TEST_RESULT();
+}
+
+
+/* test_trace.c */
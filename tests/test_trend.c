@@ -0,0 +1,217 @@
+/**
+ * @file    test_trend.c
+ * @author  Amirhossein Askari
+ * @version 1.0.0
+ * @date    2026-10-18
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Time-to-threshold predictor: prediction accuracy, warnings, and per-sample cost.
+ *
+ * @details
+ * Limits are programmed into a simulated sensor and loaded once; after that no sample
+ * touches the SPI. Ramps sampled every ADT7320_CONVERSION_MS check the predicted time
+ * against the exact crossing time, with and without noise, and check that the warning
+ * is raised once per approach. The cost per sample is host time for the full window.
+ *
+ * @copyright
+ * MIT License. See LICENSE file for details.
+ */
+
+
+/* ------------------------------------ Includes ------------------------------------ */
+
+#include "test_common.h"       /**< Checks and fixtures */
+#include "adt7320_trend.h"     /**< Trend predictor interface */
+
+
+/* ------------------------------------ Defines ------------------------------------- */
+
+#define  TEST_PERIOD_MS   (ADT7320_CONVERSION_MS)
+#define  TEST_HORIZON_MS  (5000U)
+#define  TEST_THIGH       (64 * 128)
+#define  TEST_TCRIT       (80 * 128)
+#define  TEST_RATE        (128)          /**< Heating rate, raw code per second (1 °C/s) */
+#define  TEST_BENCH       (1000000U)
+
+
+/* -------------------------------- Private Types ----------------------------------- */
+
+/** @brief Warnings received */
+typedef struct
+{
+    uint32_t calls[ADT7320_TREND_LIMITS];
+    uint32_t tick[ADT7320_TREND_LIMITS];    /**< Sample tick of the last warning */
+    uint32_t ttl[ADT7320_TREND_LIMITS];     /**< Predicted time of the last warning */
+} Test_WarningsTypeDef;
+
+
+/* -------------------------------- Private Variables ------------------------------- */
+
+static SPI_HandleTypeDef hspi;
+static SPI_TypeDef spi;
+static GPIO_TypeDef port;
+static ADT7320_ConfigTypeDef sensor;
+static ADT7320_TrendTypeDef trend;
+static Test_WarningsTypeDef warnings;
+static uint32_t now = 0U;
+static uint32_t rampStart = 0U;
+static uint32_t seed = 83U;
+
+
+/* ------------------------------- Private Functions -------------------------------- */
+
+/**
+ * @brief  Early-warning callback.
+ */
+static void Test_Warning(ADT7320_TrendLimitTypeDef limit, uint32_t ttlMs)
+{
+    warnings.calls[limit]++;
+    warnings.tick[limit] = now;
+    warnings.ttl[limit]  = ttlMs;
+}
+
+/**
+ * @brief  Noise of +/- @p amplitude LSB (LCG).
+ */
+static int32_t Test_Noise(int32_t amplitude)
+{
+    seed = (seed * 1103515245U) + 12345U;
+
+    return (amplitude == 0) ? 0 : ((int32_t)((seed >> 16U) % (uint32_t)((2 * amplitude) + 1))) - amplitude;
+}
+
+/**
+ * @brief  Heats from @p from at TEST_RATE until TCRIT is passed, checking every prediction.
+ *
+ * @return Largest prediction error for TCRIT within two horizons of the crossing, once
+ *         the window is full, in ms.
+ */
+static uint32_t Test_Ramp(int32_t from, int32_t noise)
+{
+    uint32_t errMax  = 0U;
+    uint32_t ttl     = 0U;
+    uint32_t samples = 0U;
+    int32_t  raw     = from;
+
+    rampStart = now;
+
+    while (raw < (TEST_TCRIT + TEST_RATE))
+    {
+        raw = from + (int32_t)(((now - rampStart) * (uint32_t)TEST_RATE) / 1000U);
+        ADT7320_Trend_Add(&trend, now, (int16_t)(raw + Test_Noise(noise)));
+        samples++;
+
+        TEST_CHECK(ADT7320_Trend_GetTimeTo(&trend, ADT7320_TREND_TCRIT, &ttl) == ADT7320_OK);
+
+        if ( (samples >= ADT7320_TREND_WINDOW) && (raw < TEST_TCRIT) )
+        {
+            uint32_t exact = (uint32_t)(((TEST_TCRIT - raw) * 1000) / TEST_RATE);
+            uint32_t err   = (ttl > exact) ? (ttl - exact) : (exact - ttl);
+
+            if (exact <= (2U * TEST_HORIZON_MS))
+            {
+                errMax = (err > errMax) ? err : errMax;
+            }
+        }
+
+        now += TEST_PERIOD_MS;
+    }
+
+    return errMax;
+}
+
+
+/* ------------------------------------ Main ---------------------------------------- */
+
+int main(void)
+{
+    uint32_t calls    = 0U;
+    uint32_t ttl      = 0U;
+    uint32_t errFlat  = 0U;
+    uint32_t errNoisy = 0U;
+    double   start    = 0.0;
+    double   perAdd   = 0.0;
+
+    (void)Test_Setup(&sensor, &hspi, &spi, &port, 40 * 128);
+
+    /* Power-on limits until loaded */
+    TEST_CHECK(ADT7320_Trend_Init(NULL, TEST_HORIZON_MS, NULL) == ADT7320_ERROR);
+    TEST_CHECK(ADT7320_Trend_Init(&trend, TEST_HORIZON_MS, Test_Warning) == ADT7320_OK);
+    TEST_CHECK(trend.limit[ADT7320_TREND_TCRIT] == (147 * 128));
+    TEST_CHECK(trend.limit[ADT7320_TREND_THIGH] == (64 * 128));
+    TEST_CHECK(ADT7320_Trend_GetTimeTo(&trend, ADT7320_TREND_LIMITS, &ttl) == ADT7320_ERROR);
+
+    /* Limits come from the sensor registers, read once */
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_TCRIT, 2U, (uint16_t)TEST_TCRIT) == ADT7320_OK);
+    TEST_CHECK(ADT7320_WriteRegister(&sensor, ADT7320_THIGH, 2U, (uint16_t)TEST_THIGH) == ADT7320_OK);
+    TEST_CHECK(ADT7320_Trend_LoadLimits(&trend, &sensor) == ADT7320_OK);
+    TEST_CHECK(trend.limit[ADT7320_TREND_TCRIT] == TEST_TCRIT);
+    TEST_CHECK(trend.limit[ADT7320_TREND_THIGH] == TEST_THIGH);
+
+    /* Steady temperature: nothing approached */
+    calls = Fake_SpiCalls;
+    for (uint32_t i = 0U; i < (2U * ADT7320_TREND_WINDOW); i++)
+    {
+        ADT7320_Trend_Add(&trend, now, (int16_t)(40 * 128));
+        now += TEST_PERIOD_MS;
+    }
+    TEST_CHECK(ADT7320_Trend_GetTimeTo(&trend, ADT7320_TREND_TCRIT, &ttl) == ADT7320_OK);
+    TEST_CHECK(ttl == ADT7320_TREND_NEVER);
+
+    /* Clean ramp: predictions within one sample period, one warning per limit */
+    errFlat = Test_Ramp(40 * 128, 0);
+    TEST_CHECK(errFlat <= TEST_PERIOD_MS);
+    TEST_CHECK(Fake_SpiCalls == calls);
+
+    for (uint32_t l = 0U; l < (uint32_t)ADT7320_TREND_LIMITS; l++)
+    {
+        TEST_CHECK(warnings.calls[l] == 1U);
+        TEST_CHECK(warnings.ttl[l] <= TEST_HORIZON_MS);
+        TEST_CHECK(warnings.ttl[l] > (TEST_HORIZON_MS - (2U * TEST_PERIOD_MS)));
+    }
+
+    /* The THIGH warning comes about one horizon before the crossing */
+    {
+        uint32_t crossing = warnings.tick[ADT7320_TREND_THIGH] + warnings.ttl[ADT7320_TREND_THIGH];
+        uint32_t actual   = rampStart + (uint32_t)(((TEST_THIGH - (40 * 128)) * 1000) / TEST_RATE);
+
+        TEST_CHECK( (crossing + TEST_PERIOD_MS >= actual) && (crossing <= actual + TEST_PERIOD_MS) );
+    }
+
+    /* Above the limit: zero */
+    TEST_CHECK(ADT7320_Trend_GetTimeTo(&trend, ADT7320_TREND_TCRIT, &ttl) == ADT7320_OK);
+    TEST_CHECK(ttl == 0U);
+
+    /* Cooling re-arms the warnings, the next approach raises them again */
+    for (uint32_t i = 0U; i < (2U * ADT7320_TREND_WINDOW); i++)
+    {
+        ADT7320_Trend_Add(&trend, now, (int16_t)((40 * 128) - (int32_t)(i * 16U)));
+        now += TEST_PERIOD_MS;
+    }
+    TEST_CHECK(ADT7320_Trend_GetTimeTo(&trend, ADT7320_TREND_THIGH, &ttl) == ADT7320_OK);
+    TEST_CHECK(ttl == ADT7320_TREND_NEVER);
+    TEST_CHECK(trend.warned[ADT7320_TREND_THIGH] == 0U);
+
+    /* Noisy ramp (+/- 0.1 °C): still a usable estimate */
+    errNoisy = Test_Ramp(40 * 128, 13);
+    TEST_CHECK(errNoisy <= 500U);
+    TEST_CHECK(warnings.calls[ADT7320_TREND_TCRIT] >= 2U);
+    TEST_CHECK(warnings.calls[ADT7320_TREND_THIGH] >= 2U);
+
+    /* Per-sample cost with a full window */
+    start = Test_Now();
+    for (uint32_t i = 0U; i < TEST_BENCH; i++)
+    {
+        ADT7320_Trend_Add(&trend, now, (int16_t)((40 * 128) + (int32_t)(i % 64U)));
+        now += TEST_PERIOD_MS;
+    }
+    perAdd = (Test_Now() - start) / (double)TEST_BENCH;
+
+    printf("trend: window %u, TCRIT error %u ms clean / %u ms noisy, %.1f ns per sample [host]\n",
+           (unsigned)ADT7320_TREND_WINDOW, (unsigned)errFlat, (unsigned)errNoisy, perAdd);
+
+    return TEST_RESULT();
+}
+
+
+/* test_trend.c */